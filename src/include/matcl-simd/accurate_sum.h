@@ -0,0 +1,201 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd.h"
+#include "matcl-simd/details/float/twofold.h"
+
+#include <cstddef>
+
+namespace matcl { namespace simd
+{
+
+//-----------------------------------------------------------------------
+//                      ACCURATE SUMS AND DOT PRODUCTS
+//-----------------------------------------------------------------------
+// functions defined below process arrays using vectors of type Simd_type;
+// versions without the Simd_type template argument use the default simd
+// type for given value type (see default_simd_type); arrays need not be
+// aligned; the last incomplete vector is processed using partial loads
+// and stores; results are deterministic for given Simd_type, i.e. they do
+// not depend on alignment of arrays, but can change when the simd type
+// changes (for example on processors with different instruction sets)
+
+// sum of elements of the array x of length n computed as if in twice the
+// working precision (algorithm Sum2 from [1]); the result r + e satisfies:
+//      |res - r|       <= u * |res| + g(n-1)^2 * sum_i |x_i|
+//      |res - (r + e)| <= g(n-1)^2 * sum_i |x_i|
+// where res is the exact sum, u is the unit roundoff and g(n) = n*u/(1-n*u);
+// accumulation is performed in 4 vectors simultaneously in order to hide
+// latency of floating point additions; twofold result r + e is returned
+// (see also twofold.h); the function is memory bound for large arrays
+//
+// References:
+//  [1]. Accurate Sum and Dot Product, T. Ogita, S.M. Rump, S. Oishi, 2005
+template<class Val>
+twofold<Val>    sum2(const Val* x, size_t n);
+
+template<class Simd_type>
+twofold<typename Simd_type::value_type>
+                sum2(const typename Simd_type::value_type* x, size_t n);
+
+// dot product of arrays x and y of length n computed as if in twice the
+// working precision (algorithm Dot2 from [1]); the result r + e satisfies:
+//      |res - r|       <= u * |res| + g(n)^2 * sum_i |x_i * y_i|
+//      |res - (r + e)| <= g(n)^2 * sum_i |x_i * y_i|
+// where res is the exact dot product; products are evaluated exactly using
+// FMA instructions if available or Dekker's algorithm otherwise; accumulation
+// is performed in 4 vectors simultaneously; see sum2 for details
+template<class Val>
+twofold<Val>    dot2(const Val* x, const Val* y, size_t n);
+
+template<class Simd_type>
+twofold<typename Simd_type::value_type>
+                dot2(const typename Simd_type::value_type* x,
+                    const typename Simd_type::value_type* y, size_t n);
+
+// evaluate y + y_err := a * x + (y + y_err) for arrays x, y, and y_err of
+// length n, where y + y_err is a twofold number stored in two arrays; all
+// operations are performed in twofold arithmetic and the result is normalized
+// (|y_err[i]| <= ulp(|y[i]|)/2), therefore y[i] is the properly rounded value
+// of the twofold accumulator; this function allows for accumulating sums of
+// many axpy operations (for example matrix-vector products computed columnwise)
+// with accuracy as if in twice the working precision; arrays y and y_err
+// must not overlap with x and with each other; relative forward error of
+// each update does not exceed 3 * u^2
+template<class Val>
+void            axpy2(const Val& a, const Val* x, Val* y, Val* y_err, size_t n);
+
+template<class Simd_type>
+void            axpy2(const typename Simd_type::value_type& a,
+                    const typename Simd_type::value_type* x,
+                    typename Simd_type::value_type* y,
+                    typename Simd_type::value_type* y_err, size_t n);
+
+//-----------------------------------------------------------------------
+//                      REPRODUCIBLE SUMS
+//-----------------------------------------------------------------------
+// binned accumulator for reproducible summation of double or float values;
+// the result does not depend on the order of summation, the simd type used,
+// and on partitioning of summands between different accumulators (for
+// example between threads), i.e. results are bitwise identical for any
+// instruction set and any partitioning;
+//
+// Each summand x is scaled by a power of 2 and split into fold = 3 parts
+// x = q_1 + q_2 + q_3 + r, where q_k is a multiple of 2^(E_k - 52), E_k are
+// fixed exponents determined by a bound on |x| and on the number of summands,
+// and r is dropped; q_k is obtained by pre-rounding: q_k = fl(s_k + x) - s_k,
+// where s_k = 1.5 * 2^E_k; parts q_k are accumulated in double precision 
+// without rounding errors, therefore the sum of parts does not depend on 
+// the summation order; accumulation is always performed in double precision,
+// also for float summands. The absolute error of the result does not exceed
+//      |res - r| <= u * |res| + n * 2^(E_3 - 52), 
+//      E_3 = E_1 - 2 * (52 - L),   E_1 = e + L + 1,  L = ceil(log2(2n))
+// where res is the exact sum, r is the computed value, e is the exponent of
+// the bound max_abs (max_abs < 2^e), n is the number of summands, and u is
+// the unit roundoff of Val; for n = 10^8 the second term is about 
+// 2^-70 * n * max_abs, for n = 10^4 about 2^-109 * n * max_abs.
+//
+// If max_abs is inf or nan, then summands are added naively in double
+// precision (the result is inf or nan); if one of summands is nan, then nan
+// is returned.
+//
+// References:
+//  [1]. Fast reproducible floating-point summation, J. Demmel, H.D. Nguyen,
+//      2013
+template<class Val>
+class repro_accumulator
+{
+    public:
+        // type of summands
+        using value_type    = Val;
+
+        // number of bins
+        static const int
+        fold                = 3;
+
+    private:
+        double          m_sigma[fold];
+        double          m_acc[fold];
+        double          m_scale;
+        double          m_scale_inv;
+        bool            m_special;
+
+    public:
+        // create accumulator for at most n summands or n products (in case
+        // of dot products) with absolute values not exceeding max_abs;
+        // accumulators, which are merged, must be created with the same
+        // arguments; if these requirements are not satisfied, then the result
+        // is not reproducible
+        repro_accumulator(double max_abs, size_t n);
+
+    public:
+        // add elements of array x of length n; elements are processed using
+        // vectors of type Simd_type (simd type storing values of type Val)
+        template<class Simd_type = typename default_simd_type<Val>::type>
+        void            add(const Val* x, size_t n);
+
+        // add products x[i] * y[i] for 0 <= i < n; products are computed
+        // exactly; max_abs must be a bound on |x[i] * y[i]| (see max_abs_prod)
+        template<class Simd_type = typename default_simd_type<Val>::type>
+        void            add_dot(const Val* x, const Val* y, size_t n);
+
+        // add all summands stored in the accumulator acc; acc must be created
+        // with the same arguments as this accumulator; this operation is exact
+        void            merge(const repro_accumulator& acc);
+
+        // return the sum of all summands rounded to Val
+        Val             value() const;
+
+    public:
+        // return maximum of |x[i]|, 0 <= i < n; this is a valid bound max_abs
+        // for summation of elements of x
+        template<class Simd_type = typename default_simd_type<Val>::type>
+        static double   max_abs(const Val* x, size_t n);
+
+        // return maximum of |x[i] * y[i]|, 0 <= i < n, where products are
+        // rounded to double; this is a valid bound max_abs for dot product of
+        // x and y
+        template<class Simd_type = typename default_simd_type<Val>::type>
+        static double   max_abs_prod(const Val* x, const Val* y, size_t n);
+
+    private:
+        template<class Simd_type>
+        void            add_impl(const Val* x, size_t n);
+
+        template<class Simd_type>
+        void            add_dot_impl(const Val* x, const Val* y, size_t n);
+};
+
+// reproducible sum of elements of the array x of length n; equivalent to
+// creating repro_accumulator with max_abs = repro_accumulator::max_abs(x, n)
+// and adding x; array is read twice; see repro_accumulator for details
+template<class Val>
+Val             sum_repro(const Val* x, size_t n);
+
+template<class Simd_type>
+typename Simd_type::value_type
+                sum_repro(const typename Simd_type::value_type* x, size_t n);
+
+// reproducible dot product of arrays x and y of length n; equivalent to 
+// creating repro_accumulator with max_abs = repro_accumulator::max_abs_prod(x,
+// y, n) and calling add_dot; arrays are read twice; see repro_accumulator for
+// details
+template<class Val>
+Val             dot_repro(const Val* x, const Val* y, size_t n);
+
+template<class Simd_type>
+typename Simd_type::value_type
+                dot_repro(const typename Simd_type::value_type* x,
+                    const typename Simd_type::value_type* y, size_t n);
+
+}}
+
+#include "matcl-simd/details/float/accurate_sum.inl"
+#include "matcl-simd/details/float/reproducible_sum.inl"
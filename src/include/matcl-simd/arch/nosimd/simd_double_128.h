@@ -125,6 +125,11 @@ class alignas(16) simd<double, 128, nosimd_tag>
         static simd     load(const double* arr, std::true_type aligned);
         static simd     load(const double* arr, std::false_type not_aligned = std::false_type());
 
+        // construct vector with first n elements copied from arr and remaining
+        // elements set to zero; 0 <= n <= vector_size; arr[n], arr[n+1], ...
+        // are not accessed
+        static simd     load_partial(const double* arr, int n);
+
         // set the first element in the vector to v and set 0 to all other elements
         static simd     set_lower(double v);
 
@@ -141,6 +146,10 @@ class alignas(16) simd<double, 128, nosimd_tag>
         void            store(double* arr, std::true_type aligned) const;
         void            store(double* arr, std::false_type not_aligned = std::false_type()) const;
 
+        // store first n elements in arr; 0 <= n <= vector_size; arr[n], arr[n+1],
+        // ... are not accessed
+        void            store_partial(double* arr, int n) const;
+
         //store elements with in array with stepping (Step = 1,-1 is not optimized)
         template<int Step>
         void            scatter(double* arr) const;
@@ -134,6 +134,11 @@ class alignas(32) simd<int32_t, 256, nosimd_tag>
         static simd     load(const int32_t* arr, std::true_type aligned);
         static simd     load(const int32_t* arr, std::false_type not_aligned = std::false_type());
 
+        // construct vector with first n elements copied from arr and remaining
+        // elements set to zero; 0 <= n <= vector_size; arr[n], arr[n+1], ...
+        // are not accessed
+        static simd     load_partial(const int32_t* arr, int n);
+
         // gather 32-bit integer elements from memory using 32-bit indices, 
         // i.e. i-th element of resulting vector is arr[ind[i]]
         static simd     gather(const int32_t* arr, const simd_int32& ind);
@@ -148,6 +153,10 @@ class alignas(32) simd<int32_t, 256, nosimd_tag>
         void            store(int32_t* arr, std::true_type aligned) const;
         void            store(int32_t* arr, std::false_type not_aligned = std::false_type()) const;
 
+        // store first n elements in arr; 0 <= n <= vector_size; arr[n], arr[n+1],
+        // ... are not accessed
+        void            store_partial(int32_t* arr, int n) const;
+
         //store elements with in array with stepping (Step = 1,-1 is not optimized)
         template<int Step>
         void            scatter(int32_t* arr) const;
@@ -122,6 +122,11 @@ class alignas(16) simd<float, 128, sse_tag>
         static simd     load(const float* arr, std::true_type aligned);
         static simd     load(const float* arr, std::false_type not_aligned = std::false_type());
 
+        // construct vector with first n elements copied from arr and remaining
+        // elements set to zero; 0 <= n <= vector_size; arr[n], arr[n+1], ...
+        // are not accessed
+        static simd     load_partial(const float* arr, int n);
+
         // gather singe-precision (32-bit) floating-point elements from memory using 
         // 32-bit indices, i.e. i-th element of resulting vector is arr[ind[i]]
         static simd     gather(const float* arr, const simd_int32& ind);
@@ -139,6 +144,10 @@ class alignas(16) simd<float, 128, sse_tag>
         void            store(float* arr, std::true_type aligned) const;
         void            store(float* arr, std::false_type not_aligned = std::false_type()) const;
 
+        // store first n elements in arr; 0 <= n <= vector_size; arr[n], arr[n+1],
+        // ... are not accessed
+        void            store_partial(float* arr, int n) const;
+
         //store elements with in array with stepping (Step = 1,-1 is not optimized)
         template<int Step>
         void            scatter(float* arr) const;
@@ -216,6 +216,124 @@ template<class Val, int Bits, class Simd_tag>
 bool
 any_nan(const simd_compl<Val, Bits, Simd_tag>& x);
 
+//-----------------------------------------------------------------------
+//                   MULTIPLICATION AND DIVISION POLICIES
+//-----------------------------------------------------------------------
+// policy of complex multiplication and division selected at compile time
+// by the first template argument of the functions mult and div
+
+// strict policy used by operator* and operator/; if the result contains NaN
+// or an overflow is possible, then the result is recomputed according to
+// C99 Annex G, i.e. infinite values are recovered from NaN
+struct compl_strict{};
+
+// fast policy; special values are not recovered and overflow is not checked;
+// division is evaluated as x * conj(y) * (1 / |y|^2), therefore the result
+// is inf or nan if |y|^2 overflows or underflows; for single precision
+// 1 / |y|^2 is computed using approximate reciprocal refined by one Newton
+// step (relative error of few ulp)
+struct compl_fast{};
+
+// vector multiply x * y using the policy Policy (compl_strict or compl_fast)
+template<class Policy, class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag>
+mult(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y);
+
+// vector division x / y using the policy Policy (compl_strict or compl_fast)
+template<class Policy, class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag>
+div(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y);
+
+//-----------------------------------------------------------------------
+//                   simd_compl_split<Val, Bits, Simd_tag> COMPLEX FUNCTIONS
+//-----------------------------------------------------------------------
+// functions defined for vectors of complex numbers stored in planar form;
+// special values (infinities and NaN) are not handled according to C99 
+// Annex G by multiplication and division
+
+// complex conjugate
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+conj(const simd_compl_split<Val, Bits, Simd_tag>& x);
+
+// vector multiply x * y
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator*(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y);
+
+// vector multiply x * y, where x is a real vector, i.e. complex(x_i, 0) * y_i
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator*(const simd<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y);
+
+// vector multiply x * y, where y is a real vector, i.e. x_i * complex(y_i, 0)
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator*(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y);
+
+// vector division x / y; y is scaled by max(|real(y_i)|, |imag(y_i)|) in
+// order to avoid overflow and underflow
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator/(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y);
+
+// vector division x / y, where y is a real vector
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator/(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y);
+
+// vector add x + y
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator+(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y);
+
+// vector subtract x - y
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator-(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y);
+
+// vector unary minus x
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+operator-(const simd_compl_split<Val, Bits, Simd_tag>& x);
+
+// evaluate x * y + z using 4 FMA instructions
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+fma_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y, const simd_compl_split<Val, Bits, Simd_tag>& z);
+
+// evaluate x * y - z using 4 FMA instructions
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+fms_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y, const simd_compl_split<Val, Bits, Simd_tag>& z);
+
+// evaluate -x * y + z using 4 FMA instructions
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+fnma_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y, const simd_compl_split<Val, Bits, Simd_tag>& z);
+
+// evaluate -x * y - z using 4 FMA instructions
+template<class Val, int Bits, class Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>
+fnms_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y, const simd_compl_split<Val, Bits, Simd_tag>& z);
+
+// absolute values of elements, i.e. sqrt(real(x_i)^2 + imag(x_i)^2) 
+// evaluated without undue overflow or underflow; abs(x_i) = inf if real 
+// or imaginary part is infinite
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag>
+abs(const simd_compl_split<Val, Bits, Simd_tag>& x);
+
+// sum of all elements stored in the vector x
+template<class Val, int Bits, class Simd_tag>
+typename simd_compl_split<Val, Bits, Simd_tag>::value_type
+horizontal_sum(const simd_compl_split<Val, Bits, Simd_tag>& x);
+
+// return true if at least element in the vector x is NAN
+template<class Val, int Bits, class Simd_tag>
+bool
+any_nan(const simd_compl_split<Val, Bits, Simd_tag>& x);
+
 // print content of a vector to a stream
 template<class Val, int Bits, class Simd_tag>
 std::ostream& operator<<(std::ostream& os, const simd_compl<Val, Bits, Simd_tag>& x);
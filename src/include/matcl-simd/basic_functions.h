@@ -82,6 +82,23 @@ template<class Val, int Bits, class Simd_tag>
 simd<Val, Bits, Simd_tag> 
 uminus(const simd<Val, Bits, Simd_tag>& x);
 
+// high half of the double width product x * y for all elements, i.e. the high
+// 32 bits of the 64-bit product for int32_t elements and the high 64 bits
+// of the 128-bit product for int64_t elements; elements are treated as
+// signed integers; this function is defined only for int32_t and int64_t
+// element types
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+mulh(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y);
+
+// high half of the double width product x * y for all elements; elements
+// are treated as unsigned integers, i.e. the result is equal to the high half
+// of the product of unsigned integers with the same bit representation as x
+// and y; this function is defined only for int32_t and int64_t element types
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+mulhu(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y);
+
 // alternatively subtract and add elements in x and y
 // i.e. form [x[0] - y[0], x[1] + y[1], x[2] - y[2], x[3] + y[3], ...]
 template<class Val, int Bits, class Simd_tag>
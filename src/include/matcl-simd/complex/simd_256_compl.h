@@ -128,12 +128,21 @@ class alignas(32) simd_compl<double, 256, Simd_tag>
         static simd_compl   load(const simd_double_complex* arr, 
                                 std::false_type not_aligned = std::false_type());
 
+        // construct vector with first n elements copied from arr and remaining
+        // elements set to zero; 0 <= n <= vector_size; arr[n], arr[n+1], ...
+        // are not accessed
+        static simd_compl   load_partial(const simd_double_complex* arr, int n);
+
     public:
         // store elements in arr; arr must have length at least vector_size
         void                store(simd_double_complex* arr, std::true_type aligned) const;
         void                store(simd_double_complex* arr, 
                                 std::false_type not_aligned = std::false_type()) const;
 
+        // store first n elements in arr; 0 <= n <= vector_size; arr[n], arr[n+1],
+        // ... are not accessed
+        void                store_partial(simd_double_complex* arr, int n) const;
+
         // store elements with in array with stepping (Step = 1,-1 is not optimized)
         template<int Step>
         void                scatter(simd_double_complex* arr) const;
@@ -269,12 +278,21 @@ class alignas(32) simd_compl<float, 256, Simd_tag>
         static simd_compl   load(const simd_single_complex* arr, 
                                 std::false_type not_aligned = std::false_type());
 
+        // construct vector with first n elements copied from arr and remaining
+        // elements set to zero; 0 <= n <= vector_size; arr[n], arr[n+1], ...
+        // are not accessed
+        static simd_compl   load_partial(const simd_single_complex* arr, int n);
+
     public:
         // store elements in arr; arr must have length at least vector_size
         void                store(simd_single_complex* arr, std::true_type aligned) const;
         void                store(simd_single_complex* arr, 
                                 std::false_type not_aligned = std::false_type()) const;
 
+        // store first n elements in arr; 0 <= n <= vector_size; arr[n], arr[n+1],
+        // ... are not accessed
+        void                store_partial(simd_single_complex* arr, int n) const;
+
         //store elements with in array with stepping (Step = 1,-1 is not optimized)
         template<int Step>
         void                scatter(simd_single_complex* arr) const;
@@ -0,0 +1,140 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/complex/simd_complex.h"
+#include "matcl-simd/details/helpers.h"
+
+namespace matcl { namespace simd
+{
+
+//-------------------------------------------------------------------
+//                          SPLIT COMPLEX
+//-------------------------------------------------------------------
+
+// vector of complex scalars stored in planar (split) form; real and
+// imaginary parts are stored in separate vectors of type
+// simd<Val, Bits, Simd_tag>, therefore the vector stores twice as many
+// elements as simd_compl<Val, Bits, Simd_tag>; arithmetic operations do not
+// require shuffles and complex multiplication is implemented using FMA
+// instructions only; conversions from and to the interleaved format are
+// performed by load and store functions
+template<class Val, int Bits, class Simd_tag>
+class simd_compl_split
+{
+    public:
+        // type of real and imaginary parts
+        using impl_type     = simd<Val, Bits, Simd_tag>;
+
+        // type of stored elements
+        using value_type    = typename details::complex_type<Val>::type;
+
+        // simd tag
+        using simd_tag      = Simd_tag;
+
+        // number of bits of each of real and imaginary parts
+        static const int
+        number_bits         = Bits;
+
+        // type of real and imaginary part of stored elements
+        using real_type     = Val;
+
+    public:
+        // number of elements in the vector
+        static const int
+        vector_size         = impl_type::vector_size;
+
+    public:
+        // real parts
+        impl_type           re;
+
+        // imaginary parts
+        impl_type           im;
+
+    public:
+        // construct uninitialized vector
+        simd_compl_split() = default;
+
+        // construct vector with all elements equal to complex(re, 0)
+        explicit simd_compl_split(Val re);
+
+        // construct vector with all elements equal to complex(re, im)
+        simd_compl_split(Val re, Val im);
+
+        // construct vector with all elements equal to val
+        explicit simd_compl_split(const value_type& val);
+
+        // construct vector with real parts re and zero imaginary parts
+        explicit simd_compl_split(const impl_type& re);
+
+        // construct vector with real parts re and imaginary parts im
+        simd_compl_split(const impl_type& re, const impl_type& im);
+
+        // copy constructor
+        simd_compl_split(const simd_compl_split& s) = default;
+
+    public:
+        // connstruct vector with all elements set to zero
+        static simd_compl_split zero();
+
+        // construct vector with all elements equal to val
+        static simd_compl_split broadcast(const value_type& val);
+
+        // construct vector with elements copied from the array arr storing
+        // complex numbers in interleaved form; arr must have length at least
+        // vector_size
+        static simd_compl_split load(const value_type* arr, std::true_type aligned);
+        static simd_compl_split load(const value_type* arr,
+                                std::false_type not_aligned = std::false_type());
+
+        // construct vector with real parts copied from arr_re and imaginary
+        // parts copied from arr_im; arrays must have length at least vector_size
+        static simd_compl_split load_split(const Val* arr_re, const Val* arr_im,
+                                std::true_type aligned);
+        static simd_compl_split load_split(const Val* arr_re, const Val* arr_im,
+                                std::false_type not_aligned = std::false_type());
+
+    public:
+        // store elements in the array arr in interleaved form; arr must have
+        // length at least vector_size
+        void                store(value_type* arr, std::true_type aligned) const;
+        void                store(value_type* arr,
+                                std::false_type not_aligned = std::false_type()) const;
+
+        // store real parts in arr_re and imaginary parts in arr_im; arrays
+        // must have length at least vector_size
+        void                store_split(Val* arr_re, Val* arr_im, std::true_type aligned) const;
+        void                store_split(Val* arr_re, Val* arr_im,
+                                std::false_type not_aligned = std::false_type()) const;
+
+        // get i-th element from the vector; pos is 0-based
+        value_type          get(int pos) const;
+
+        // return the first element in the vector; equivalent to get(0)
+        value_type          first() const;
+
+        // set i-th element of the vector; pos is 0-based
+        void                set(int pos, const value_type& val);
+
+    public:
+        // plus assign operator
+        simd_compl_split&   operator+=(const simd_compl_split& x);
+
+        // minus assign operator
+        simd_compl_split&   operator-=(const simd_compl_split& x);
+
+        // multiply assign operator
+        simd_compl_split&   operator*=(const simd_compl_split& x);
+
+        // divide assign operator
+        simd_compl_split&   operator/=(const simd_compl_split& x);
+};
+
+}}
@@ -27,6 +27,15 @@
     #define force_inline inline __attribute__((always_inline))
 #endif
 
+// inline namespace containing instruction set tags; all simd types and 
+// functions depending on them are mangled with this name; translation units
+// compiled with different instruction sets (simd_dispatch_xxx.cpp) must
+// define different names, otherwise the linker could select code compiled
+// for another instruction set from not inlined functions
+#ifndef MATCL_SIMD_ISA_NAMESPACE
+    #define MATCL_SIMD_ISA_NAMESPACE isa_default
+#endif
+
 
 // define MATCL_USE_MATCL_COMPLEX in order to use
 // nondefault complex types; these types must be defined
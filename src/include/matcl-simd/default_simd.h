@@ -26,7 +26,7 @@ struct default_scalar_simd_type
 };
 
 // simd type for storing values of given type with given register size
-// (allowed values for Bits are 128 and 256)
+// (allowed values for Bits are 128, 256, and 512 if AVX-512 is available)
 template<class V, int Bits>
 struct default_simd_bit_size
 {
@@ -34,7 +34,7 @@ struct default_simd_bit_size
 };
 
 // simd type for storing N values of given type
-// (allowed values for N are 1, 2, 4, 8)
+// (allowed values for N are 1, 2, 4, 8, and 16 if AVX-512 is available)
 template<class V, int N>
 struct default_simd_vector_size
 {
@@ -45,6 +45,56 @@ struct simd_mult<int32_t, 256, avx_tag>
     };
 };
 
+template<>
+struct simd_mulhu<int32_t, 256, avx_tag>
+{
+    using simd_type = simd<int32_t, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {        
+        #if MATCL_ARCHITECTURE_HAS_AVX2
+            // (xy0_lo, xy0_hi, xy2_lo, xy2_hi, ...)
+            __m256i prod02  = _mm256_mul_epu32(x.data, y.data);
+
+            // (xy1_lo, xy1_hi, xy3_lo, xy3_hi, ...)
+            __m256i prod13  = _mm256_mul_epu32(_mm256_srli_epi64(x.data, 32), 
+                                               _mm256_srli_epi64(y.data, 32));
+
+            // (xy0_hi, xy1_hi, xy2_hi, xy3_hi, ...)
+            return _mm256_blend_epi32(_mm256_srli_epi64(prod02, 32), prod13, 0xAA);
+        #else
+            return simd_type( mulhu(x.extract_low(), y.extract_low()), 
+                              mulhu(x.extract_high(), y.extract_high()));
+        #endif
+    };
+};
+
+template<>
+struct simd_mulh<int32_t, 256, avx_tag>
+{
+    using simd_type = simd<int32_t, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {        
+        #if MATCL_ARCHITECTURE_HAS_AVX2
+            // (xy0_lo, xy0_hi, xy2_lo, xy2_hi, ...)
+            __m256i prod02  = _mm256_mul_epi32(x.data, y.data);
+
+            // (xy1_lo, xy1_hi, xy3_lo, xy3_hi, ...)
+            __m256i prod13  = _mm256_mul_epi32(_mm256_srli_epi64(x.data, 32), 
+                                               _mm256_srli_epi64(y.data, 32));
+
+            // (xy0_hi, xy1_hi, xy2_hi, xy3_hi, ...)
+            return _mm256_blend_epi32(_mm256_srli_epi64(prod02, 32), prod13, 0xAA);
+        #else
+            return simd_type( mulh(x.extract_low(), y.extract_low()), 
+                              mulh(x.extract_high(), y.extract_high()));
+        #endif
+    };
+};
+
 template<>
 struct simd_plus<int32_t, 256, avx_tag>
 {
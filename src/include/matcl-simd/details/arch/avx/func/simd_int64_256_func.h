@@ -35,7 +35,10 @@ struct simd_mult<int64_t, 256, avx_tag>
     force_inline
     static simd_type eval(const simd_type& x, const simd_type& y)
     {
-        #if MATCL_ARCHITECTURE_HAS_AVX2
+        #if MATCL_ARCHITECTURE_HAS_AVX512F && MATCL_ARCHITECTURE_HAS_AVX512DQ \
+                && MATCL_ARCHITECTURE_HAS_AVX512VL
+            return _mm256_mullo_epi64(x.data, y.data);
+        #elif MATCL_ARCHITECTURE_HAS_AVX2
             // split into 32-bit multiplies
 
             __m256i zero    = _mm256_setzero_si256();
@@ -75,6 +78,72 @@ struct simd_mult<int64_t, 256, avx_tag>
     };
 };
 
+template<>
+struct simd_mulhu<int64_t, 256, avx_tag>
+{
+    using simd_type = simd<int64_t, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        #if MATCL_ARCHITECTURE_HAS_AVX2
+            // instruction does not exist; split into 32-bit multiplies
+            // x = x_H * 2^32 + x_L, y = y_H * 2^32 + y_L
+            __m256i mask_lo = _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+
+            __m256i x_hi    = _mm256_srli_epi64(x.data, 32);
+            __m256i y_hi    = _mm256_srli_epi64(y.data, 32);
+
+            // 64 bit unsigned products
+            __m256i prod_ll = _mm256_mul_epu32(x.data, y.data);
+            __m256i prod_lh = _mm256_mul_epu32(x.data, y_hi);
+            __m256i prod_hl = _mm256_mul_epu32(x_hi, y.data);
+            __m256i prod_hh = _mm256_mul_epu32(x_hi, y_hi);
+
+            // sums cannot overflow: (2^32 - 1)^2 + 2^32 - 1 < 2^64
+            __m256i t       = _mm256_add_epi64(prod_hl, _mm256_srli_epi64(prod_ll, 32));
+            __m256i u       = _mm256_add_epi64(prod_lh, _mm256_and_si256(t, mask_lo));
+
+            // x_H * y_H + t_H + u_H
+            __m256i res     = _mm256_add_epi64(_mm256_srli_epi64(t, 32), 
+                                               _mm256_srli_epi64(u, 32));
+            return _mm256_add_epi64(prod_hh, res);
+        #else
+            return simd_type( mulhu(x.extract_low(), y.extract_low()), 
+                              mulhu(x.extract_high(), y.extract_high()));
+        #endif
+    };
+};
+
+template<>
+struct simd_mulh<int64_t, 256, avx_tag>
+{
+    using simd_type = simd<int64_t, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        #if MATCL_ARCHITECTURE_HAS_AVX2
+            // signed high part is equal to the unsigned high part minus y if
+            // x < 0 and minus x if y < 0
+            __m256i res     = simd_mulhu<int64_t, 256, avx_tag>::eval(x, y).data;
+
+            // sign masks
+            __m256i zero    = _mm256_setzero_si256();
+            __m256i sign_x  = _mm256_cmpgt_epi64(zero, x.data);
+            __m256i sign_y  = _mm256_cmpgt_epi64(zero, y.data);
+
+            __m256i corr_x  = _mm256_and_si256(sign_x, y.data);
+            __m256i corr_y  = _mm256_and_si256(sign_y, x.data);
+
+            return _mm256_sub_epi64(res, _mm256_add_epi64(corr_x, corr_y));
+        #else
+            return simd_type( mulh(x.extract_low(), y.extract_low()), 
+                              mulh(x.extract_high(), y.extract_high()));
+        #endif
+    };
+};
+
 template<>
 struct simd_plus<int64_t, 256, avx_tag>
 {
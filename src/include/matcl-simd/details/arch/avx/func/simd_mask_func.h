@@ -0,0 +1,68 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_mask_def.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                  CONVERSIONS
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_from_vector<double, 256, avx_tag>
+{
+    using simd_type = simd<double, 256, avx_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm256_movemask_pd(x.data);
+    };
+};
+
+template<>
+struct simd_mask_from_vector<float, 256, avx_tag>
+{
+    using simd_type = simd<float, 256, avx_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm256_movemask_ps(x.data);
+    };
+};
+
+template<>
+struct simd_mask_from_vector<int32_t, 256, avx_tag>
+{
+    using simd_type = simd<int32_t, 256, avx_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(x.data));
+    };
+};
+
+template<>
+struct simd_mask_from_vector<int64_t, 256, avx_tag>
+{
+    using simd_type = simd<int64_t, 256, avx_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(x.data));
+    };
+};
+
+}}}
@@ -48,7 +48,7 @@ struct simd_compl_mult<double, 256, avx_tag>
 
     // (x.re * y.re - x.im * y.im,  x.re * y.im + x.re * y.im)
     force_inline
-    static simd_type eval(const simd_type& x, const simd_type& y)
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
     {
         __m256d y_flip = _mm256_shuffle_pd(y.data.data, y.data.data, 5);    // swap y.re and y.im
         __m256d x_im   = _mm256_shuffle_pd(x.data.data, x.data.data, 0xF);  // imag of x in both
@@ -64,6 +64,15 @@ struct simd_compl_mult<double, 256, avx_tag>
             __m256d res = sub_add(xv_rey, xv_imy).data;                     // a_re * y -/+ x_imy
         #endif
 
+        return simd_type(res);
+    };
+
+    // strict multiplication; NaN results are recovered according to C99 Annex G
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m256d res     = eval_fast(x, y).data.data;
+
         // check for NaN
         __m256d nt      = _mm256_cmp_pd(res, res, _CMP_NEQ_UQ);
         int have_nan    = _mm256_movemask_pd(nt);
@@ -152,6 +161,33 @@ struct simd_compl_div<double, 256, avx_tag>
             return simd_type(res);
     };
 
+    // fast division: x * conj(y) / |y|^2 without overflow checks and NaN
+    // recovery
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        __m256d y_flip = _mm256_shuffle_pd(y.data.data, y.data.data, 5);    // swap y.re and y.im
+        __m256d x_im   = _mm256_shuffle_pd(x.data.data, x.data.data, 0xF);  // imag of x in both
+        __m256d x_re   = _mm256_shuffle_pd(x.data.data, x.data.data, 0);    // real of x in both
+
+        __m256d x_rey  = _mm256_mul_pd(x_re, y.data.data);                  // (x.re*b.re, x.re*b.im)  
+        __m256d yy     = _mm256_mul_pd(y.data.data, y.data.data);           // (y.re*y.re, y.im*y.im)
+        __m256d yy2    = _mm256_hadd_pd(yy,yy);                             // (y.re*y.re + y.im*y.im)
+
+        #if MATCL_ARCHITECTURE_HAS_FMA
+            __m256d n      = _mm256_fmsubadd_pd(x_im, y_flip, x_rey);       // x_re * y +/- x_imy
+        #else
+            __m256d x_imy   = _mm256_mul_pd(x_im, y_flip);                  // (x_im * y_im, x_im * y_re)
+            simd_real xv_imy(x_imy);
+            simd_real xv_rey(x_rey);
+            __m256d n       = sub_add(xv_imy, -xv_rey).data;                // x_re * y +/- x_imy
+        #endif
+        
+        __m256d res     = _mm256_div_pd(n, yy2);
+
+        return simd_type(res);
+    };
+
     // (a * b.re, - a * b.im) / (b.re * b.re + b.im * b.im)
     force_inline
     static simd_type eval_rc(const simd_real& x, const simd_type& y)
@@ -299,4 +335,33 @@ struct simd_compl_horizontal_sum<double, 256, avx_tag>
     };
 };
 
+template<>
+struct simd_compl_split_shuffle<double, 256, avx_tag>
+{
+    using simd_type         = simd<double, 256, avx_tag>;
+
+    // a = [r0, i0, r1, i1], b = [r2, i2, r3, i3]
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        __m256d t0  = _mm256_permute2f128_pd(a.data, b.data, 0x20);    // [r0, i0, r2, i2]
+        __m256d t1  = _mm256_permute2f128_pd(a.data, b.data, 0x31);    // [r1, i1, r3, i3]
+
+        re          = _mm256_unpacklo_pd(t0, t1);
+        im          = _mm256_unpackhi_pd(t0, t1);
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        __m256d t0  = _mm256_unpacklo_pd(re.data, im.data);            // [r0, i0, r2, i2]
+        __m256d t1  = _mm256_unpackhi_pd(re.data, im.data);            // [r1, i1, r3, i3]
+
+        a           = _mm256_permute2f128_pd(t0, t1, 0x20);
+        b           = _mm256_permute2f128_pd(t0, t1, 0x31);
+    };
+};
+
 }}}
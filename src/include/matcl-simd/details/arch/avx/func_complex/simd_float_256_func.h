@@ -56,7 +56,7 @@ struct simd_compl_mult<float, 256, avx_tag>
 
     // (x.re * y.re - x.im * y.im,  x.re * y.im + x.re * y.im)
     force_inline
-    static simd_type eval(const simd_type& x, const simd_type& y)
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
     {
         __m256 y_flip = _mm256_shuffle_ps(y.data.data, y.data.data, 0xB1);  // swap y.re and y.im
         __m256 x_im   = _mm256_shuffle_ps(x.data.data, x.data.data, 0xF5);  // imag of x in both
@@ -72,6 +72,15 @@ struct simd_compl_mult<float, 256, avx_tag>
             __m256 res = sub_add(xv_rey, xv_imy).data;                      // a_re * y +/- x_imy
         #endif
 
+        return simd_type(res);
+    };
+
+    // strict multiplication; NaN results are recovered according to C99 Annex G
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m256 res      = eval_fast(x, y).data.data;
+
         // check for NaN
         __m256 nt       = _mm256_cmp_ps(res, res, _CMP_NEQ_UQ);
         int have_nan    = _mm256_movemask_ps(nt);
@@ -161,6 +170,39 @@ struct simd_compl_div<float, 256, avx_tag>
             return simd_type(res);
     };
 
+    // fast division: x * conj(y) / |y|^2 without overflow checks and NaN
+    // recovery
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        __m256 y_flip = _mm256_shuffle_ps(y.data.data, y.data.data, 0xB1);  // swap y.re and y.im
+        __m256 x_im   = _mm256_shuffle_ps(x.data.data, x.data.data, 0xF5);  // imag of x in both
+        __m256 x_re   = _mm256_shuffle_ps(x.data.data, x.data.data, 0xA0);  // real of x in both
+        __m256 x_rey  = _mm256_mul_ps(x_re, y.data.data);                   // (x.re*b.re, x.re*b.im)  
+        __m256 yy     = _mm256_mul_ps(y.data.data, y.data.data);            // (y.re*y.re, y.im*y.im)
+
+        __m256 yy2    = _mm256_shuffle_ps(yy,yy,0xB1);                      // Swap yy.re and yy.im
+        __m256 yy3    = _mm256_add_ps(yy,yy2);                              // (y.re*y.re + y.im*y.im) dublicated
+
+        #if MATCL_ARCHITECTURE_HAS_FMA
+            __m256 n      = _mm256_fmsubadd_ps(x_im, y_flip, x_rey);        // x_re * y +/- x_imy
+        #else
+            __m256 x_imy    = _mm256_mul_ps(x_im, y_flip);                  // (x_im * y_im, x_im * y_re)
+            simd_real xv_imy(x_imy);
+            simd_real xv_rey(x_rey);
+            __m256 n        = sub_add(xv_imy, -xv_rey).data;                // x_re * y +/- x_imy
+        #endif       
+
+        // reciprocal of |y|^2 refined by one Newton step
+        __m256 r        = _mm256_rcp_ps(yy3);
+        __m256 two      = _mm256_set1_ps(2.0f);
+        r               = _mm256_mul_ps(r, _mm256_sub_ps(two, _mm256_mul_ps(yy3, r)));
+
+        __m256 res      = _mm256_mul_ps(n, r);
+
+        return simd_type(res);
+    };
+
     // (a * b.re, - a * b.im) / (b.re * b.re + b.im * b.im)
     force_inline
     static simd_type eval_rc(const simd_real& x, const simd_type& y)
@@ -315,4 +357,35 @@ struct simd_compl_horizontal_sum<float, 256, avx_tag>
     };
 };
 
+template<>
+struct simd_compl_split_shuffle<float, 256, avx_tag>
+{
+    using simd_type         = simd<float, 256, avx_tag>;
+
+    // a = [r0, i0, ..., r3, i3], b = [r4, i4, ..., r7, i7]
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        // [r0, i0, r1, i1, r4, i4, r5, i5], [r2, i2, r3, i3, r6, i6, r7, i7]
+        __m256 t0   = _mm256_permute2f128_ps(a.data, b.data, 0x20);
+        __m256 t1   = _mm256_permute2f128_ps(a.data, b.data, 0x31);
+
+        re          = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        im          = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        // [r0, i0, r1, i1, r4, i4, r5, i5], [r2, i2, r3, i3, r6, i6, r7, i7]
+        __m256 t0   = _mm256_unpacklo_ps(re.data, im.data);
+        __m256 t1   = _mm256_unpackhi_ps(re.data, im.data);
+
+        a           = _mm256_permute2f128_ps(t0, t1, 0x20);
+        b           = _mm256_permute2f128_ps(t0, t1, 0x31);
+    };
+};
+
 }}}
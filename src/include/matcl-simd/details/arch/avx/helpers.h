@@ -28,4 +28,21 @@ static force_inline __m256i vector_8_int()
     return val.ymm;
 };
 
+// return mask for maskload and maskstore instructions selecting first n 
+// 64-bit elements, 0 <= n <= 4
+static force_inline __m256i avx_partial_mask_epi64(int n)
+{
+    alignas(64) static const int64_t mask[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+    return _mm256_loadu_si256((const __m256i*)(mask + 4 - n));
+};
+
+// return mask for maskload and maskstore instructions selecting first n 
+// 32-bit elements, 0 <= n <= 8
+static force_inline __m256i avx_partial_mask_epi32(int n)
+{
+    alignas(64) static const int32_t mask[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 
+                                                   0,  0,  0,  0,  0,  0,  0,  0};
+    return _mm256_loadu_si256((const __m256i*)(mask + 8 - n));
+};
+
 }}}
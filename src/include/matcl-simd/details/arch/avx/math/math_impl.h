@@ -92,4 +92,57 @@ struct simd_fraction<Val, 256, avx_tag>
     };
 };
 
+//-----------------------------------------------------------------------
+//                          rcp/rsqrt
+//-----------------------------------------------------------------------
+template<>
+struct simd_rcp_approx<float, 256, avx_tag>
+{
+    using simd_type     = simd<float, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm256_rcp_ps(x.data);
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<float, 256, avx_tag>
+{
+    using simd_type     = simd<float, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm256_rsqrt_ps(x.data);
+    };
+};
+
+// relative error of rcp_approx and rsqrt_approx is at most 1.5 * 2^-12;
+// one Newton step is sufficient
+template<>
+struct simd_rcp<float, 256, avx_tag>
+{
+    using simd_type     = simd<float, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, 256, avx_tag>::eval_rcp<1>(x);
+    };
+};
+
+template<>
+struct simd_rsqrt<float, 256, avx_tag>
+{
+    using simd_type     = simd<float, 256, avx_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, 256, avx_tag>::eval_rsqrt<1>(x);
+    };
+};
+
 }}}
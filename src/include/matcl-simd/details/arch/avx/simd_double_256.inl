@@ -9,6 +9,7 @@
 #pragma once
 
 #include "matcl-simd/arch/avx/simd_double_256.h"
+#include "matcl-simd/details/arch/avx/helpers.h"
 
 #pragma warning(push)
 #pragma warning(disable : 4127) // conditional expression is constant
@@ -208,6 +209,12 @@ simd<double, 256, avx_tag>::load(const double* arr, std::false_type not_aligned)
     return _mm256_loadu_pd(arr);
 };
 
+force_inline simd<double, 256, avx_tag> 
+simd<double, 256, avx_tag>::load_partial(const double* arr, int n)
+{
+    return _mm256_maskload_pd(arr, details::avx_partial_mask_epi64(n));
+};
+
 force_inline simd<double, 256, avx_tag> 
 simd<double, 256, avx_tag>::gather(const double* arr, const simd_int32_half& ind)
 {
@@ -274,6 +281,12 @@ simd<double, 256, avx_tag>::store(double* arr, std::false_type not_aligned) cons
     _mm256_storeu_pd(arr, data);
 };
 
+force_inline void 
+simd<double, 256, avx_tag>::store_partial(double* arr, int n) const
+{
+    _mm256_maskstore_pd(arr, details::avx_partial_mask_epi64(n), data);
+};
+
 force_inline void 
 simd<double, 256, avx_tag>::stream(double* arr, std::true_type aligned) const
 {
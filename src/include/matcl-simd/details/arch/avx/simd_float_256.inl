@@ -221,6 +221,12 @@ simd<float, 256, avx_tag>::load(const float* arr, std::false_type not_aligned)
     return _mm256_loadu_ps(arr);
 };
 
+force_inline simd<float, 256, avx_tag> 
+simd<float, 256, avx_tag>::load_partial(const float* arr, int n)
+{
+    return _mm256_maskload_ps(arr, details::avx_partial_mask_epi32(n));
+};
+
 force_inline simd<float, 256, avx_tag> 
 simd<float, 256, avx_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -279,6 +285,11 @@ force_inline void simd<float, 256, avx_tag>::store(float* arr, std::false_type n
     _mm256_storeu_ps(arr, data);
 };
 
+force_inline void simd<float, 256, avx_tag>::store_partial(float* arr, int n) const
+{
+    _mm256_maskstore_ps(arr, details::avx_partial_mask_epi32(n), data);
+};
+
 force_inline simd<double, 256, avx_tag>
 simd<float, 256, avx_tag>::convert_low_to_double() const
 {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "matcl-simd/arch/avx/simd_int32_256.h"
+#include "matcl-simd/details/arch/avx/helpers.h"
 
 namespace matcl { namespace simd
 {
@@ -152,6 +153,13 @@ simd<int32_t, 256, avx_tag>::load(const int32_t* arr, std::false_type not_aligne
     return _mm256_loadu_si256((const __m256i*)arr);
 };
 
+force_inline simd<int32_t, 256, avx_tag> 
+simd<int32_t, 256, avx_tag>::load_partial(const int32_t* arr, int n)
+{
+    __m256 ret  = _mm256_maskload_ps((const float*)arr, details::avx_partial_mask_epi32(n));
+    return _mm256_castps_si256(ret);
+};
+
 force_inline simd<int32_t, 256, avx_tag> 
 simd<int32_t, 256, avx_tag>::gather(const int32_t* arr, const simd_int32& ind)
 {
@@ -212,6 +220,11 @@ force_inline void simd<int32_t, 256, avx_tag>::store(int32_t* arr, std::false_ty
     _mm256_storeu_si256((__m256i*)arr, data);
 };
 
+force_inline void simd<int32_t, 256, avx_tag>::store_partial(int32_t* arr, int n) const
+{
+    _mm256_maskstore_ps((float*)arr, details::avx_partial_mask_epi32(n), _mm256_castsi256_ps(data));
+};
+
 force_inline simd<int64_t, 256, avx_tag>
 simd<int32_t, 256, avx_tag>::convert_low_to_int64() const
 {
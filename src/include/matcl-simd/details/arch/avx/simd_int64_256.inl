@@ -9,6 +9,7 @@
 #pragma once
 
 #include "matcl-simd/arch/avx/simd_int64_256.h"
+#include "matcl-simd/details/arch/avx/helpers.h"
 
 namespace matcl { namespace simd
 {
@@ -156,6 +157,13 @@ simd<int64_t, 256, avx_tag>::load(const int64_t* arr, std::false_type not_aligne
     return _mm256_loadu_si256((const __m256i*)arr);
 };
 
+force_inline simd<int64_t, 256, avx_tag> 
+simd<int64_t, 256, avx_tag>::load_partial(const int64_t* arr, int n)
+{
+    __m256d ret = _mm256_maskload_pd((const double*)arr, details::avx_partial_mask_epi64(n));
+    return _mm256_castpd_si256(ret);
+};
+
 force_inline simd<int64_t, 256, avx_tag> 
 simd<int64_t, 256, avx_tag>::gather(const int64_t* arr, const simd_int32_half& ind)
 {
@@ -224,6 +232,12 @@ simd<int64_t, 256, avx_tag>::store(int64_t* arr, std::false_type not_aligned) co
     _mm256_storeu_si256((__m256i*)arr, data);
 };
 
+force_inline void 
+simd<int64_t, 256, avx_tag>::store_partial(int64_t* arr, int n) const
+{
+    _mm256_maskstore_pd((double*)arr, details::avx_partial_mask_epi64(n), _mm256_castsi256_pd(data));
+};
+
 force_inline simd<int32_t, 128, sse_tag> 
 simd<int64_t, 256, avx_tag>::convert_to_int32() const
 {
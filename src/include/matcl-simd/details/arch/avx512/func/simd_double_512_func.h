@@ -0,0 +1,626 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_func_def.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+template<>
+struct simd_reverse<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        static const __m512i control = vector_8_int64<7, 6, 5, 4, 3, 2, 1, 0>();
+        return _mm512_permutexvar_pd(control, x.data);
+    };
+};
+
+template<>
+struct simd_mult<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mul_pd( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_div<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_div_pd( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_plus<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_add_pd( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_minus<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_sub_pd( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_uminus<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        const simd_type mzero = simd_type::minus_zero();
+        return bitwise_xor(x, mzero);
+    };
+};
+
+template<>
+struct simd_horizontal_sum<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static double eval(const simd_type& x)
+    {
+        double s    = horizontal_sum(x.extract_low() + x.extract_high());
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_min<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static double eval(const simd_type& x)
+    {
+        double s    = horizontal_min(min(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_max<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static double eval(const simd_type& x)
+    {
+        double s    = horizontal_max(max(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_sub_add<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // subtract elements with even index, add elements with odd index
+        __m512d s       = _mm512_add_pd(x.data, y.data);
+        return _mm512_mask_sub_pd(s, 0x55, x.data, y.data);
+    };
+};
+
+template<>
+struct simd_fma_f<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmadd_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fms_f<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmsub_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnma_f<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmadd_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnms_f<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmsub_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fma_a<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmadd_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fms_a<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmsub_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnma_a<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmadd_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnms_a<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmsub_pd( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_abs<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_abs_pd(x.data);
+    };
+};
+
+template<>
+struct simd_bitwise_or<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // pd variants of bitwise instructions require AVX512DQ
+        __m512i xi      = _mm512_castpd_si512(x.data);
+        __m512i yi      = _mm512_castpd_si512(y.data);
+        return _mm512_castsi512_pd(_mm512_or_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_xor<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m512i xi      = _mm512_castpd_si512(x.data);
+        __m512i yi      = _mm512_castpd_si512(y.data);
+        return _mm512_castsi512_pd(_mm512_xor_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_and<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m512i xi      = _mm512_castpd_si512(x.data);
+        __m512i yi      = _mm512_castpd_si512(y.data);
+        return _mm512_castsi512_pd(_mm512_and_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_andnot<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m512i xi      = _mm512_castpd_si512(x.data);
+        __m512i yi      = _mm512_castpd_si512(y.data);
+        return _mm512_castsi512_pd(_mm512_andnot_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_not<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return bitwise_not(x.reinterpret_as_int64()).reinterpret_as_double();
+    };
+};
+
+template<>
+struct simd_shift_left<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        // cast to integer
+        __m512i val_i   = _mm512_castpd_si512(x.data);
+
+        // shift packed 64-bit integers
+        __m512i res_i   = _mm512_slli_epi64(val_i, y);
+
+        //cast to double
+        return _mm512_castsi512_pd(res_i);
+    };
+};
+
+template<>
+struct simd_shift_right<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        // cast to integer
+        __m512i val_i   = _mm512_castpd_si512(x.data);
+
+        // shift packed 64-bit integers
+        __m512i res_i   = _mm512_srli_epi64(val_i, y);
+
+        //cast to double
+        return _mm512_castsi512_pd(res_i);
+    };
+};
+
+template<>
+struct simd_shift_right_arithmetic<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return shift_right_arithmetic(x.reinterpret_as_int64(), y).reinterpret_as_double();
+    };
+};
+
+template<>
+struct simd_max<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_max_pd(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_min<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_min_pd(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_sqrt<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_sqrt_pd(x.data);
+    };
+};
+
+template<>
+struct simd_round<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_pd(x.data, _MM_FROUND_TO_NEAREST_INT);
+    };
+};
+
+template<>
+struct simd_floor<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_pd(x.data, _MM_FROUND_TO_NEG_INF);
+    };
+};
+
+template<>
+struct simd_ceil<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_pd(x.data, _MM_FROUND_TO_POS_INF);
+    };
+};
+
+template<>
+struct simd_trunc<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_pd(x.data, _MM_FROUND_TO_ZERO);
+    };
+};
+
+template<>
+struct simd_eeq<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, y.data, _CMP_EQ_OQ);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_neq<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, y.data, _CMP_NEQ_UQ);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_lt<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, y.data, _CMP_LT_OQ);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_gt<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, y.data, _CMP_GT_OQ);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_leq<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, y.data, _CMP_LE_OQ);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_geq<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, y.data, _CMP_GE_OQ);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_any_nan<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, x.data, _CMP_UNORD_Q);
+        return mask != 0;
+    };
+};
+
+template<>
+struct simd_is_nan<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        __mmask8 mask   = _mm512_cmp_pd_mask(x.data, x.data, _CMP_UNORD_Q);
+        return _mm512_castsi512_pd(mask_to_vector_64(mask));
+    };
+};
+
+template<>
+struct simd_is_finite<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        using simd_int  = simd<int64_t, 512, avx512_tag>;
+
+        simd_int xi     = x.reinterpret_as_int64();
+
+        // mask selecting all bits in the exponent
+        simd_int mask   = simd_int(0x7FF0000000000000ll);
+
+        xi              = bitwise_and(xi, mask);
+
+        // return true if at least one bit in the exponent is not set
+        simd_int res    = neq(xi, mask);
+        return res.reinterpret_as_double();
+    };
+};
+
+template<>
+struct simd_any<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask8 mask   = vector_to_mask_64(_mm512_castpd_si512(x.data));
+        return mask != 0;
+    };
+};
+
+template<>
+struct simd_all<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask8 mask   = vector_to_mask_64(_mm512_castpd_si512(x.data));
+        return mask == 0xFF;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+template<>
+struct simd_if_then_else<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& test, const simd_type& val_true,
+                          const simd_type& val_false)
+    {
+        __mmask8 mask   = vector_to_mask_64(_mm512_castpd_si512(test.data));
+        return _mm512_mask_blend_pd(mask, val_false.data, val_true.data);
+    };
+};
+
+}}}
@@ -0,0 +1,627 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_func_def.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+template<>
+struct simd_reverse<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        static const __m512i control = vector_16_int<15, 14, 13, 12, 11, 10, 9, 8,
+                                                     7, 6, 5, 4, 3, 2, 1, 0>();
+        return _mm512_permutexvar_ps(control, x.data);
+    };
+};
+
+template<>
+struct simd_mult<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mul_ps( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_div<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_div_ps( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_plus<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_add_ps( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_minus<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_sub_ps( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_uminus<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        const simd_type mzero = simd_type::minus_zero();
+        return bitwise_xor(x, mzero);
+    };
+};
+
+template<>
+struct simd_horizontal_sum<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static float eval(const simd_type& x)
+    {
+        float s     = horizontal_sum(x.extract_low() + x.extract_high());
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_min<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static float eval(const simd_type& x)
+    {
+        float s     = horizontal_min(min(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_max<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static float eval(const simd_type& x)
+    {
+        float s     = horizontal_max(max(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_sub_add<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // subtract elements with even index, add elements with odd index
+        __m512 s        = _mm512_add_ps(x.data, y.data);
+        return _mm512_mask_sub_ps(s, 0x5555, x.data, y.data);
+    };
+};
+
+template<>
+struct simd_fma_f<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmadd_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fms_f<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmsub_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnma_f<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmadd_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnms_f<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmsub_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fma_a<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmadd_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fms_a<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fmsub_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnma_a<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmadd_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_fnms_a<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y, const simd_type& z)
+    {
+        return _mm512_fnmsub_ps( x.data, y.data, z.data);
+    };
+};
+
+template<>
+struct simd_abs<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_abs_ps(x.data);
+    };
+};
+
+template<>
+struct simd_bitwise_or<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // ps variants of bitwise instructions require AVX512DQ
+        __m512i xi      = _mm512_castps_si512(x.data);
+        __m512i yi      = _mm512_castps_si512(y.data);
+        return _mm512_castsi512_ps(_mm512_or_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_xor<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m512i xi      = _mm512_castps_si512(x.data);
+        __m512i yi      = _mm512_castps_si512(y.data);
+        return _mm512_castsi512_ps(_mm512_xor_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_and<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m512i xi      = _mm512_castps_si512(x.data);
+        __m512i yi      = _mm512_castps_si512(y.data);
+        return _mm512_castsi512_ps(_mm512_and_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_andnot<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m512i xi      = _mm512_castps_si512(x.data);
+        __m512i yi      = _mm512_castps_si512(y.data);
+        return _mm512_castsi512_ps(_mm512_andnot_si512(xi, yi));
+    };
+};
+
+template<>
+struct simd_bitwise_not<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return bitwise_not(x.reinterpret_as_int32()).reinterpret_as_float();
+    };
+};
+
+template<>
+struct simd_shift_left<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        // cast to integer
+        __m512i val_i   = _mm512_castps_si512(x.data);
+
+        // shift packed 32-bit integers
+        __m512i res_i   = _mm512_slli_epi32(val_i, y);
+
+        //cast to float
+        return _mm512_castsi512_ps(res_i);
+    };
+};
+
+template<>
+struct simd_shift_right<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        // cast to integer
+        __m512i val_i   = _mm512_castps_si512(x.data);
+
+        // shift packed 32-bit integers
+        __m512i res_i   = _mm512_srli_epi32(val_i, y);
+
+        //cast to float
+        return _mm512_castsi512_ps(res_i);
+    };
+};
+
+template<>
+struct simd_shift_right_arithmetic<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return shift_right_arithmetic(x.reinterpret_as_int32(), y).reinterpret_as_float();
+    };
+};
+
+template<>
+struct simd_max<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_max_ps(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_min<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_min_ps(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_sqrt<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_sqrt_ps(x.data);
+    };
+};
+
+template<>
+struct simd_round<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_ps(x.data, _MM_FROUND_TO_NEAREST_INT);
+    };
+};
+
+template<>
+struct simd_floor<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_ps(x.data, _MM_FROUND_TO_NEG_INF);
+    };
+};
+
+template<>
+struct simd_ceil<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_ps(x.data, _MM_FROUND_TO_POS_INF);
+    };
+};
+
+template<>
+struct simd_trunc<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_roundscale_ps(x.data, _MM_FROUND_TO_ZERO);
+    };
+};
+
+template<>
+struct simd_eeq<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, y.data, _CMP_EQ_OQ);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_neq<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, y.data, _CMP_NEQ_UQ);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_lt<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, y.data, _CMP_LT_OQ);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_gt<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, y.data, _CMP_GT_OQ);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_leq<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, y.data, _CMP_LE_OQ);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_geq<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, y.data, _CMP_GE_OQ);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_any_nan<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, x.data, _CMP_UNORD_Q);
+        return mask != 0;
+    };
+};
+
+template<>
+struct simd_is_nan<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        __mmask16 mask  = _mm512_cmp_ps_mask(x.data, x.data, _CMP_UNORD_Q);
+        return _mm512_castsi512_ps(mask_to_vector_32(mask));
+    };
+};
+
+template<>
+struct simd_is_finite<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        using simd_int  = simd<int32_t, 512, avx512_tag>;
+
+        simd_int xi     = x.reinterpret_as_int32();
+
+        // mask selecting all bits in the exponent
+        simd_int mask   = simd_int(0x7F800000);
+
+        xi              = bitwise_and(xi, mask);
+
+        // return true if at least one bit in the exponent is not set
+        simd_int res    = neq(xi, mask);
+        return res.reinterpret_as_float();
+    };
+};
+
+template<>
+struct simd_any<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask16 mask  = vector_to_mask_32(_mm512_castps_si512(x.data));
+        return mask != 0;
+    };
+};
+
+template<>
+struct simd_all<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask16 mask  = vector_to_mask_32(_mm512_castps_si512(x.data));
+        return mask == 0xFFFF;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+template<>
+struct simd_if_then_else<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& test, const simd_type& val_true,
+                          const simd_type& val_false)
+    {
+        __mmask16 mask  = vector_to_mask_32(_mm512_castps_si512(test.data));
+        return _mm512_mask_blend_ps(mask, val_false.data, val_true.data);
+    };
+};
+
+}}}
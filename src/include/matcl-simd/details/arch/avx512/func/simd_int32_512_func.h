@@ -0,0 +1,461 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_func_def.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+template<>
+struct simd_reverse<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        static const __m512i control = vector_16_int<15, 14, 13, 12, 11, 10, 9, 8,
+                                                     7, 6, 5, 4, 3, 2, 1, 0>();
+        return _mm512_permutexvar_epi32(control, x.data);
+    };
+};
+
+template<>
+struct simd_mult<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mullo_epi32(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_mulhu<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // (xy0_lo, xy0_hi, xy2_lo, xy2_hi, ...)
+        __m512i prod02  = _mm512_mul_epu32(x.data, y.data);
+
+        // (xy1_lo, xy1_hi, xy3_lo, xy3_hi, ...)
+        __m512i prod13  = _mm512_mul_epu32(_mm512_srli_epi64(x.data, 32), 
+                                           _mm512_srli_epi64(y.data, 32));
+
+        // (xy0_hi, xy1_hi, xy2_hi, xy3_hi, ...)
+        return _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(prod02, 32), prod13);
+    };
+};
+
+template<>
+struct simd_mulh<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // (xy0_lo, xy0_hi, xy2_lo, xy2_hi, ...)
+        __m512i prod02  = _mm512_mul_epi32(x.data, y.data);
+
+        // (xy1_lo, xy1_hi, xy3_lo, xy3_hi, ...)
+        __m512i prod13  = _mm512_mul_epi32(_mm512_srli_epi64(x.data, 32), 
+                                           _mm512_srli_epi64(y.data, 32));
+
+        // (xy0_hi, xy1_hi, xy2_hi, xy3_hi, ...)
+        return _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(prod02, 32), prod13);
+    };
+};
+
+template<>
+struct simd_plus<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_add_epi32( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_minus<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_sub_epi32( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_uminus<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_sub_epi32(_mm512_setzero_si512(), x.data);
+    };
+};
+
+template<>
+struct simd_abs<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_abs_epi32(x.data);
+    };
+};
+
+template<>
+struct simd_horizontal_sum<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static int32_t eval(const simd_type& x)
+    {
+        int32_t s    = horizontal_sum(x.extract_low() + x.extract_high());
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_min<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static int32_t eval(const simd_type& x)
+    {
+        int32_t s    = horizontal_min(min(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_max<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static int32_t eval(const simd_type& x)
+    {
+        int32_t s    = horizontal_max(max(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_bitwise_or<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_or_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_xor<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_xor_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_and<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_and_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_andnot<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_andnot_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_not<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        // ternary logic function 0x55 computes ~x
+        return _mm512_ternarylogic_epi32(x.data, x.data, x.data, 0x55);
+    };
+};
+
+template<>
+struct simd_shift_left<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return _mm512_slli_epi32(x.data, y);
+    };
+};
+
+template<>
+struct simd_shift_right<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return _mm512_srli_epi32(x.data, y);
+    };
+};
+
+template<>
+struct simd_shift_right_arithmetic<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return _mm512_srai_epi32(x.data, y);
+    };
+};
+
+template<>
+struct simd_round<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_floor<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_ceil<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_trunc<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_eeq<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmpeq_epi32_mask(x.data, y.data);
+        return mask_to_vector_32(mask);
+    };
+};
+
+template<>
+struct simd_gt<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmpgt_epi32_mask(x.data, y.data);
+        return mask_to_vector_32(mask);
+    };
+};
+
+template<>
+struct simd_neq<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmpneq_epi32_mask(x.data, y.data);
+        return mask_to_vector_32(mask);
+    };
+};
+
+template<>
+struct simd_lt<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmplt_epi32_mask(x.data, y.data);
+        return mask_to_vector_32(mask);
+    };
+};
+
+template<>
+struct simd_leq<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmple_epi32_mask(x.data, y.data);
+        return mask_to_vector_32(mask);
+    };
+};
+
+template<>
+struct simd_geq<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask16 mask  = _mm512_cmpge_epi32_mask(x.data, y.data);
+        return mask_to_vector_32(mask);
+    };
+};
+
+template<>
+struct simd_max<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_max_epi32(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_min<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_min_epi32(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_any<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask16 mask  = vector_to_mask_32(x.data);
+        return mask != 0;
+    };
+};
+
+template<>
+struct simd_all<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask16 mask  = vector_to_mask_32(x.data);
+        return mask == 0xFFFF;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+template<>
+struct simd_if_then_else<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& test, const simd_type& val_true,
+                          const simd_type& val_false)
+    {
+        __mmask16 mask  = vector_to_mask_32(test.data);
+        return _mm512_mask_blend_epi32(mask, val_false.data, val_true.data);
+    };
+};
+
+}}}
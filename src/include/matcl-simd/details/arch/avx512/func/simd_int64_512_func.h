@@ -0,0 +1,494 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_func_def.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+template<>
+struct simd_reverse<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        static const __m512i control = vector_8_int64<7, 6, 5, 4, 3, 2, 1, 0>();
+        return _mm512_permutexvar_epi64(control, x.data);
+    };
+};
+
+template<>
+struct simd_mult<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        #if MATCL_ARCHITECTURE_HAS_AVX512DQ
+            return _mm512_mullo_epi64(x.data, y.data);
+        #else
+            // split into 32-bit multiplies
+
+            // swap Hi and Lo: (y0_H, y0_L, y1_H, y1_L, ...)
+            __m512i y_swap  = _mm512_shuffle_epi32(y.data, _MM_PERM_CDAB);
+
+            // 32 bit L*H products: (x0_L * y0_H, x0_H * y0_L, x1_L * y1_H, x1_H * y1_L, ...)
+            __m512i prod_lh = _mm512_mullo_epi32(x.data, y_swap);
+
+            // (x0_L * y0_H + x0_H * y0_L, ...) in the low half of each 64-bit element
+            __m512i prod_lh2 = _mm512_add_epi64(prod_lh, _mm512_srli_epi64(prod_lh, 32));
+
+            // move the sum to the high half of each 64-bit element
+            __m512i prod_lh3 = _mm512_slli_epi64(prod_lh2, 32);
+
+            // 64 bit unsigned products: (x0_L * y0_L, x1_L * y1_L, ...)
+            __m512i prod_ll = _mm512_mul_epu32(x.data, y.data);
+
+            // x0_L * y0_L + (x0_L * y0_H + x0_H * y0_L) << 32, ...
+            __m512i prod    = _mm512_add_epi64(prod_ll, prod_lh3);
+            return  prod;
+        #endif
+    };
+};
+
+template<>
+struct simd_mulhu<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // instruction does not exist; split into 32-bit multiplies
+        // x = x_H * 2^32 + x_L, y = y_H * 2^32 + y_L
+        __m512i mask_lo = _mm512_set1_epi64(0xFFFFFFFF);
+
+        __m512i x_hi    = _mm512_srli_epi64(x.data, 32);
+        __m512i y_hi    = _mm512_srli_epi64(y.data, 32);
+
+        // 64 bit unsigned products
+        __m512i prod_ll = _mm512_mul_epu32(x.data, y.data);
+        __m512i prod_lh = _mm512_mul_epu32(x.data, y_hi);
+        __m512i prod_hl = _mm512_mul_epu32(x_hi, y.data);
+        __m512i prod_hh = _mm512_mul_epu32(x_hi, y_hi);
+
+        // sums cannot overflow: (2^32 - 1)^2 + 2^32 - 1 < 2^64
+        __m512i t       = _mm512_add_epi64(prod_hl, _mm512_srli_epi64(prod_ll, 32));
+        __m512i u       = _mm512_add_epi64(prod_lh, _mm512_and_si512(t, mask_lo));
+
+        // x_H * y_H + t_H + u_H
+        __m512i res     = _mm512_add_epi64(_mm512_srli_epi64(t, 32), 
+                                           _mm512_srli_epi64(u, 32));
+        return _mm512_add_epi64(prod_hh, res);
+    };
+};
+
+template<>
+struct simd_mulh<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // signed high part is equal to the unsigned high part minus y if
+        // x < 0 and minus x if y < 0
+        __m512i res     = simd_mulhu<int64_t, 512, avx512_tag>::eval(x, y).data;
+
+        __m512i corr_x  = _mm512_and_si512(_mm512_srai_epi64(x.data, 63), y.data);
+        __m512i corr_y  = _mm512_and_si512(_mm512_srai_epi64(y.data, 63), x.data);
+
+        return _mm512_sub_epi64(res, _mm512_add_epi64(corr_x, corr_y));
+    };
+};
+
+template<>
+struct simd_plus<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_add_epi64( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_minus<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_sub_epi64( x.data, y.data );
+    };
+};
+
+template<>
+struct simd_uminus<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_sub_epi64(_mm512_setzero_si512(), x.data);
+    };
+};
+
+template<>
+struct simd_abs<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_abs_epi64(x.data);
+    };
+};
+
+template<>
+struct simd_horizontal_sum<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static int64_t eval(const simd_type& x)
+    {
+        int64_t s    = horizontal_sum(x.extract_low() + x.extract_high());
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_min<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static int64_t eval(const simd_type& x)
+    {
+        int64_t s    = horizontal_min(min(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_horizontal_max<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static int64_t eval(const simd_type& x)
+    {
+        int64_t s    = horizontal_max(max(x.extract_low(), x.extract_high()));
+        return s;
+    };
+};
+
+template<>
+struct simd_bitwise_or<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_or_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_xor<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_xor_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_and<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_and_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_andnot<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_andnot_si512(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_bitwise_not<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        // ternary logic function 0x55 computes ~x
+        return _mm512_ternarylogic_epi64(x.data, x.data, x.data, 0x55);
+    };
+};
+
+template<>
+struct simd_shift_left<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return _mm512_slli_epi64(x.data, y);
+    };
+};
+
+template<>
+struct simd_shift_right<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return _mm512_srli_epi64(x.data, y);
+    };
+};
+
+template<>
+struct simd_shift_right_arithmetic<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, unsigned int y)
+    {
+        return _mm512_srai_epi64(x.data, y);
+    };
+};
+
+template<>
+struct simd_round<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_floor<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_ceil<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_trunc<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return x;
+    };
+};
+
+template<>
+struct simd_eeq<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmpeq_epi64_mask(x.data, y.data);
+        return mask_to_vector_64(mask);
+    };
+};
+
+template<>
+struct simd_gt<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmpgt_epi64_mask(x.data, y.data);
+        return mask_to_vector_64(mask);
+    };
+};
+
+template<>
+struct simd_neq<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmpneq_epi64_mask(x.data, y.data);
+        return mask_to_vector_64(mask);
+    };
+};
+
+template<>
+struct simd_lt<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmplt_epi64_mask(x.data, y.data);
+        return mask_to_vector_64(mask);
+    };
+};
+
+template<>
+struct simd_leq<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmple_epi64_mask(x.data, y.data);
+        return mask_to_vector_64(mask);
+    };
+};
+
+template<>
+struct simd_geq<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __mmask8 mask   = _mm512_cmpge_epi64_mask(x.data, y.data);
+        return mask_to_vector_64(mask);
+    };
+};
+
+template<>
+struct simd_max<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_max_epi64(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_min<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_min_epi64(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_any<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask8 mask   = vector_to_mask_64(x.data);
+        return mask != 0;
+    };
+};
+
+template<>
+struct simd_all<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static bool eval(const simd_type& x)
+    {
+        __mmask8 mask   = vector_to_mask_64(x.data);
+        return mask == 0xFF;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+template<>
+struct simd_if_then_else<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& test, const simd_type& val_true,
+                          const simd_type& val_false)
+    {
+        __mmask8 mask   = vector_to_mask_64(test.data);
+        return _mm512_mask_blend_epi64(mask, val_false.data, val_true.data);
+    };
+};
+
+}}}
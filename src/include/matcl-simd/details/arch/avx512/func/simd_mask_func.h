@@ -0,0 +1,443 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_mask_def.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                  MASK TYPES
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_impl_type<double, 512, avx512_tag>     { using type = __mmask8; };
+
+template<>
+struct simd_mask_impl_type<int64_t, 512, avx512_tag>    { using type = __mmask8; };
+
+template<>
+struct simd_mask_impl_type<float, 512, avx512_tag>      { using type = __mmask16; };
+
+template<>
+struct simd_mask_impl_type<int32_t, 512, avx512_tag>    { using type = __mmask16; };
+
+//-----------------------------------------------------------------------
+//                  DOUBLE
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_from_vector<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static __mmask8 eval(const simd_type& x)
+    {
+        return vector_to_mask_64(_mm512_castpd_si512(x.data));
+    };
+};
+
+template<>
+struct simd_mask_to_vector<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const __mmask8& m)
+    {
+        return _mm512_castsi512_pd(mask_to_vector_64(m));
+    };
+};
+
+template<>
+struct simd_mask_compare<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static __mmask8 eeq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_pd_mask(x.data, y.data, _CMP_EQ_OQ);
+    };
+
+    force_inline
+    static __mmask8 neq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_pd_mask(x.data, y.data, _CMP_NEQ_UQ);
+    };
+
+    force_inline
+    static __mmask8 lt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_pd_mask(x.data, y.data, _CMP_LT_OQ);
+    };
+
+    force_inline
+    static __mmask8 gt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_pd_mask(x.data, y.data, _CMP_GT_OQ);
+    };
+
+    force_inline
+    static __mmask8 leq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_pd_mask(x.data, y.data, _CMP_LE_OQ);
+    };
+
+    force_inline
+    static __mmask8 geq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_pd_mask(x.data, y.data, _CMP_GE_OQ);
+    };
+
+    force_inline
+    static __mmask8 is_nan(const simd_type& x)
+    {
+        return _mm512_cmp_pd_mask(x.data, x.data, _CMP_UNORD_Q);
+    };
+
+    force_inline
+    static __mmask8 is_finite(const simd_type& x)
+    {
+        // mask selecting all bits in the exponent
+        __m512i mask    = _mm512_set1_epi64(0x7FF0000000000000ll);
+        __m512i xi      = _mm512_and_si512(_mm512_castpd_si512(x.data), mask);
+
+        // at least one bit in the exponent is not set
+        return _mm512_cmpneq_epi64_mask(xi, mask);
+    };
+};
+
+template<>
+struct simd_mask_conditional<double, 512, avx512_tag>
+{
+    using simd_type = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type if_then_else(const __mmask8& test, const simd_type& val_true,
+                                  const simd_type& val_false)
+    {
+        return _mm512_mask_blend_pd(test, val_false.data, val_true.data);
+    };
+
+    force_inline
+    static simd_type if_add(const __mmask8& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_add_pd(x.data, test, x.data, y.data);
+    };
+
+    force_inline
+    static simd_type if_sub(const __mmask8& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_sub_pd(x.data, test, x.data, y.data);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                  FLOAT
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_from_vector<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static __mmask16 eval(const simd_type& x)
+    {
+        return vector_to_mask_32(_mm512_castps_si512(x.data));
+    };
+};
+
+template<>
+struct simd_mask_to_vector<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const __mmask16& m)
+    {
+        return _mm512_castsi512_ps(mask_to_vector_32(m));
+    };
+};
+
+template<>
+struct simd_mask_compare<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static __mmask16 eeq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_ps_mask(x.data, y.data, _CMP_EQ_OQ);
+    };
+
+    force_inline
+    static __mmask16 neq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_ps_mask(x.data, y.data, _CMP_NEQ_UQ);
+    };
+
+    force_inline
+    static __mmask16 lt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_ps_mask(x.data, y.data, _CMP_LT_OQ);
+    };
+
+    force_inline
+    static __mmask16 gt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_ps_mask(x.data, y.data, _CMP_GT_OQ);
+    };
+
+    force_inline
+    static __mmask16 leq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_ps_mask(x.data, y.data, _CMP_LE_OQ);
+    };
+
+    force_inline
+    static __mmask16 geq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmp_ps_mask(x.data, y.data, _CMP_GE_OQ);
+    };
+
+    force_inline
+    static __mmask16 is_nan(const simd_type& x)
+    {
+        return _mm512_cmp_ps_mask(x.data, x.data, _CMP_UNORD_Q);
+    };
+
+    force_inline
+    static __mmask16 is_finite(const simd_type& x)
+    {
+        // mask selecting all bits in the exponent
+        __m512i mask    = _mm512_set1_epi32(0x7F800000);
+        __m512i xi      = _mm512_and_si512(_mm512_castps_si512(x.data), mask);
+
+        // at least one bit in the exponent is not set
+        return _mm512_cmpneq_epi32_mask(xi, mask);
+    };
+};
+
+template<>
+struct simd_mask_conditional<float, 512, avx512_tag>
+{
+    using simd_type = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type if_then_else(const __mmask16& test, const simd_type& val_true,
+                                  const simd_type& val_false)
+    {
+        return _mm512_mask_blend_ps(test, val_false.data, val_true.data);
+    };
+
+    force_inline
+    static simd_type if_add(const __mmask16& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_add_ps(x.data, test, x.data, y.data);
+    };
+
+    force_inline
+    static simd_type if_sub(const __mmask16& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_sub_ps(x.data, test, x.data, y.data);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                  INT32_T
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_from_vector<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static __mmask16 eval(const simd_type& x)
+    {
+        return vector_to_mask_32(x.data);
+    };
+};
+
+template<>
+struct simd_mask_to_vector<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const __mmask16& m)
+    {
+        return mask_to_vector_32(m);
+    };
+};
+
+template<>
+struct simd_mask_compare<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static __mmask16 eeq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpeq_epi32_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask16 neq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpneq_epi32_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask16 lt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmplt_epi32_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask16 gt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpgt_epi32_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask16 leq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmple_epi32_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask16 geq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpge_epi32_mask(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_mask_conditional<int32_t, 512, avx512_tag>
+{
+    using simd_type = simd<int32_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type if_then_else(const __mmask16& test, const simd_type& val_true,
+                                  const simd_type& val_false)
+    {
+        return _mm512_mask_blend_epi32(test, val_false.data, val_true.data);
+    };
+
+    force_inline
+    static simd_type if_add(const __mmask16& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_add_epi32(x.data, test, x.data, y.data);
+    };
+
+    force_inline
+    static simd_type if_sub(const __mmask16& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_sub_epi32(x.data, test, x.data, y.data);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                  INT64_T
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_from_vector<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static __mmask8 eval(const simd_type& x)
+    {
+        return vector_to_mask_64(x.data);
+    };
+};
+
+template<>
+struct simd_mask_to_vector<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const __mmask8& m)
+    {
+        return mask_to_vector_64(m);
+    };
+};
+
+template<>
+struct simd_mask_compare<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static __mmask8 eeq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpeq_epi64_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask8 neq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpneq_epi64_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask8 lt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmplt_epi64_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask8 gt(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpgt_epi64_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask8 leq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmple_epi64_mask(x.data, y.data);
+    };
+
+    force_inline
+    static __mmask8 geq(const simd_type& x, const simd_type& y)
+    {
+        return _mm512_cmpge_epi64_mask(x.data, y.data);
+    };
+};
+
+template<>
+struct simd_mask_conditional<int64_t, 512, avx512_tag>
+{
+    using simd_type = simd<int64_t, 512, avx512_tag>;
+
+    force_inline
+    static simd_type if_then_else(const __mmask8& test, const simd_type& val_true,
+                                  const simd_type& val_false)
+    {
+        return _mm512_mask_blend_epi64(test, val_false.data, val_true.data);
+    };
+
+    force_inline
+    static simd_type if_add(const __mmask8& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_add_epi64(x.data, test, x.data, y.data);
+    };
+
+    force_inline
+    static simd_type if_sub(const __mmask8& test, const simd_type& x, const simd_type& y)
+    {
+        return _mm512_mask_sub_epi64(x.data, test, x.data, y.data);
+    };
+};
+
+}}}
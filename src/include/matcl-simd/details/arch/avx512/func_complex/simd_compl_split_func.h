@@ -0,0 +1,82 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_func_complex_def.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// simd_compl is not defined for 512-bit vectors, but simd_compl_split is
+// available for all simd types
+
+template<>
+struct simd_compl_split_shuffle<double, 512, avx512_tag>
+{
+    using simd_type         = simd<double, 512, avx512_tag>;
+
+    // a = [r0, i0, ..., r3, i3], b = [r4, i4, ..., r7, i7]
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        const __m512i i_re  = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+        const __m512i i_im  = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+
+        re  = _mm512_permutex2var_pd(a.data, i_re, b.data);
+        im  = _mm512_permutex2var_pd(a.data, i_im, b.data);
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        const __m512i i_lo  = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+        const __m512i i_hi  = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+
+        a   = _mm512_permutex2var_pd(re.data, i_lo, im.data);
+        b   = _mm512_permutex2var_pd(re.data, i_hi, im.data);
+    };
+};
+
+template<>
+struct simd_compl_split_shuffle<float, 512, avx512_tag>
+{
+    using simd_type         = simd<float, 512, avx512_tag>;
+
+    // a = [r0, i0, ..., r7, i7], b = [r8, i8, ..., r15, i15]
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        const __m512i i_re  = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 
+                                                16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i i_im  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 
+                                                17, 19, 21, 23, 25, 27, 29, 31);
+
+        re  = _mm512_permutex2var_ps(a.data, i_re, b.data);
+        im  = _mm512_permutex2var_ps(a.data, i_im, b.data);
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        const __m512i i_lo  = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 
+                                                4, 20, 5, 21, 6, 22, 7, 23);
+        const __m512i i_hi  = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 
+                                                12, 28, 13, 29, 14, 30, 15, 31);
+
+        a   = _mm512_permutex2var_ps(re.data, i_lo, im.data);
+        b   = _mm512_permutex2var_ps(re.data, i_hi, im.data);
+    };
+};
+
+}}}
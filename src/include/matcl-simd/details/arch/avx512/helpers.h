@@ -0,0 +1,73 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd_general.h"
+
+#include <immintrin.h>
+
+namespace matcl { namespace simd { namespace details
+{
+
+// Generate a constant vector of 16 integers stored in memory,
+// load as __m512i
+template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7,
+          int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15>
+static force_inline __m512i vector_16_int()
+{
+    using m512_int16    = union
+                        {
+                            int     i[16];
+                            __m512i zmm;
+                        };
+
+    static const m512_int16 val = {{I0,I1,I2,I3,I4,I5,I6,I7,I8,I9,I10,I11,I12,I13,I14,I15}};
+    return val.zmm;
+};
+
+// Generate a constant vector of 8 64-bit integers stored in memory,
+// load as __m512i
+template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7>
+static force_inline __m512i vector_8_int64()
+{
+    using m512_int8     = union
+                        {
+                            long long   i[8];
+                            __m512i     zmm;
+                        };
+
+    static const m512_int8 val = {{I0,I1,I2,I3,I4,I5,I6,I7}};
+    return val.zmm;
+};
+
+// convert opmask to a vector with all bits set in lanes selected by the mask
+// and all bits cleared otherwise
+force_inline __m512i mask_to_vector_64(__mmask8 mask)
+{
+    return _mm512_maskz_set1_epi64(mask, -1);
+};
+
+force_inline __m512i mask_to_vector_32(__mmask16 mask)
+{
+    return _mm512_maskz_set1_epi32(mask, -1);
+};
+
+// convert a vector mask to opmask; a lane is selected if the sign bit is set
+// (as in blendv instructions)
+force_inline __mmask8 vector_to_mask_64(__m512i x)
+{
+    return _mm512_cmplt_epi64_mask(x, _mm512_setzero_si512());
+};
+
+force_inline __mmask16 vector_to_mask_32(__m512i x)
+{
+    return _mm512_cmplt_epi32_mask(x, _mm512_setzero_si512());
+};
+
+}}}
@@ -0,0 +1,197 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                          pow2k
+//-----------------------------------------------------------------------
+template<class Val>
+struct simd_pow2k<Val, 512, avx512_tag>
+{
+    using simd_type = simd<Val, 512, avx512_tag>;
+    using int_type  = typename details::integer_type<Val>::type;
+    using simd_int  = simd<int_type, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& k)
+    {
+        return simd_pow2k_impl<Val, 512, avx512_tag>::eval(k);
+    };
+
+    force_inline
+    static simd_type eval_i(const simd_int& k)
+    {
+        return simd_pow2k_impl<Val, 512, avx512_tag>::eval_i(k);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          exponent
+//-----------------------------------------------------------------------
+template<class Val>
+struct simd_exponent<Val, 512, avx512_tag>
+{
+    using simd_type = simd<Val, 512, avx512_tag>;
+    using int_type  = typename details::integer_type<Val>::type;
+    using simd_int  = simd<int_type, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& k)
+    {
+        return simd_exponent_impl<Val, 512, avx512_tag>::eval(k);
+    };
+
+    force_inline
+    static simd_int eval_i(const simd_type& k)
+    {
+        return simd_exponent_impl<Val, 512, avx512_tag>::eval_i(k);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          copysign
+//-----------------------------------------------------------------------
+template<class Val>
+struct simd_copysign<Val, 512, avx512_tag>
+{
+    using simd_type = simd<Val, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_copysign_impl<Val, 512, avx512_tag>::eval(x, y);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          fraction
+//-----------------------------------------------------------------------
+template<class Val>
+struct simd_fraction<Val, 512, avx512_tag>
+{
+    using simd_type = simd<Val, 512, avx512_tag>;
+    using int_type  = typename details::integer_type<Val>::type;
+    using simd_int  = simd<int_type, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& k)
+    {
+        return simd_fraction_impl<Val, 512, avx512_tag>::eval(k);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          rcp/rsqrt
+//-----------------------------------------------------------------------
+template<>
+struct simd_rcp_approx<double, 512, avx512_tag>
+{
+    using simd_type     = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_rcp14_pd(x.data);
+    };
+};
+
+template<>
+struct simd_rcp_approx<float, 512, avx512_tag>
+{
+    using simd_type     = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_rcp14_ps(x.data);
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<double, 512, avx512_tag>
+{
+    using simd_type     = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_rsqrt14_pd(x.data);
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<float, 512, avx512_tag>
+{
+    using simd_type     = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm512_rsqrt14_ps(x.data);
+    };
+};
+
+// relative error of rcp_approx and rsqrt_approx is at most 2^-14; two
+// Newton steps are required in double precision and one step in single
+// precision
+template<>
+struct simd_rcp<double, 512, avx512_tag>
+{
+    using simd_type     = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<double, 512, avx512_tag>::eval_rcp<2>(x);
+    };
+};
+
+template<>
+struct simd_rcp<float, 512, avx512_tag>
+{
+    using simd_type     = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, 512, avx512_tag>::eval_rcp<1>(x);
+    };
+};
+
+template<>
+struct simd_rsqrt<double, 512, avx512_tag>
+{
+    using simd_type     = simd<double, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<double, 512, avx512_tag>::eval_rsqrt<2>(x);
+    };
+};
+
+template<>
+struct simd_rsqrt<float, 512, avx512_tag>
+{
+    using simd_type     = simd<float, 512, avx512_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, 512, avx512_tag>::eval_rsqrt<1>(x);
+    };
+};
+
+}}}
@@ -0,0 +1,338 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/arch/avx512/simd_double_512.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+#pragma warning(push)
+#pragma warning(disable : 4127) // conditional expression is constant
+
+namespace matcl { namespace simd
+{
+
+//-------------------------------------------------------------------
+//                          AVX512 DOUBLE
+//-------------------------------------------------------------------
+
+force_inline
+simd<double, 512, avx512_tag>::simd(int32_t val)
+    : data(_mm512_set1_pd(val))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(int64_t val)
+    : data(_mm512_set1_pd(double(val)))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(float val)
+    : data(_mm512_set1_pd(val))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(double val)
+    : data(_mm512_set1_pd(val))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(double v1, double v2, double v3, double v4, double v5,
+                                    double v6, double v7, double v8)
+    : data(_mm512_setr_pd(v1, v2, v3, v4, v5, v6, v7, v8))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(const simd_half& lo, const simd_half& hi)
+    : data(_mm512_insertf64x4(_mm512_castpd256_pd512(lo.data), hi.data, 1))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(const simd_half& lo_hi)
+    : data(_mm512_insertf64x4(_mm512_castpd256_pd512(lo_hi.data), lo_hi.data, 1))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(const impl_type& v)
+    : data(v)
+{};
+
+force_inline
+simd<double, 512, avx512_tag>::simd(const simd<double, 128, scalar_sse_tag>& s)
+    : data(_mm512_broadcastsd_pd(s.data))
+{}
+
+force_inline
+simd<double, 512, avx512_tag>::simd(const simd<double, 128, scalar_nosimd_tag>& s)
+    :simd(s.first())
+{}
+
+force_inline
+double simd<double, 512, avx512_tag>::get(int pos) const
+{
+    return get_raw_ptr()[pos] ;
+};
+
+force_inline
+double simd<double, 512, avx512_tag>::first() const
+{
+    __m128d ds  = _mm512_castpd512_pd128(data);
+    return _mm_cvtsd_f64(ds);
+};
+
+force_inline
+void simd<double, 512, avx512_tag>::set(int pos, double val)
+{
+    get_raw_ptr()[pos] = val;
+};
+
+force_inline
+const double* simd<double, 512, avx512_tag>::get_raw_ptr() const
+{
+    return reinterpret_cast<const double*>(&data);
+};
+
+force_inline
+double* simd<double, 512, avx512_tag>::get_raw_ptr()
+{
+    return reinterpret_cast<double*>(&data);
+};
+
+force_inline simd<double, 512, avx512_tag>::simd_half
+simd<double, 512, avx512_tag>::extract_low() const
+{
+    return _mm512_castpd512_pd256(data);
+}
+
+force_inline simd<double, 512, avx512_tag>::simd_half
+simd<double, 512, avx512_tag>::extract_high() const
+{
+    return _mm512_extractf64x4_pd(data, 1);
+}
+
+template<int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8>
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::select() const
+{
+    static_assert(I1 >= 0 && I1 <= 7, "invalid index in select function");
+    static_assert(I2 >= 0 && I2 <= 7, "invalid index in select function");
+    static_assert(I3 >= 0 && I3 <= 7, "invalid index in select function");
+    static_assert(I4 >= 0 && I4 <= 7, "invalid index in select function");
+    static_assert(I5 >= 0 && I5 <= 7, "invalid index in select function");
+    static_assert(I6 >= 0 && I6 <= 7, "invalid index in select function");
+    static_assert(I7 >= 0 && I7 <= 7, "invalid index in select function");
+    static_assert(I8 >= 0 && I8 <= 7, "invalid index in select function");
+
+    if (I1 == 0 && I2 == 1 && I3 == 2 && I4 == 3 && I5 == 4 && I6 == 5 && I7 == 6 && I8 == 7)
+        return data;
+
+    // general case
+    const __m512i ind = details::vector_8_int64<I1, I2, I3, I4, I5, I6, I7, I8>();
+    return _mm512_permutexvar_pd(ind, data);
+};
+
+force_inline
+simd<double, 512, avx512_tag> simd<double, 512, avx512_tag>::zero()
+{
+    impl_type data  = _mm512_setzero_pd();
+    return data;
+}
+
+force_inline
+simd<double, 512, avx512_tag> simd<double, 512, avx512_tag>::minus_zero()
+{
+    return simd(-0.0);
+}
+
+force_inline
+simd<double, 512, avx512_tag> simd<double, 512, avx512_tag>::one()
+{
+    return simd(1.0);
+}
+
+force_inline
+simd<double, 512, avx512_tag> simd<double, 512, avx512_tag>::minus_one()
+{
+    return simd(-1.0);
+}
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::load(const double* arr, std::true_type aligned)
+{
+    (void)aligned;
+    return _mm512_load_pd(arr);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::load(const double* arr, std::false_type not_aligned)
+{
+    (void)not_aligned;
+    return _mm512_loadu_pd(arr);
+};
+
+force_inline simd<double, 512, avx512_tag> 
+simd<double, 512, avx512_tag>::load_partial(const double* arr, int n)
+{
+    __mmask8 mask    = __mmask8((1u << n) - 1);
+    return _mm512_maskz_loadu_pd(mask, arr);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::gather(const double* arr, const simd_int32_half& ind)
+{
+    return _mm512_i32gather_pd(ind.data, arr, 8);
+}
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::gather(const double* arr, const simd_int32& ind)
+{
+    return gather(arr, ind.extract_low());
+}
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::gather(const double* arr, const simd_int64& ind)
+{
+    return _mm512_i64gather_pd(ind.data, arr, 8);
+}
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::broadcast(const double* arr)
+{
+    return _mm512_set1_pd(*arr);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<double, 512, avx512_tag>::broadcast(const double& arr)
+{
+    return _mm512_set1_pd(arr);
+};
+
+force_inline void
+simd<double, 512, avx512_tag>::store(double* arr, std::true_type aligned) const
+{
+    (void)aligned;
+    _mm512_store_pd(arr, data);
+};
+
+force_inline void
+simd<double, 512, avx512_tag>::store(double* arr, std::false_type not_aligned) const
+{
+    (void)not_aligned;
+    _mm512_storeu_pd(arr, data);
+};
+
+force_inline void 
+simd<double, 512, avx512_tag>::store_partial(double* arr, int n) const
+{
+    __mmask8 mask    = __mmask8((1u << n) - 1);
+    _mm512_mask_storeu_pd(arr, mask, data);
+};
+
+force_inline void
+simd<double, 512, avx512_tag>::stream(double* arr, std::true_type aligned) const
+{
+    (void)aligned;
+    _mm512_stream_pd(arr, data);
+};
+
+force_inline simd<float, 256, avx_tag>
+simd<double, 512, avx512_tag>::convert_to_float() const
+{
+    return _mm512_cvtpd_ps(data);
+};
+
+force_inline simd<int32_t, 256, avx_tag>
+simd<double, 512, avx512_tag>::convert_to_int32() const
+{
+    return _mm512_cvtpd_epi32(data);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<double, 512, avx512_tag>::convert_to_int64() const
+{
+    #if MATCL_ARCHITECTURE_HAS_AVX512DQ
+        return _mm512_cvtpd_epi64(data);
+    #else
+        simd<int64_t, 512, avx512_tag> ret;
+
+        int64_t* ret_ptr    = ret.get_raw_ptr();
+        const double* ptr   = this->get_raw_ptr();
+
+        for (int i = 0; i < vector_size; ++i)
+            ret_ptr[i]      = scalar_func::convert_double_int64(ptr[i]);
+
+        return ret;
+    #endif
+};
+
+force_inline simd<float, 512, avx512_tag>
+simd<double, 512, avx512_tag>::reinterpret_as_float() const
+{
+    return _mm512_castpd_ps(data);
+}
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<double, 512, avx512_tag>::reinterpret_as_int32() const
+{
+    return _mm512_castpd_si512(data);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<double, 512, avx512_tag>::reinterpret_as_int64() const
+{
+    return _mm512_castpd_si512(data);
+}
+
+template<int Step>
+force_inline
+void simd<double, 512, avx512_tag>::scatter(double* arr) const
+{
+    const double* ptr = get_raw_ptr();
+
+    // scatter instruction is not faster than scalar stores
+    arr[0*Step] = ptr[0];
+    arr[1*Step] = ptr[1];
+    arr[2*Step] = ptr[2];
+    arr[3*Step] = ptr[3];
+    arr[4*Step] = ptr[4];
+    arr[5*Step] = ptr[5];
+    arr[6*Step] = ptr[6];
+    arr[7*Step] = ptr[7];
+};
+
+force_inline simd<double, 512, avx512_tag>&
+simd<double, 512, avx512_tag>::operator+=(const simd& x)
+{
+    *this = *this + x;
+    return *this;
+}
+
+force_inline simd<double, 512, avx512_tag>&
+simd<double, 512, avx512_tag>::operator-=(const simd& x)
+{
+    *this = *this - x;
+    return *this;
+}
+
+force_inline simd<double, 512, avx512_tag>&
+simd<double, 512, avx512_tag>::operator*=(const simd& x)
+{
+    *this = *this * x;
+    return *this;
+}
+
+force_inline simd<double, 512, avx512_tag>&
+simd<double, 512, avx512_tag>::operator/=(const simd& x)
+{
+    *this = *this / x;
+    return *this;
+}
+
+}}
+
+#pragma warning(pop)
@@ -0,0 +1,365 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/arch/avx512/simd_float_512.h"
+#include "matcl-simd/details/arch/avx512/helpers.h"
+
+#pragma warning(push)
+#pragma warning(disable : 4127) // conditional expression is constant
+
+namespace matcl { namespace simd
+{
+
+//-------------------------------------------------------------------
+//                          AVX512 SINGLE
+//-------------------------------------------------------------------
+
+force_inline
+simd<float, 512, avx512_tag>::simd(float val)
+    : data(_mm512_set1_ps(val))
+{}
+
+force_inline
+simd<float, 512, avx512_tag>::simd(const simd_half& lo_hi)
+    : simd(lo_hi, lo_hi)
+{}
+
+force_inline
+simd<float, 512, avx512_tag>::simd(float v1, float v2, float v3, float v4, float v5, float v6,
+                                   float v7, float v8, float v9, float v10, float v11, float v12,
+                                   float v13, float v14, float v15, float v16)
+    : data(_mm512_setr_ps(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16))
+{}
+
+force_inline
+simd<float, 512, avx512_tag>::simd(const impl_type& v)
+    : data(v)
+{};
+
+force_inline
+simd<float, 512, avx512_tag>::simd(const simd_half& lo, const simd_half& hi)
+{
+    // 256-bit insert of single precision values requires AVX512DQ
+    __m512d lo_d    = _mm512_castpd256_pd512(_mm256_castps_pd(lo.data));
+    __m512d res     = _mm512_insertf64x4(lo_d, _mm256_castps_pd(hi.data), 1);
+    data            = _mm512_castpd_ps(res);
+}
+
+force_inline
+simd<float, 512, avx512_tag>::simd(const simd<float, 128, scalar_sse_tag>& s)
+    : data(_mm512_broadcastss_ps(s.data))
+{}
+
+force_inline
+simd<float, 512, avx512_tag>::simd(const simd<float, 128, scalar_nosimd_tag>& s)
+    :simd(s.first())
+{}
+
+force_inline
+float simd<float, 512, avx512_tag>::get(int pos) const
+{
+    return get_raw_ptr()[pos] ;
+};
+
+force_inline
+float simd<float, 512, avx512_tag>::first() const
+{
+    __m128 ds  = _mm512_castps512_ps128(data);
+    return _mm_cvtss_f32(ds);
+};
+
+force_inline
+void simd<float, 512, avx512_tag>::set(int pos, float val)
+{
+    get_raw_ptr()[pos] = val;
+};
+
+force_inline
+const float* simd<float, 512, avx512_tag>::get_raw_ptr() const
+{
+    return reinterpret_cast<const float*>(&data);
+};
+
+force_inline
+float* simd<float, 512, avx512_tag>::get_raw_ptr()
+{
+    return reinterpret_cast<float*>(&data);
+};
+
+force_inline simd<float, 512, avx512_tag>::simd_half
+simd<float, 512, avx512_tag>::extract_low() const
+{
+    return _mm512_castps512_ps256(data);
+}
+
+force_inline simd<float, 512, avx512_tag>::simd_half
+simd<float, 512, avx512_tag>::extract_high() const
+{
+    __m256d hi  = _mm512_extractf64x4_pd(_mm512_castps_pd(data), 1);
+    return _mm256_castpd_ps(hi);
+}
+
+template<int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8,
+         int I9, int I10, int I11, int I12, int I13, int I14, int I15, int I16>
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::select() const
+{
+    static_assert(I1 >= 0 && I1 <= 15, "invalid index in select function");
+    static_assert(I2 >= 0 && I2 <= 15, "invalid index in select function");
+    static_assert(I3 >= 0 && I3 <= 15, "invalid index in select function");
+    static_assert(I4 >= 0 && I4 <= 15, "invalid index in select function");
+    static_assert(I5 >= 0 && I5 <= 15, "invalid index in select function");
+    static_assert(I6 >= 0 && I6 <= 15, "invalid index in select function");
+    static_assert(I7 >= 0 && I7 <= 15, "invalid index in select function");
+    static_assert(I8 >= 0 && I8 <= 15, "invalid index in select function");
+    static_assert(I9 >= 0 && I9 <= 15, "invalid index in select function");
+    static_assert(I10 >= 0 && I10 <= 15, "invalid index in select function");
+    static_assert(I11 >= 0 && I11 <= 15, "invalid index in select function");
+    static_assert(I12 >= 0 && I12 <= 15, "invalid index in select function");
+    static_assert(I13 >= 0 && I13 <= 15, "invalid index in select function");
+    static_assert(I14 >= 0 && I14 <= 15, "invalid index in select function");
+    static_assert(I15 >= 0 && I15 <= 15, "invalid index in select function");
+    static_assert(I16 >= 0 && I16 <= 15, "invalid index in select function");
+
+    if (I1 == 0 && I2 == 1 && I3 == 2 && I4 == 3 && I5 == 4 && I6 == 5 && I7 == 6
+        && I8 == 7 && I9 == 8 && I10 == 9 && I11 == 10 && I12 == 11 && I13 == 12
+        && I14 == 13 && I15 == 14 && I16 == 15)
+    {
+        return data;
+    }
+
+    // general case
+    const __m512i ind = details::vector_16_int<I1, I2, I3, I4, I5, I6, I7, I8,
+                                               I9, I10, I11, I12, I13, I14, I15, I16>();
+    return _mm512_permutexvar_ps(ind, data);
+};
+
+force_inline
+simd<float, 512, avx512_tag> simd<float, 512, avx512_tag>::zero()
+{
+    impl_type data  = _mm512_setzero_ps();
+    return data;
+}
+
+force_inline
+simd<float, 512, avx512_tag> simd<float, 512, avx512_tag>::minus_zero()
+{
+    return simd(-0.0f);
+}
+
+force_inline
+simd<float, 512, avx512_tag> simd<float, 512, avx512_tag>::one()
+{
+    return simd(1.0f);
+}
+
+force_inline
+simd<float, 512, avx512_tag> simd<float, 512, avx512_tag>::minus_one()
+{
+    return simd(-1.0f);
+}
+
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::load(const float* arr, std::true_type aligned)
+{
+    (void)aligned;
+    return _mm512_load_ps(arr);
+};
+
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::load(const float* arr, std::false_type not_aligned)
+{
+    (void)not_aligned;
+    return _mm512_loadu_ps(arr);
+};
+
+force_inline simd<float, 512, avx512_tag> 
+simd<float, 512, avx512_tag>::load_partial(const float* arr, int n)
+{
+    __mmask16 mask    = __mmask16((1u << n) - 1);
+    return _mm512_maskz_loadu_ps(mask, arr);
+};
+
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::gather(const float* arr, const simd_int32& ind)
+{
+    return _mm512_i32gather_ps(ind.data, arr, 4);
+}
+
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::gather(const float* arr, const simd_int64& ind)
+{
+    return simd(simd_half(_mm512_i64gather_ps(ind.data, arr, 4)), simd_half::zero());
+}
+
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::broadcast(const float* arr)
+{
+    return _mm512_set1_ps(*arr);
+};
+
+force_inline simd<float, 512, avx512_tag>
+simd<float, 512, avx512_tag>::broadcast(const float& arr)
+{
+    return _mm512_set1_ps(arr);
+};
+
+force_inline void simd<float, 512, avx512_tag>::store(float* arr, std::true_type aligned) const
+{
+    (void)aligned;
+    _mm512_store_ps(arr, data);
+};
+
+force_inline void simd<float, 512, avx512_tag>::store(float* arr, std::false_type not_aligned) const
+{
+    (void)not_aligned;
+    _mm512_storeu_ps(arr, data);
+};
+
+force_inline void simd<float, 512, avx512_tag>::store_partial(float* arr, int n) const
+{
+    __mmask16 mask    = __mmask16((1u << n) - 1);
+    _mm512_mask_storeu_ps(arr, mask, data);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<float, 512, avx512_tag>::convert_low_to_double() const
+{
+    simd_half lo    = this->extract_low();
+    return _mm512_cvtps_pd(lo.data);
+};
+
+force_inline
+simd<double, 512, avx512_tag>
+simd<float, 512, avx512_tag>::convert_high_to_double() const
+{
+    simd_half hi    = this->extract_high();
+    return _mm512_cvtps_pd(hi.data);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<float, 512, avx512_tag>::convert_low_to_int64() const
+{
+    #if MATCL_ARCHITECTURE_HAS_AVX512DQ
+        simd_half lo    = this->extract_low();
+        return _mm512_cvtps_epi64(lo.data);
+    #else
+        simd_int64 ret;
+
+        const float* ptr    = this->get_raw_ptr();
+        int64_t* ptr_ret    = ret.get_raw_ptr();
+
+        for (int i = 0; i < 8; ++i)
+            ptr_ret[i]      = scalar_func::convert_float_int64(ptr[i]);
+
+        return ret;
+    #endif
+};
+
+force_inline
+simd<int64_t, 512, avx512_tag>
+simd<float, 512, avx512_tag>::convert_high_to_int64() const
+{
+    #if MATCL_ARCHITECTURE_HAS_AVX512DQ
+        simd_half hi    = this->extract_high();
+        return _mm512_cvtps_epi64(hi.data);
+    #else
+        simd_int64 ret;
+
+        const float* ptr    = this->get_raw_ptr();
+        int64_t* ptr_ret    = ret.get_raw_ptr();
+
+        for (int i = 0; i < 8; ++i)
+            ptr_ret[i]      = scalar_func::convert_float_int64(ptr[i + 8]);
+
+        return ret;
+    #endif
+};
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<float, 512, avx512_tag>::convert_to_int32() const
+{
+    return _mm512_cvtps_epi32(data);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<float, 512, avx512_tag>::reinterpret_as_double() const
+{
+    return _mm512_castps_pd(data);
+};
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<float, 512, avx512_tag>::reinterpret_as_int32() const
+{
+    return _mm512_castps_si512(data);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<float, 512, avx512_tag>::reinterpret_as_int64() const
+{
+    return _mm512_castps_si512(data);
+};
+
+template<int Step>
+force_inline
+void simd<float, 512, avx512_tag>::scatter(float* arr) const
+{
+    const float* ptr = get_raw_ptr();
+
+    // scatter instruction is not faster than scalar stores
+    arr[0*Step]     = ptr[0];
+    arr[1*Step]     = ptr[1];
+    arr[2*Step]     = ptr[2];
+    arr[3*Step]     = ptr[3];
+    arr[4*Step]     = ptr[4];
+    arr[5*Step]     = ptr[5];
+    arr[6*Step]     = ptr[6];
+    arr[7*Step]     = ptr[7];
+    arr[8*Step]     = ptr[8];
+    arr[9*Step]     = ptr[9];
+    arr[10*Step]    = ptr[10];
+    arr[11*Step]    = ptr[11];
+    arr[12*Step]    = ptr[12];
+    arr[13*Step]    = ptr[13];
+    arr[14*Step]    = ptr[14];
+    arr[15*Step]    = ptr[15];
+};
+
+force_inline simd<float, 512, avx512_tag>&
+simd<float, 512, avx512_tag>::operator+=(const simd& x)
+{
+    *this = *this + x;
+    return *this;
+}
+
+force_inline simd<float, 512, avx512_tag>&
+simd<float, 512, avx512_tag>::operator-=(const simd& x)
+{
+    *this = *this - x;
+    return *this;
+}
+
+force_inline simd<float, 512, avx512_tag>&
+simd<float, 512, avx512_tag>::operator*=(const simd& x)
+{
+    *this = *this * x;
+    return *this;
+}
+
+force_inline simd<float, 512, avx512_tag>&
+simd<float, 512, avx512_tag>::operator/=(const simd& x)
+{
+    *this = *this / x;
+    return *this;
+}
+
+}}
+
+#pragma warning(pop)
@@ -0,0 +1,292 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/arch/avx512/simd_int32_512.h"
+
+namespace matcl { namespace simd
+{
+
+//-------------------------------------------------------------------
+//                          AVX512 int32_t
+//-------------------------------------------------------------------
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(int32_t val)
+    : data(_mm512_set1_epi32(val))
+{}
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(const simd_half& lo_hi)
+    : data(_mm512_inserti64x4(_mm512_castsi256_si512(lo_hi.data), lo_hi.data, 1))
+{}
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(int32_t v1, int32_t v2, int32_t v3, int32_t v4, int32_t v5,
+                                     int32_t v6, int32_t v7, int32_t v8, int32_t v9, int32_t v10,
+                                     int32_t v11, int32_t v12, int32_t v13, int32_t v14,
+                                     int32_t v15, int32_t v16)
+    : data(_mm512_setr_epi32(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+                             v15, v16))
+{}
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(const impl_type& v)
+    : data(v)
+{};
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(const simd_half& lo, const simd_half& hi)
+    : data(_mm512_inserti64x4(_mm512_castsi256_si512(lo.data), hi.data, 1))
+{}
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(const simd<int32_t, 128, scalar_sse_tag>& s)
+    : data(_mm512_broadcastd_epi32(s.data))
+{}
+
+force_inline
+simd<int32_t, 512, avx512_tag>::simd(const simd<int32_t, 128, scalar_nosimd_tag>& s)
+    :simd(s.first())
+{}
+
+force_inline
+int32_t simd<int32_t, 512, avx512_tag>::get(int pos) const
+{
+    return get_raw_ptr()[pos] ;
+};
+
+force_inline
+int32_t simd<int32_t, 512, avx512_tag>::first() const
+{
+    __m128i ds  = _mm512_castsi512_si128(data);
+    return _mm_cvtsi128_si32(ds);
+};
+
+force_inline
+void simd<int32_t, 512, avx512_tag>::set(int pos, int32_t val)
+{
+    get_raw_ptr()[pos] = val;
+};
+
+force_inline
+const int32_t* simd<int32_t, 512, avx512_tag>::get_raw_ptr() const
+{
+    return reinterpret_cast<const int32_t*>(&data);
+};
+
+force_inline
+int32_t* simd<int32_t, 512, avx512_tag>::get_raw_ptr()
+{
+    return reinterpret_cast<int32_t*>(&data);
+};
+
+force_inline simd<int32_t, 512, avx512_tag>::simd_half
+simd<int32_t, 512, avx512_tag>::extract_low() const
+{
+    return _mm512_castsi512_si256(data);
+}
+
+force_inline simd<int32_t, 512, avx512_tag>::simd_half
+simd<int32_t, 512, avx512_tag>::extract_high() const
+{
+    return _mm512_extracti64x4_epi64(data, 1);
+}
+
+template<int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8,
+         int I9, int I10, int I11, int I12, int I13, int I14, int I15, int I16>
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::select() const
+{
+    return this->reinterpret_as_float().select<I1, I2, I3, I4, I5, I6, I7, I8,
+                    I9, I10, I11, I12, I13, I14, I15, I16>().reinterpret_as_int32();
+}
+
+force_inline
+simd<int32_t, 512, avx512_tag> simd<int32_t, 512, avx512_tag>::zero()
+{
+    impl_type data  = _mm512_setzero_si512();
+    return data;
+}
+
+force_inline
+simd<int32_t, 512, avx512_tag> simd<int32_t, 512, avx512_tag>::one()
+{
+    return simd(1);
+}
+
+force_inline
+simd<int32_t, 512, avx512_tag> simd<int32_t, 512, avx512_tag>::minus_one()
+{
+    return simd(-1);
+}
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::load(const int32_t* arr, std::true_type aligned)
+{
+    (void)aligned;
+    return _mm512_load_si512((const void*)arr);
+};
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::load(const int32_t* arr, std::false_type not_aligned)
+{
+    (void)not_aligned;
+    return _mm512_loadu_si512((const void*)arr);
+};
+
+force_inline simd<int32_t, 512, avx512_tag> 
+simd<int32_t, 512, avx512_tag>::load_partial(const int32_t* arr, int n)
+{
+    __mmask16 mask    = __mmask16((1u << n) - 1);
+    return _mm512_maskz_loadu_epi32(mask, arr);
+};
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::gather(const int32_t* arr, const simd_int32& ind)
+{
+    return _mm512_i32gather_epi32(ind.data, arr, 4);
+}
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::gather(const int32_t* arr, const simd_int64& ind)
+{
+    return simd(simd_half(_mm512_i64gather_epi32(ind.data, arr, 4)), simd_half::zero());
+}
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::broadcast(const int32_t* arr)
+{
+    return _mm512_set1_epi32(*arr);
+};
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::broadcast(const int32_t& arr)
+{
+    return _mm512_set1_epi32(arr);
+};
+
+force_inline void simd<int32_t, 512, avx512_tag>::store(int32_t* arr, std::true_type aligned) const
+{
+    (void)aligned;
+    _mm512_store_si512((void*)arr, data);
+};
+
+force_inline void simd<int32_t, 512, avx512_tag>::store(int32_t* arr, std::false_type not_aligned) const
+{
+    (void)not_aligned;
+    _mm512_storeu_si512((void*)arr, data);
+};
+
+force_inline void simd<int32_t, 512, avx512_tag>::store_partial(int32_t* arr, int n) const
+{
+    __mmask16 mask    = __mmask16((1u << n) - 1);
+    _mm512_mask_storeu_epi32(arr, mask, data);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::convert_low_to_int64() const
+{
+    simd_half lo    = this->extract_low();
+    return _mm512_cvtepi32_epi64(lo.data);
+};
+
+force_inline
+simd<int64_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::convert_high_to_int64() const
+{
+    simd_half hi    = this->extract_high();
+    return _mm512_cvtepi32_epi64(hi.data);
+};
+
+force_inline simd<float, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::convert_to_float() const
+{
+    return _mm512_cvtepi32_ps(data);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::convert_low_to_double() const
+{
+    simd_half lo = this->extract_low();
+    return _mm512_cvtepi32_pd(lo.data);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::convert_high_to_double() const
+{
+    simd_half hi = this->extract_high();
+    return _mm512_cvtepi32_pd(hi.data);
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::reinterpret_as_double() const
+{
+    return _mm512_castsi512_pd(data);
+}
+
+force_inline simd<float, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::reinterpret_as_float() const
+{
+    return _mm512_castsi512_ps(data);
+}
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int32_t, 512, avx512_tag>::reinterpret_as_int64() const
+{
+    return data;
+}
+
+template<int Step>
+force_inline
+void simd<int32_t, 512, avx512_tag>::scatter(int32_t* arr) const
+{
+    const int32_t* ptr = get_raw_ptr();
+
+    // scatter instruction is not faster than scalar stores
+    arr[0*Step]     = ptr[0];
+    arr[1*Step]     = ptr[1];
+    arr[2*Step]     = ptr[2];
+    arr[3*Step]     = ptr[3];
+    arr[4*Step]     = ptr[4];
+    arr[5*Step]     = ptr[5];
+    arr[6*Step]     = ptr[6];
+    arr[7*Step]     = ptr[7];
+    arr[8*Step]     = ptr[8];
+    arr[9*Step]     = ptr[9];
+    arr[10*Step]    = ptr[10];
+    arr[11*Step]    = ptr[11];
+    arr[12*Step]    = ptr[12];
+    arr[13*Step]    = ptr[13];
+    arr[14*Step]    = ptr[14];
+    arr[15*Step]    = ptr[15];
+};
+
+force_inline simd<int32_t, 512, avx512_tag>&
+simd<int32_t, 512, avx512_tag>::operator+=(const simd& x)
+{
+    *this = *this + x;
+    return *this;
+}
+
+force_inline simd<int32_t, 512, avx512_tag>&
+simd<int32_t, 512, avx512_tag>::operator-=(const simd& x)
+{
+    *this = *this - x;
+    return *this;
+}
+
+force_inline simd<int32_t, 512, avx512_tag>&
+simd<int32_t, 512, avx512_tag>::operator*=(const simd& x)
+{
+    *this = *this * x;
+    return *this;
+}
+
+}}
@@ -0,0 +1,301 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/arch/avx512/simd_int64_512.h"
+
+namespace matcl { namespace simd
+{
+
+//-------------------------------------------------------------------
+//                          AVX512 INT64_T
+//-------------------------------------------------------------------
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(int32_t val)
+    : data(_mm512_set1_epi64(val))
+{}
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(int64_t val)
+    : data(_mm512_set1_epi64(val))
+{}
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(const simd_half& lo_hi)
+    : data(_mm512_inserti64x4(_mm512_castsi256_si512(lo_hi.data), lo_hi.data, 1))
+{}
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(int64_t v1, int64_t v2, int64_t v3, int64_t v4, int64_t v5,
+                                     int64_t v6, int64_t v7, int64_t v8)
+    : data(_mm512_set_epi64(v8, v7, v6, v5, v4, v3, v2, v1))
+{}
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(const simd_half& lo, const simd_half& hi)
+    : data(_mm512_inserti64x4(_mm512_castsi256_si512(lo.data), hi.data, 1))
+{}
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(const impl_type& v)
+    : data(v)
+{};
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(const simd<int64_t, 128, scalar_sse_tag>& s)
+    : data(_mm512_broadcastq_epi64(s.data))
+{}
+
+force_inline
+simd<int64_t, 512, avx512_tag>::simd(const simd<int64_t, 128, scalar_nosimd_tag>& s)
+    :simd(s.first())
+{}
+
+force_inline
+int64_t simd<int64_t, 512, avx512_tag>::get(int pos) const
+{
+    return get_raw_ptr()[pos] ;
+};
+
+force_inline
+int64_t simd<int64_t, 512, avx512_tag>::first() const
+{
+    __m128i ds  = _mm512_castsi512_si128(data);
+    return missing::mm_cvtsi128_si64(ds);
+};
+
+force_inline
+void simd<int64_t, 512, avx512_tag>::set(int pos, int64_t val)
+{
+    get_raw_ptr()[pos] = val;
+};
+
+force_inline
+const int64_t* simd<int64_t, 512, avx512_tag>::get_raw_ptr() const
+{
+    return reinterpret_cast<const int64_t*>(&data);
+};
+
+force_inline
+int64_t* simd<int64_t, 512, avx512_tag>::get_raw_ptr()
+{
+    return reinterpret_cast<int64_t*>(&data);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>::simd_half
+simd<int64_t, 512, avx512_tag>::extract_low() const
+{
+    return _mm512_castsi512_si256(data);
+}
+
+force_inline simd<int64_t, 512, avx512_tag>::simd_half
+simd<int64_t, 512, avx512_tag>::extract_high() const
+{
+    return _mm512_extracti64x4_epi64(data, 1);
+}
+
+template<int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8>
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::select() const
+{
+    return this->reinterpret_as_double().select<I1, I2, I3, I4, I5, I6, I7, I8>()
+                    .reinterpret_as_int64();
+};
+
+force_inline
+simd<int64_t, 512, avx512_tag> simd<int64_t, 512, avx512_tag>::zero()
+{
+    impl_type data  = _mm512_setzero_si512();
+    return data;
+}
+
+force_inline
+simd<int64_t, 512, avx512_tag> simd<int64_t, 512, avx512_tag>::one()
+{
+    return simd(1);
+}
+
+force_inline
+simd<int64_t, 512, avx512_tag> simd<int64_t, 512, avx512_tag>::minus_one()
+{
+    return simd(-1);
+}
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::load(const int64_t* arr, std::true_type aligned)
+{
+    (void)aligned;
+    return _mm512_load_si512((const void*)arr);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::load(const int64_t* arr, std::false_type not_aligned)
+{
+    (void)not_aligned;
+    return _mm512_loadu_si512((const void*)arr);
+};
+
+force_inline simd<int64_t, 512, avx512_tag> 
+simd<int64_t, 512, avx512_tag>::load_partial(const int64_t* arr, int n)
+{
+    __mmask8 mask    = __mmask8((1u << n) - 1);
+    return _mm512_maskz_loadu_epi64(mask, arr);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::gather(const int64_t* arr, const simd_int32_half& ind)
+{
+    return _mm512_i32gather_epi64(ind.data, arr, 8);
+}
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::gather(const int64_t* arr, const simd_int32& ind)
+{
+    return gather(arr, ind.extract_low());
+}
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::gather(const int64_t* arr, const simd_int64& ind)
+{
+    return _mm512_i64gather_epi64(ind.data, arr, 8);
+}
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::broadcast(const int64_t* arr)
+{
+    return _mm512_set1_epi64(*arr);
+};
+
+force_inline simd<int64_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::broadcast(const int64_t& arr)
+{
+    return _mm512_set1_epi64(arr);
+};
+
+force_inline void
+simd<int64_t, 512, avx512_tag>::store(int64_t* arr, std::true_type aligned) const
+{
+    (void)aligned;
+    _mm512_store_si512((void*)arr, data);
+};
+
+force_inline void
+simd<int64_t, 512, avx512_tag>::store(int64_t* arr, std::false_type not_aligned) const
+{
+    (void)not_aligned;
+    _mm512_storeu_si512((void*)arr, data);
+};
+
+force_inline void 
+simd<int64_t, 512, avx512_tag>::store_partial(int64_t* arr, int n) const
+{
+    __mmask8 mask    = __mmask8((1u << n) - 1);
+    _mm512_mask_storeu_epi64(arr, mask, data);
+};
+
+force_inline simd<int32_t, 256, avx_tag>
+simd<int64_t, 512, avx512_tag>::convert_to_int32() const
+{
+    return _mm512_cvtepi64_epi32(data);
+};
+
+force_inline simd<float, 256, avx_tag>
+simd<int64_t, 512, avx512_tag>::convert_to_float() const
+{
+    #if MATCL_ARCHITECTURE_HAS_AVX512DQ
+        return _mm512_cvtepi64_ps(data);
+    #else
+        simd<float, 256, avx_tag>  res;
+
+        float* res_ptr      = res.get_raw_ptr();
+        const int64_t* ptr  = this->get_raw_ptr();
+
+        for (int i = 0; i < vector_size; ++i)
+            res_ptr[i]  = scalar_func::convert_int64_float(ptr[i]);
+
+        return res;
+    #endif
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::convert_to_double() const
+{
+    #if MATCL_ARCHITECTURE_HAS_AVX512DQ
+        return _mm512_cvtepi64_pd(data);
+    #else
+        simd<double, 512, avx512_tag> ret;
+
+        double* ret_ptr     = ret.get_raw_ptr();
+        const int64_t* ptr  = this->get_raw_ptr();
+
+        for (int i = 0; i < vector_size; ++i)
+            ret_ptr[i]      = scalar_func::convert_int64_double(ptr[i]);
+
+        return ret;
+    #endif
+};
+
+force_inline simd<double, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::reinterpret_as_double() const
+{
+    return _mm512_castsi512_pd(data);
+}
+
+force_inline simd<float, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::reinterpret_as_float() const
+{
+    return _mm512_castsi512_ps(data);
+}
+
+force_inline simd<int32_t, 512, avx512_tag>
+simd<int64_t, 512, avx512_tag>::reinterpret_as_int32() const
+{
+    return data;
+};
+
+template<int Step>
+force_inline
+void simd<int64_t, 512, avx512_tag>::scatter(int64_t* arr) const
+{
+    const int64_t* ptr = get_raw_ptr();
+
+    // scatter instruction is not faster than scalar stores
+    arr[0*Step] = ptr[0];
+    arr[1*Step] = ptr[1];
+    arr[2*Step] = ptr[2];
+    arr[3*Step] = ptr[3];
+    arr[4*Step] = ptr[4];
+    arr[5*Step] = ptr[5];
+    arr[6*Step] = ptr[6];
+    arr[7*Step] = ptr[7];
+};
+
+force_inline simd<int64_t, 512, avx512_tag>&
+simd<int64_t, 512, avx512_tag>::operator+=(const simd& x)
+{
+    *this = *this + x;
+    return *this;
+}
+
+force_inline simd<int64_t, 512, avx512_tag>&
+simd<int64_t, 512, avx512_tag>::operator-=(const simd& x)
+{
+    *this = *this - x;
+    return *this;
+}
+
+force_inline simd<int64_t, 512, avx512_tag>&
+simd<int64_t, 512, avx512_tag>::operator*=(const simd& x)
+{
+    *this = *this * x;
+    return *this;
+}
+
+}}
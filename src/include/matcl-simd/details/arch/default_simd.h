@@ -10,7 +10,9 @@
 
 #include "matcl-simd/config.h"
 
-#if MATCL_ARCHITECTURE_HAS_AVX
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    #include "matcl-simd/details/arch/avx512/default_simd_impl.h"
+#elif MATCL_ARCHITECTURE_HAS_AVX
     #include "matcl-simd/details/arch/avx/default_simd_impl.h"
 #elif MATCL_ARCHITECTURE_HAS_SSE2
     #include "matcl-simd/details/arch/sse/default_simd_impl.h"
@@ -39,6 +39,30 @@ struct simd_mult<T, Bits, scalar_nosimd_tag>
     };
 };
 
+template<class T, int Bits>
+struct simd_mulh<T, Bits, scalar_nosimd_tag>
+{
+    using simd_type = simd<T, Bits, scalar_nosimd_tag>;
+    
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_type(scalar_func::mulh(x.data, y.data));
+    };
+};
+
+template<class T, int Bits>
+struct simd_mulhu<T, Bits, scalar_nosimd_tag>
+{
+    using simd_type = simd<T, Bits, scalar_nosimd_tag>;
+    
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_type(scalar_func::mulhu(x.data, y.data));
+    };
+};
+
 template<class T, int Bits>
 struct simd_div<T, Bits, scalar_nosimd_tag>
 {
@@ -116,6 +116,46 @@ struct simd_mult<T, Bits, nosimd_tag>
     };
 };
 
+template<class T, int Bits>
+struct simd_mulh<T, Bits, nosimd_tag>
+{
+    using simd_type = simd<T, Bits, nosimd_tag>;
+    
+    static const int 
+    vector_size     = simd_type::vector_size;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        simd_type res;
+
+        for (int i = 0; i < vector_size; ++i)
+            res.data[i] = scalar_func::mulh(x.data[i], y.data[i]);
+
+        return res;
+    };
+};
+
+template<class T, int Bits>
+struct simd_mulhu<T, Bits, nosimd_tag>
+{
+    using simd_type = simd<T, Bits, nosimd_tag>;
+    
+    static const int 
+    vector_size     = simd_type::vector_size;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        simd_type res;
+
+        for (int i = 0; i < vector_size; ++i)
+            res.data[i] = scalar_func::mulhu(x.data[i], y.data[i]);
+
+        return res;
+    };
+};
+
 template<class T, int Bits>
 struct simd_div<T, Bits, nosimd_tag>
 {
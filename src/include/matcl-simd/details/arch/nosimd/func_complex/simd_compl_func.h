@@ -115,6 +115,26 @@ struct simd_compl_mult<T, Bits, nosimd_tag>
         return res;
     };
 
+    // (x.re * y.re - x.im * y.im,  x.re * y.im + x.re * y.im)
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        simd_type res;
+
+        for (int i = 0; i < 2*vector_size; i += 2)
+        {
+            T x_re  = x.data.data[i];
+            T x_im  = x.data.data[i+1];
+            T y_re  = y.data.data[i];
+            T y_im  = y.data.data[i+1];
+
+            res.data.data[i]    = x_re * y_re - x_im * y_im;
+            res.data.data[i+1]  = x_re * y_im + x_im * y_re;
+        };
+
+        return res;
+    };
+
     force_inline
     static simd_type eval_rc(const simd_real_type& x, const simd_type& y)
     {
@@ -164,6 +184,28 @@ struct simd_compl_div<T, Bits, nosimd_tag>
         return res;
     };
 
+    // fast division: x * conj(y) / |y|^2 without overflow checks and NaN
+    // recovery
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        simd_type res;
+
+        for (int i = 0; i < 2*vector_size; i += 2)
+        {
+            T x_re  = x.data.data[i];
+            T x_im  = x.data.data[i+1];
+            T y_re  = y.data.data[i];
+            T y_im  = y.data.data[i+1];
+            T r     = T(1) / (y_re * y_re + y_im * y_im);
+
+            res.data.data[i]    = (x_re * y_re + x_im * y_im) * r;
+            res.data.data[i+1]  = (x_im * y_re - x_re * y_im) * r;
+        };
+
+        return res;
+    };
+
     force_inline
     static simd_type eval_rc(const simd_real& x, const simd_type& y)
     {
@@ -276,4 +318,43 @@ struct simd_compl_horizontal_sum<T, Bits, nosimd_tag>
     };
 };
 
+template<class T, int Bits>
+struct simd_compl_split_shuffle<T, Bits, nosimd_tag>
+{
+    using simd_type     = simd<T, Bits, nosimd_tag>;
+    
+    static const int 
+    vector_size         = simd_type::vector_size;
+
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        static const int half = vector_size / 2;
+
+        for (int i = 0; i < half; ++i)
+        {
+            re.data[i]          = a.data[2*i + 0];
+            im.data[i]          = a.data[2*i + 1];
+            re.data[i + half]   = b.data[2*i + 0];
+            im.data[i + half]   = b.data[2*i + 1];
+        }
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        static const int half = vector_size / 2;
+
+        for (int i = 0; i < half; ++i)
+        {
+            a.data[2*i + 0]     = re.data[i];
+            a.data[2*i + 1]     = im.data[i];
+            b.data[2*i + 0]     = re.data[i + half];
+            b.data[2*i + 1]     = im.data[i + half];
+        }
+    };
+};
+
 }}}
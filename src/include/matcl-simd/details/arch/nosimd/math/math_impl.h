@@ -64,11 +64,1283 @@ struct simd_exp<float, Bits, nosimd_tag>
     };
 };
 
+//-----------------------------------------------------------------------
+//                          exp2/exp10/expm1
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_exp2<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::exp2(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_exp2<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::exp2(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_exp10<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::exp10(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_exp10<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::exp10(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_expm1<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::expm1(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_expm1<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::expm1(ptr_a[i]);
+
+        return res;
+    };
+};
+
 //-----------------------------------------------------------------------
 //                          log
 //-----------------------------------------------------------------------
 template<int Bits>
-struct simd_log<double, Bits, nosimd_tag>
+struct simd_log<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_log<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log(ptr_a[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          log2/log10/log1p
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_log2<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log2(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_log2<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log2(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_log10<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log10(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_log10<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log10(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_log1p<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log1p(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_log1p<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::log1p(ptr_a[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          pow
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_pow<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_x = x.get_raw_ptr();
+        const double* ptr_y = y.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::pow(ptr_x[i], ptr_y[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_pow<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_x  = x.get_raw_ptr();
+        const float* ptr_y  = y.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::pow(ptr_x[i], ptr_y[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          atan/atan2/asin/acos
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_atan<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::atan(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_atan<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::atan(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_atan2<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& y, const simd_type& x)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_y = y.get_raw_ptr();
+        const double* ptr_x = x.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::atan2(ptr_y[i], ptr_x[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_atan2<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& y, const simd_type& x)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_y  = y.get_raw_ptr();
+        const float* ptr_x  = x.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::atan2(ptr_y[i], ptr_x[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_asin<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::asin(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_asin<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::asin(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_acos<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::acos(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_acos<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::acos(ptr_a[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          sinh/cosh/tanh/sigmoid/softplus
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_sinh<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::sinh(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_sinh<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::sinh(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_cosh<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::cosh(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_cosh<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::cosh(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_tanh<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::tanh(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_tanh<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::tanh(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_sigmoid<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::sigmoid(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_sigmoid<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::sigmoid(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_softplus<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::softplus(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_softplus<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::softplus(ptr_a[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          erf/erfc/normcdf/norminv
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_erf<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::erf(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_erf<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::erf(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_erfc<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::erfc(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_erfc<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::erfc(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_normcdf<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::normcdf(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_normcdf<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::normcdf(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_norminv<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::norminv(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_norminv<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::norminv(ptr_a[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          rcp/rsqrt/cbrt/hypot
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_rcp_approx<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rcp_approx(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rcp_approx<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rcp_approx(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rcp<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rcp(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rcp<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rcp(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rsqrt_approx<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rsqrt_approx(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rsqrt_approx<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rsqrt_approx(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rsqrt<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rsqrt(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_rsqrt<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::rsqrt(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_cbrt<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::cbrt(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_cbrt<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::cbrt(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_hypot<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_x = x.get_raw_ptr();
+        const double* ptr_y = y.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::hypot(ptr_x[i], ptr_y[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_hypot<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_x  = x.get_raw_ptr();
+        const float* ptr_y  = y.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::hypot(ptr_x[i], ptr_y[i]);
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          lgamma/tgamma/digamma
+//-----------------------------------------------------------------------
+template<int Bits>
+struct simd_lgamma<double, Bits, nosimd_tag>
 {
     using simd_type     = simd<double, Bits, nosimd_tag>;
 
@@ -84,14 +1356,14 @@ struct simd_log<double, Bits, nosimd_tag>
         double* ptr_res     = res.get_raw_ptr();
 
         for (int i = 0; i < vec_size; ++i)
-            ptr_res[i]      = ms::log(ptr_a[i]);
+            ptr_res[i]      = ms::lgamma(ptr_a[i]);
 
         return res;
     };
 };
 
 template<int Bits>
-struct simd_log<float, Bits, nosimd_tag>
+struct simd_lgamma<float, Bits, nosimd_tag>
 {
     using simd_type     = simd<float, Bits, nosimd_tag>;
 
@@ -107,7 +1379,99 @@ struct simd_log<float, Bits, nosimd_tag>
         float* ptr_res      = res.get_raw_ptr();
 
         for (int i = 0; i < vec_size; ++i)
-            ptr_res[i]      = ms::log(ptr_a[i]);
+            ptr_res[i]      = ms::lgamma(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_tgamma<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::tgamma(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_tgamma<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::tgamma(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_digamma<double, Bits, nosimd_tag>
+{
+    using simd_type     = simd<double, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_res     = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::digamma(ptr_a[i]);
+
+        return res;
+    };
+};
+
+template<int Bits>
+struct simd_digamma<float, Bits, nosimd_tag>
+{
+    using simd_type     = simd<float, Bits, nosimd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        simd_type res;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_res      = res.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ptr_res[i]      = ms::digamma(ptr_a[i]);
 
         return res;
     };
@@ -340,6 +1704,20 @@ struct simd_sincos<double, Bits, nosimd_tag>
 
         return res;
     };
+
+    force_inline
+    static void eval_sincos_both(const simd_type& a, simd_type& ret_s, simd_type& ret_c)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        const double* ptr_a = a.get_raw_ptr();
+        double* ptr_s       = ret_s.get_raw_ptr();
+        double* ptr_c       = ret_c.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ms::sincos(ptr_a[i], ptr_s[i], ptr_c[i]);
+    };
 };
 
 template<int Bits>
@@ -380,6 +1758,20 @@ struct simd_sincos<float, Bits, nosimd_tag>
 
         return res;
     };
+
+    force_inline
+    static void eval_sincos_both(const simd_type& a, simd_type& ret_s, simd_type& ret_c)
+    {
+        static const 
+        int vec_size    = simd_type::vector_size;
+
+        const float* ptr_a  = a.get_raw_ptr();
+        float* ptr_s        = ret_s.get_raw_ptr();
+        float* ptr_c        = ret_c.get_raw_ptr();
+
+        for (int i = 0; i < vec_size; ++i)
+            ms::sincos(ptr_a[i], ptr_s[i], ptr_c[i]);
+    };
 };
 
 //-----------------------------------------------------------------------
@@ -300,6 +300,17 @@ simd<double, 128, nosimd_tag>::load(const double* arr, std::false_type not_align
     return ret;
 };
 
+force_inline simd<double, 128, nosimd_tag> 
+simd<double, 128, nosimd_tag>::load_partial(const double* arr, int n)
+{
+    simd<double, 128, nosimd_tag> ret = zero();
+
+    for (int i = 0; i < n; ++i)
+        ret.data[i] = arr[i];
+
+    return ret;
+};
+
 force_inline simd<double, 128, nosimd_tag> 
 simd<double, 128, nosimd_tag>::gather(const double* arr, const simd_int32& ind)
 {
@@ -336,6 +347,13 @@ simd<double, 128, nosimd_tag>::store(double* arr, std::false_type not_aligned) c
     arr[1] = data[1];
 };
 
+force_inline void 
+simd<double, 128, nosimd_tag>::store_partial(double* arr, int n) const
+{
+    for (int i = 0; i < n; ++i)
+        arr[i]  = data[i];
+};
+
 template<int Step>
 force_inline
 void simd<double, 128, nosimd_tag>::scatter(double* arr) const
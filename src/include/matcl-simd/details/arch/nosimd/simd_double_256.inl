@@ -234,6 +234,17 @@ simd<double, 256, nosimd_tag>::load(const double* arr, std::false_type not_align
     return ret;
 };
 
+force_inline simd<double, 256, nosimd_tag> 
+simd<double, 256, nosimd_tag>::load_partial(const double* arr, int n)
+{
+    simd<double, 256, nosimd_tag> ret = zero();
+
+    for (int i = 0; i < n; ++i)
+        ret.data[i] = arr[i];
+
+    return ret;
+};
+
 force_inline simd<double, 256, nosimd_tag> 
 simd<double, 256, nosimd_tag>::gather(const double* arr, const simd_int32_half& ind)
 {
@@ -314,6 +325,13 @@ simd<double, 256, nosimd_tag>::store(double* arr, std::false_type not_aligned) c
     arr[3]  = data[3];
 };
 
+force_inline void 
+simd<double, 256, nosimd_tag>::store_partial(double* arr, int n) const
+{
+    for (int i = 0; i < n; ++i)
+        arr[i]  = data[i];
+};
+
 force_inline
 simd<float, 128, nosimd_tag>
 simd<double, 256, nosimd_tag>::convert_to_float() const
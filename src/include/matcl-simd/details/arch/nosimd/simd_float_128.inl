@@ -202,6 +202,17 @@ simd<float, 128, nosimd_tag>::load(const float* arr, std::false_type not_aligned
     return ret;
 };
 
+force_inline simd<float, 128, nosimd_tag> 
+simd<float, 128, nosimd_tag>::load_partial(const float* arr, int n)
+{
+    simd<float, 128, nosimd_tag> ret = zero();
+
+    for (int i = 0; i < n; ++i)
+        ret.data[i] = arr[i];
+
+    return ret;
+};
+
 force_inline simd<float, 128, nosimd_tag>
 simd<float, 128, nosimd_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -425,6 +436,13 @@ simd<float, 128, nosimd_tag>::store(float* arr, std::false_type not_aligned) con
     arr[3] = data[3];
 };
 
+force_inline void 
+simd<float, 128, nosimd_tag>::store_partial(float* arr, int n) const
+{
+    for (int i = 0; i < n; ++i)
+        arr[i]  = data[i];
+};
+
 template<int Step>
 force_inline
 void simd<float, 128, nosimd_tag>::scatter(float* arr) const
@@ -273,6 +273,17 @@ simd<float, 256, nosimd_tag>::load(const float* arr, std::false_type not_aligned
     return ret;
 };
 
+force_inline simd<float, 256, nosimd_tag> 
+simd<float, 256, nosimd_tag>::load_partial(const float* arr, int n)
+{
+    simd<float, 256, nosimd_tag> ret = zero();
+
+    for (int i = 0; i < n; ++i)
+        ret.data[i] = arr[i];
+
+    return ret;
+};
+
 force_inline simd<float, 256, nosimd_tag> 
 simd<float, 256, nosimd_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -370,6 +381,13 @@ simd<float, 256, nosimd_tag>::store(float* arr, std::false_type not_aligned) con
     arr[7] = data[7];
 };
 
+force_inline void 
+simd<float, 256, nosimd_tag>::store_partial(float* arr, int n) const
+{
+    for (int i = 0; i < n; ++i)
+        arr[i]  = data[i];
+};
+
 force_inline simd<double, 256, nosimd_tag>
 simd<float, 256, nosimd_tag>::convert_low_to_double() const
 {
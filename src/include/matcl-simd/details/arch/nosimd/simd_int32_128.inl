@@ -188,6 +188,17 @@ simd<int32_t, 128, nosimd_tag>::load(const int32_t* arr, std::false_type not_ali
     return ret;
 };
 
+force_inline simd<int32_t, 128, nosimd_tag> 
+simd<int32_t, 128, nosimd_tag>::load_partial(const int32_t* arr, int n)
+{
+    simd<int32_t, 128, nosimd_tag> ret = zero();
+
+    for (int i = 0; i < n; ++i)
+        ret.data[i] = arr[i];
+
+    return ret;
+};
+
 force_inline simd<int32_t, 128, nosimd_tag>
 simd<int32_t, 128, nosimd_tag>::gather(const int32_t* arr, const simd_int32& ind)
 {
@@ -409,6 +420,13 @@ simd<int32_t, 128, nosimd_tag>::store(int32_t* arr, std::false_type not_aligned)
     arr[3] = data[3];
 };
 
+force_inline void 
+simd<int32_t, 128, nosimd_tag>::store_partial(int32_t* arr, int n) const
+{
+    for (int i = 0; i < n; ++i)
+        arr[i]  = data[i];
+};
+
 template<int Step>
 force_inline
 void simd<int32_t, 128, nosimd_tag>::scatter(int32_t* arr) const
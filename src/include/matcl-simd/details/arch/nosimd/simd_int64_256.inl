@@ -212,6 +212,17 @@ simd<int64_t, 256, nosimd_tag>::load(const int64_t* arr, std::false_type not_ali
     return ret;
 };
 
+force_inline simd<int64_t, 256, nosimd_tag> 
+simd<int64_t, 256, nosimd_tag>::load_partial(const int64_t* arr, int n)
+{
+    simd<int64_t, 256, nosimd_tag> ret = zero();
+
+    for (int i = 0; i < n; ++i)
+        ret.data[i] = arr[i];
+
+    return ret;
+};
+
 force_inline simd<int64_t, 256, nosimd_tag> 
 simd<int64_t, 256, nosimd_tag>::gather(const int64_t* arr, const simd_int32_half& ind)
 {
@@ -292,6 +303,13 @@ simd<int64_t, 256, nosimd_tag>::store(int64_t* arr, std::false_type not_aligned)
     arr[3]  = data[3];
 };
 
+force_inline void 
+simd<int64_t, 256, nosimd_tag>::store_partial(int64_t* arr, int n) const
+{
+    for (int i = 0; i < n; ++i)
+        arr[i]  = data[i];
+};
+
 force_inline
 simd<int32_t, 128, nosimd_tag>
 simd<int64_t, 256, nosimd_tag>::convert_to_int32() const
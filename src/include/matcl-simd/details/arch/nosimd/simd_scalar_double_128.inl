@@ -188,6 +188,15 @@ simd<double, 128, scalar_nosimd_tag>::load(const double* arr, std::false_type no
     return simd(arr[0]);
 };
 
+force_inline simd<double, 128, scalar_nosimd_tag> 
+simd<double, 128, scalar_nosimd_tag>::load_partial(const double* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<double, 128, scalar_nosimd_tag> 
 simd<double, 128, scalar_nosimd_tag>::gather(const double* arr, const simd_int32& ind)
 {
@@ -214,6 +223,15 @@ simd<double, 128, scalar_nosimd_tag>::store(double* arr, std::false_type not_ali
     arr[0] = data;
 };
 
+force_inline void 
+simd<double, 128, scalar_nosimd_tag>::store_partial(double* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 template<int Step>
 force_inline
 void simd<double, 128, scalar_nosimd_tag>::scatter(double* arr) const
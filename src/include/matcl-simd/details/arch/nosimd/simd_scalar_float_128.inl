@@ -120,6 +120,15 @@ simd<float, 128, scalar_nosimd_tag>::load(const float* arr, std::false_type not_
     return simd(arr[0]);
 };
 
+force_inline simd<float, 128, scalar_nosimd_tag> 
+simd<float, 128, scalar_nosimd_tag>::load_partial(const float* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<float, 128, scalar_nosimd_tag>
 simd<float, 128, scalar_nosimd_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -198,6 +207,15 @@ simd<float, 128, scalar_nosimd_tag>::store(float* arr, std::false_type not_align
     arr[0] = data;
 };
 
+force_inline void 
+simd<float, 128, scalar_nosimd_tag>::store_partial(float* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 template<int Step>
 force_inline
 void simd<float, 128, scalar_nosimd_tag>::scatter(float* arr) const
@@ -116,6 +116,15 @@ simd<int32_t, 128, scalar_nosimd_tag>::load(const int32_t* arr, std::false_type
     return simd(arr[0]);
 };
 
+force_inline simd<int32_t, 128, scalar_nosimd_tag> 
+simd<int32_t, 128, scalar_nosimd_tag>::load_partial(const int32_t* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<int32_t, 128, scalar_nosimd_tag>
 simd<int32_t, 128, scalar_nosimd_tag>::gather(const int32_t* arr, const simd_int32& ind)
 {
@@ -193,6 +202,15 @@ simd<int32_t, 128, scalar_nosimd_tag>::store(int32_t* arr, std::false_type not_a
     arr[0] = data;
 };
 
+force_inline void 
+simd<int32_t, 128, scalar_nosimd_tag>::store_partial(int32_t* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 template<int Step>
 force_inline
 void simd<int32_t, 128, scalar_nosimd_tag>::scatter(int32_t* arr) const
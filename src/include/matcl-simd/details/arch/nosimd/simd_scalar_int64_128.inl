@@ -171,6 +171,15 @@ simd<int64_t, 128, scalar_nosimd_tag>::load(const int64_t* arr, std::false_type
     return simd(arr[0]);
 };
 
+force_inline simd<int64_t, 128, scalar_nosimd_tag> 
+simd<int64_t, 128, scalar_nosimd_tag>::load_partial(const int64_t* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<int64_t, 128, scalar_nosimd_tag> 
 simd<int64_t, 128, scalar_nosimd_tag>::gather(const int64_t* arr, const simd_int32& ind)
 {
@@ -197,6 +206,15 @@ simd<int64_t, 128, scalar_nosimd_tag>::store(int64_t* arr, std::false_type not_a
     arr[0] = data;
 };
 
+force_inline void 
+simd<int64_t, 128, scalar_nosimd_tag>::store_partial(int64_t* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 template<int Step>
 force_inline
 void simd<int64_t, 128, scalar_nosimd_tag>::scatter(int64_t* arr) const
@@ -21,4 +21,8 @@
 #if MATCL_ARCHITECTURE_HAS_AVX
     #include "matcl-simd/details/arch/avx/func_complex/simd_float_256_func.h"
     #include "matcl-simd/details/arch/avx/func_complex/simd_double_256_func.h"
-#endif
\ No newline at end of file
+#endif
+
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    #include "matcl-simd/details/arch/avx512/func_complex/simd_compl_split_func.h"
+#endif
@@ -21,6 +21,7 @@
 
     #include "matcl-simd/details/arch/sse/func/simd_256_func.h"
     #include "matcl-simd/details/arch/sse/func/simd_128_scalar_func.h"
+    #include "matcl-simd/details/arch/sse/func/simd_mask_func.h"
 #endif
 
 #if MATCL_ARCHITECTURE_HAS_AVX
@@ -28,4 +29,13 @@
     #include "matcl-simd/details/arch/avx/func/simd_double_256_func.h"
     #include "matcl-simd/details/arch/avx/func/simd_int32_256_func.h"
     #include "matcl-simd/details/arch/avx/func/simd_int64_256_func.h"
+    #include "matcl-simd/details/arch/avx/func/simd_mask_func.h"
+#endif
+
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    #include "matcl-simd/details/arch/avx512/func/simd_float_512_func.h"
+    #include "matcl-simd/details/arch/avx512/func/simd_double_512_func.h"
+    #include "matcl-simd/details/arch/avx512/func/simd_int32_512_func.h"
+    #include "matcl-simd/details/arch/avx512/func/simd_int64_512_func.h"
+    #include "matcl-simd/details/arch/avx512/func/simd_mask_func.h"
 #endif
@@ -47,4 +47,11 @@
     #include "matcl-simd/arch/avx/simd_float_256.h"
     #include "matcl-simd/arch/avx/simd_int32_256.h"
     #include "matcl-simd/arch/avx/simd_int64_256.h"
+#endif
+
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    #include "matcl-simd/arch/avx512/simd_double_512.h"
+    #include "matcl-simd/arch/avx512/simd_float_512.h"
+    #include "matcl-simd/arch/avx512/simd_int32_512.h"
+    #include "matcl-simd/arch/avx512/simd_int64_512.h"
 #endif
\ No newline at end of file
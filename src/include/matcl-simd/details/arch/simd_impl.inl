@@ -49,4 +49,11 @@
     #include "matcl-simd/details/arch/avx/simd_int64_256.inl"
 #endif
 
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    #include "matcl-simd/details/arch/avx512/simd_double_512.inl"
+    #include "matcl-simd/details/arch/avx512/simd_float_512.inl"
+    #include "matcl-simd/details/arch/avx512/simd_int32_512.inl"
+    #include "matcl-simd/details/arch/avx512/simd_int64_512.inl"
+#endif
+
 #include "matcl-simd/details/func/general_defs.h"
\ No newline at end of file
@@ -23,7 +23,11 @@
     #include "nmmintrin.h"
 #endif
 
-namespace matcl { namespace simd { namespace missing
+namespace matcl { namespace simd
+{
+
+// SSE4.1 and SSE4.2 instructions are used if available
+inline namespace MATCL_SIMD_ISA_NAMESPACE { namespace missing
 {
 
 // move the upper double-precision (64-bit) floating-point element from b
@@ -279,4 +283,6 @@ int64_t mm_cvtsi128_si64(__m128i a)
     #endif
 };
 
-}}}
+}}
+
+}}
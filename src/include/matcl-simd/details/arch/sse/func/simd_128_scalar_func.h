@@ -67,6 +67,30 @@ struct simd_mult<int64_t, 128, scalar_sse_tag>
     };
 };
 
+template<class T>
+struct simd_mulh<T, 128, scalar_sse_tag>
+{
+    using simd_type = simd<T, 128, scalar_sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_type(scalar_func::mulh(x.first(), y.first()));
+    };
+};
+
+template<class T>
+struct simd_mulhu<T, 128, scalar_sse_tag>
+{
+    using simd_type = simd<T, 128, scalar_sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_type(scalar_func::mulhu(x.first(), y.first()));
+    };
+};
+
 template<class T>
 struct simd_div<T, 128, scalar_sse_tag>
 {
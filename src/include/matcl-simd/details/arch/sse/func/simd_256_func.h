@@ -40,6 +40,30 @@ struct simd_mult<T, 256, sse_tag>
     };
 };
 
+template<class T>
+struct simd_mulh<T, 256, sse_tag>
+{
+    using simd_type = simd<T, 256, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_type(mulh(x.data[0], y.data[0]), mulh(x.data[1], y.data[1]));
+    };
+};
+
+template<class T>
+struct simd_mulhu<T, 256, sse_tag>
+{
+    using simd_type = simd<T, 256, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_type(mulhu(x.data[0], y.data[0]), mulhu(x.data[1], y.data[1]));
+    };
+};
+
 template<class T>
 struct simd_div<T, 256, sse_tag>
 {
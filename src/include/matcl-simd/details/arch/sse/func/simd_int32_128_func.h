@@ -64,6 +64,56 @@ struct simd_mult<int32_t, 128, sse_tag>
     };
 };
 
+template<>
+struct simd_mulhu<int32_t, 128, sse_tag>
+{
+    using simd_type = simd<int32_t, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // (xy0_lo, xy0_hi, xy2_lo, xy2_hi)
+        __m128i prod02  = _mm_mul_epu32(x.data, y.data);
+
+        // (xy1_lo, xy1_hi, xy3_lo, xy3_hi)
+        __m128i prod13  = _mm_mul_epu32(_mm_srli_epi64(x.data, 32), _mm_srli_epi64(y.data, 32));
+
+        // (xy0_hi, xy1_hi, xy2_hi, xy3_hi)
+        __m128i mask_hi = _mm_setr_epi32(0, -1, 0, -1);
+        return _mm_or_si128(_mm_srli_epi64(prod02, 32), _mm_and_si128(prod13, mask_hi));
+    };
+};
+
+template<>
+struct simd_mulh<int32_t, 128, sse_tag>
+{
+    using simd_type = simd<int32_t, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        #if MATCL_ARCHITECTURE_HAS_SSE41
+            // (xy0_lo, xy0_hi, xy2_lo, xy2_hi)
+            __m128i prod02  = _mm_mul_epi32(x.data, y.data);
+
+            // (xy1_lo, xy1_hi, xy3_lo, xy3_hi)
+            __m128i prod13  = _mm_mul_epi32(_mm_srli_epi64(x.data, 32), 
+                                            _mm_srli_epi64(y.data, 32));
+
+            // (xy0_hi, xy1_hi, xy2_hi, xy3_hi)
+            return _mm_blend_epi16(_mm_srli_epi64(prod02, 32), prod13, 0xCC);
+        #else
+            // signed high part is equal to the unsigned high part minus y if
+            // x < 0 and minus x if y < 0
+            __m128i res     = simd_mulhu<int32_t, 128, sse_tag>::eval(x, y).data;
+            __m128i corr_x  = _mm_and_si128(_mm_srai_epi32(x.data, 31), y.data);
+            __m128i corr_y  = _mm_and_si128(_mm_srai_epi32(y.data, 31), x.data);
+
+            return _mm_sub_epi32(res, _mm_add_epi32(corr_x, corr_y));
+        #endif
+    };
+};
+
 template<>
 struct simd_plus<int32_t, 128, sse_tag>
 {
@@ -36,7 +36,10 @@ struct simd_mult<int64_t, 128, sse_tag>
     force_inline
     static simd_type eval(const simd_type& x, const simd_type& y)
     {
-        #if MATCL_ARCHITECTURE_HAS_SSE41
+        #if MATCL_ARCHITECTURE_HAS_AVX512F && MATCL_ARCHITECTURE_HAS_AVX512DQ \
+                && MATCL_ARCHITECTURE_HAS_AVX512VL
+            return _mm_mullo_epi64(x.data, y.data);
+        #elif MATCL_ARCHITECTURE_HAS_SSE41
             // split into 32-bit multiplies
 
             __m128i zero    = _mm_setzero_si128();
@@ -72,6 +75,60 @@ struct simd_mult<int64_t, 128, sse_tag>
     };
 };
 
+template<>
+struct simd_mulhu<int64_t, 128, sse_tag>
+{
+    using simd_type = simd<int64_t, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // instruction does not exist; split into 32-bit multiplies
+        // x = x_H * 2^32 + x_L, y = y_H * 2^32 + y_L
+        __m128i mask_lo = _mm_setr_epi32(-1, 0, -1, 0);
+
+        __m128i x_hi    = _mm_srli_epi64(x.data, 32);
+        __m128i y_hi    = _mm_srli_epi64(y.data, 32);
+
+        // 64 bit unsigned products
+        __m128i prod_ll = _mm_mul_epu32(x.data, y.data);
+        __m128i prod_lh = _mm_mul_epu32(x.data, y_hi);
+        __m128i prod_hl = _mm_mul_epu32(x_hi, y.data);
+        __m128i prod_hh = _mm_mul_epu32(x_hi, y_hi);
+
+        // sums cannot overflow: (2^32 - 1)^2 + 2^32 - 1 < 2^64
+        __m128i t       = _mm_add_epi64(prod_hl, _mm_srli_epi64(prod_ll, 32));
+        __m128i u       = _mm_add_epi64(prod_lh, _mm_and_si128(t, mask_lo));
+
+        // x_H * y_H + t_H + u_H
+        __m128i res     = _mm_add_epi64(_mm_srli_epi64(t, 32), _mm_srli_epi64(u, 32));
+        return _mm_add_epi64(prod_hh, res);
+    };
+};
+
+template<>
+struct simd_mulh<int64_t, 128, sse_tag>
+{
+    using simd_type = simd<int64_t, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        // signed high part is equal to the unsigned high part minus y if
+        // x < 0 and minus x if y < 0
+        __m128i res     = simd_mulhu<int64_t, 128, sse_tag>::eval(x, y).data;
+
+        // sign masks; copy high 32 bits to low 32 bits and shift
+        __m128i sign_x  = _mm_srai_epi32(_mm_shuffle_epi32(x.data, 0xF5), 31);
+        __m128i sign_y  = _mm_srai_epi32(_mm_shuffle_epi32(y.data, 0xF5), 31);
+
+        __m128i corr_x  = _mm_and_si128(sign_x, y.data);
+        __m128i corr_y  = _mm_and_si128(sign_y, x.data);
+
+        return _mm_sub_epi64(res, _mm_add_epi64(corr_x, corr_y));
+    };
+};
+
 template<>
 struct simd_plus<int64_t, 128, sse_tag>
 {
@@ -0,0 +1,87 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/func/simd_mask_def.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                  CONVERSIONS
+//-----------------------------------------------------------------------
+template<>
+struct simd_mask_from_vector<double, 128, sse_tag>
+{
+    using simd_type = simd<double, 128, sse_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm_movemask_pd(x.data);
+    };
+};
+
+template<>
+struct simd_mask_from_vector<float, 128, sse_tag>
+{
+    using simd_type = simd<float, 128, sse_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm_movemask_ps(x.data);
+    };
+};
+
+template<>
+struct simd_mask_from_vector<int32_t, 128, sse_tag>
+{
+    using simd_type = simd<int32_t, 128, sse_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(x.data));
+    };
+};
+
+template<>
+struct simd_mask_from_vector<int64_t, 128, sse_tag>
+{
+    using simd_type = simd<int64_t, 128, sse_tag>;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        return (uint32_t)_mm_movemask_pd(_mm_castsi128_pd(x.data));
+    };
+};
+
+template<class T>
+struct simd_mask_from_vector<T, 256, sse_tag>
+{
+    using simd_type = simd<T, 256, sse_tag>;
+    using half_conv = simd_mask_from_vector<T, 128, sse_tag>;
+
+    static const int
+    half_size       = simd_type::vector_size / 2;
+
+    force_inline
+    static uint32_t eval(const simd_type& x)
+    {
+        uint32_t lo = half_conv::eval(x.data[0]);
+        uint32_t hi = half_conv::eval(x.data[1]);
+
+        return lo | (hi << half_size);
+    };
+};
+
+}}}
@@ -52,6 +52,15 @@ struct simd_compl_mult<T, 256, sse_tag>
         return simd_type(x.extract_low() * y.extract_low(), x.extract_high() * y.extract_high());
     };
 
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        using impl_128  = simd_compl_mult<T, 128, sse_tag>;
+
+        return simd_type(impl_128::eval_fast(x.extract_low(), y.extract_low()),
+                         impl_128::eval_fast(x.extract_high(), y.extract_high()));
+    };
+
     force_inline
     static simd_type eval_rc(const simd_real_type& x, const simd_type& y)
     {
@@ -78,6 +87,15 @@ struct simd_compl_div<T, 256, sse_tag>
         return simd_type(x.extract_low() / y.extract_low(), x.extract_high() / y.extract_high());
     };
 
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        using impl_128  = simd_compl_div<T, 128, sse_tag>;
+
+        return simd_type(impl_128::eval_fast(x.extract_low(), y.extract_low()),
+                         impl_128::eval_fast(x.extract_high(), y.extract_high()));
+    };
+
     // (a.re * b.re + a.im * b.im, b.re * a.im - a.re * b.im) / (b.re * b.re + b.im * b.im)
     force_inline
     static simd_type eval(const simd_real& x, const simd_type& y)
@@ -146,4 +164,38 @@ struct simd_compl_horizontal_sum<T, 256, sse_tag>
     };
 };
 
+template<class T>
+struct simd_compl_split_shuffle<T, 256, sse_tag>
+{
+    using simd_type         = simd<T, 256, sse_tag>;
+    using simd_half         = simd<T, 128, sse_tag>;
+    using half_shuffle      = simd_compl_split_shuffle<T, 128, sse_tag>;
+
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        simd_half re_lo, im_lo, re_hi, im_hi;
+
+        half_shuffle::eval_deinterleave(a.extract_low(), a.extract_high(), re_lo, im_lo);
+        half_shuffle::eval_deinterleave(b.extract_low(), b.extract_high(), re_hi, im_hi);
+
+        re  = simd_type(re_lo, re_hi);
+        im  = simd_type(im_lo, im_hi);
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        simd_half a_lo, a_hi, b_lo, b_hi;
+
+        half_shuffle::eval_interleave(re.extract_low(), im.extract_low(), a_lo, a_hi);
+        half_shuffle::eval_interleave(re.extract_high(), im.extract_high(), b_lo, b_hi);
+
+        a   = simd_type(a_lo, a_hi);
+        b   = simd_type(b_lo, b_hi);
+    };
+};
+
 }}}
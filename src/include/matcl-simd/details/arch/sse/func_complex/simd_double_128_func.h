@@ -47,7 +47,7 @@ struct simd_compl_mult<double, 128, sse_tag>
 
     // (x.re * y.re - x.im * y.im,  x.re * y.im + x.re * y.im)
     force_inline
-    static simd_type eval(const simd_type& x, const simd_type& y)
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
     {        
         __m128d y_flip = _mm_shuffle_pd(y.data.data, y.data.data, 1);   // swap y.re and y.im
         __m128d x_im   = _mm_shuffle_pd(x.data.data, x.data.data, 3);   // imag of x in both
@@ -63,6 +63,15 @@ struct simd_compl_mult<double, 128, sse_tag>
             __m128d res = sub_add(xv_rey, xv_imy).data;                 // a_re * y -/+ x_imy
         #endif
 
+        return simd_type(res);
+    };
+
+    // strict multiplication; NaN results are recovered according to C99 Annex G
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m128d res     = eval_fast(x, y).data.data;
+
         // check for NaN
         __m128d nt      = _mm_cmp_pd(res, res, _CMP_NEQ_UQ);
         _mm_cmpneq_pd(res, res);
@@ -154,6 +163,35 @@ struct simd_compl_div<double, 128, sse_tag>
             return simd_type(res);
     };
 
+    // fast division: x * conj(y) / |y|^2 without overflow checks and NaN
+    // recovery
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {        
+        __m128d y_flip = _mm_shuffle_pd(y.data.data, y.data.data, 1);   // swap y.re and y.im
+        __m128d x_im   = _mm_shuffle_pd(x.data.data, x.data.data, 3);   // imag of x in both
+        __m128d x_re   = _mm_shuffle_pd(x.data.data, x.data.data, 0);   // real of x in both
+        __m128d x_rey  = _mm_mul_pd(x_re, y.data.data);                 // (x.re*b.re, x.re*b.im)  
+        __m128d yy     = _mm_mul_pd(y.data.data, y.data.data);          // (y.re*y.re, y.im*y.im)
+
+        simd_real tmp   = simd_real(yy);
+        double s        = horizontal_sum(tmp);                          // (y.re*y.re + y.im*y.im) 
+        __m128d yy2     = _mm_set1_pd(s);
+
+        #if MATCL_ARCHITECTURE_HAS_FMA
+            __m128d n      = _mm_fmsubadd_pd(x_im, y_flip, x_rey);      // (x_im * y_im, x_im * y_re) +/- x_rey
+        #else
+            __m128d x_imy  = _mm_mul_pd(x_im, y_flip);                  // (x_im * y_im, x_im * y_re)
+            simd_real xv_imy(x_imy);
+            simd_real xv_rey(x_rey);
+            __m128d n      = sub_add(xv_imy, -xv_rey).data;             // x_re * y +/- x_imy
+        #endif
+
+        __m128d res     = _mm_div_pd(n, yy2);
+
+        return simd_type(res);
+    };
+
     // (a * b.re, - a * b.im) / (b.re * b.re + b.im * b.im)
     force_inline
     static simd_type eval_rc(const simd_real& x, const simd_type& y)
@@ -297,4 +335,27 @@ struct simd_compl_horizontal_sum<double, 128, sse_tag>
     };
 };
 
+template<>
+struct simd_compl_split_shuffle<double, 128, sse_tag>
+{
+    using simd_type         = simd<double, 128, sse_tag>;
+
+    // a = [r0, i0], b = [r1, i1]
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        re  = _mm_unpacklo_pd(a.data, b.data);
+        im  = _mm_unpackhi_pd(a.data, b.data);
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        a   = _mm_unpacklo_pd(re.data, im.data);
+        b   = _mm_unpackhi_pd(re.data, im.data);
+    };
+};
+
 }}}
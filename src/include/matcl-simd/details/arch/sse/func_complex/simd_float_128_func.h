@@ -48,7 +48,7 @@ struct simd_compl_mult<float, 128, sse_tag>
 
     // (x.re * y.re - x.im * y.im,  x.re * y.im + x.re * y.im)
     force_inline
-    static simd_type eval(const simd_type& x, const simd_type& y)
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
     {        
         __m128 y_flip = _mm_shuffle_ps(y.data.data, y.data.data, 0xB1); // swap y.re and y.im
         __m128 x_im   = _mm_shuffle_ps(x.data.data, x.data.data, 0xF5); // imag of x in both
@@ -64,6 +64,15 @@ struct simd_compl_mult<float, 128, sse_tag>
             __m128 res  = sub_add(xv_rey, xv_imy).data;                 // a_re * y -/+ x_imy
         #endif
 
+        return simd_type(res);
+    };
+
+    // strict multiplication; NaN results are recovered according to C99 Annex G
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        __m128 res      = eval_fast(x, y).data.data;
+
         // check for NaN
         __m128 nt       = _mm_cmp_ps(res, res, _CMP_NEQ_UQ);
         int have_nan    = _mm_movemask_ps(nt);
@@ -153,6 +162,39 @@ struct simd_compl_div<float, 128, sse_tag>
             return simd_type(res);
     };
 
+    // fast division: x * conj(y) / |y|^2 without overflow checks and NaN
+    // recovery
+    force_inline
+    static simd_type eval_fast(const simd_type& x, const simd_type& y)
+    {
+        __m128 y_flip   = _mm_shuffle_ps(y.data.data, y.data.data, 0xB1);   // swap y.re and y.im
+        __m128 x_im     = _mm_shuffle_ps(x.data.data, x.data.data, 0xF5);   // imag of x in both
+        __m128 x_re     = _mm_shuffle_ps(x.data.data, x.data.data, 0xA0);   // real of x in both
+        simd_real x_rey = _mm_mul_ps(x_re, y.data.data);                    // (x.re*b.re, x.re*b.im)  
+        __m128 yy       = _mm_mul_ps(y.data.data, y.data.data);             // (y.re*y.re, y.im*y.im)
+
+        __m128 yy2    = _mm_shuffle_ps(yy, yy, 0xB1);                       // swap yy.re and yy.im
+        __m128 yy3    = _mm_add_ps(yy,yy2);                                 // add pairwise
+
+        #if MATCL_ARCHITECTURE_HAS_FMA
+            __m128 n    = _mm_fmsubadd_ps(x_im, y_flip, x_rey.data);        // (x_im * y_im, x_im * y_re) +/- x_rey
+        #else
+            __m128 x_imy    = _mm_mul_ps(x_im, y_flip);                     // (x_im * y_im, x_im * y_re)
+            simd_real xv_imy(x_imy);
+            simd_real xv_rey(x_rey);
+            __m128 n        = sub_add(xv_imy, -xv_rey).data;                // x_re * y +/- x_imy
+        #endif
+        
+        // reciprocal of |y|^2 refined by one Newton step
+        __m128 r        = _mm_rcp_ps(yy3);
+        __m128 two      = _mm_set1_ps(2.0f);
+        r               = _mm_mul_ps(r, _mm_sub_ps(two, _mm_mul_ps(yy3, r)));
+
+        __m128 res      = _mm_mul_ps(n, r);
+
+        return simd_type(res);
+    };
+
     // (a * b.re, - a * b.im) / (b.re * b.re + b.im * b.im)
     force_inline
     static simd_type eval_rc(const simd_real& x, const simd_type& y)
@@ -296,4 +338,27 @@ struct simd_compl_horizontal_sum<float, 128, sse_tag>
     };
 };
 
+template<>
+struct simd_compl_split_shuffle<float, 128, sse_tag>
+{
+    using simd_type         = simd<float, 128, sse_tag>;
+
+    // a = [r0, i0, r1, i1], b = [r2, i2, r3, i3]
+    force_inline
+    static void eval_deinterleave(const simd_type& a, const simd_type& b, 
+                                  simd_type& re, simd_type& im)
+    {
+        re  = _mm_shuffle_ps(a.data, b.data, _MM_SHUFFLE(2, 0, 2, 0));
+        im  = _mm_shuffle_ps(a.data, b.data, _MM_SHUFFLE(3, 1, 3, 1));
+    };
+
+    force_inline
+    static void eval_interleave(const simd_type& re, const simd_type& im, 
+                                simd_type& a, simd_type& b)
+    {
+        a   = _mm_unpacklo_ps(re.data, im.data);
+        b   = _mm_unpackhi_ps(re.data, im.data);
+    };
+};
+
 }}}
@@ -49,11 +49,997 @@ struct simd_exp<float, 256, sse_tag>
     };
 };
 
+//-----------------------------------------------------------------------
+//                          exp2/exp10/expm1
+//-----------------------------------------------------------------------
+template<>
+struct simd_exp2<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = exp2(a.extract_low());
+        simd_half v2    = exp2(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_exp2<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = exp2(a.extract_low());
+        simd_half v2    = exp2(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_exp10<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = exp10(a.extract_low());
+        simd_half v2    = exp10(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_exp10<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = exp10(a.extract_low());
+        simd_half v2    = exp10(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_expm1<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = expm1(a.extract_low());
+        simd_half v2    = expm1(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_expm1<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = expm1(a.extract_low());
+        simd_half v2    = expm1(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
 //-----------------------------------------------------------------------
 //                          log
 //-----------------------------------------------------------------------
 template<>
-struct simd_log<double, 256, sse_tag>
+struct simd_log<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log(a.extract_low());
+        simd_half v2    = log(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_log<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log(a.extract_low());
+        simd_half v2    = log(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          log2/log10/log1p
+//-----------------------------------------------------------------------
+template<>
+struct simd_log2<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log2(a.extract_low());
+        simd_half v2    = log2(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_log2<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log2(a.extract_low());
+        simd_half v2    = log2(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_log10<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log10(a.extract_low());
+        simd_half v2    = log10(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_log10<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log10(a.extract_low());
+        simd_half v2    = log10(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_log1p<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log1p(a.extract_low());
+        simd_half v2    = log1p(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_log1p<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = log1p(a.extract_low());
+        simd_half v2    = log1p(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          pow
+//-----------------------------------------------------------------------
+template<>
+struct simd_pow<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        simd_half v1    = pow(x.extract_low(), y.extract_low());
+        simd_half v2    = pow(x.extract_high(), y.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_pow<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        simd_half v1    = pow(x.extract_low(), y.extract_low());
+        simd_half v2    = pow(x.extract_high(), y.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          atan/atan2/asin/acos
+//-----------------------------------------------------------------------
+template<>
+struct simd_atan<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = atan(a.extract_low());
+        simd_half v2    = atan(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_atan<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = atan(a.extract_low());
+        simd_half v2    = atan(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_atan2<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& y, const simd_type& x)
+    {
+        simd_half v1    = atan2(y.extract_low(), x.extract_low());
+        simd_half v2    = atan2(y.extract_high(), x.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_atan2<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& y, const simd_type& x)
+    {
+        simd_half v1    = atan2(y.extract_low(), x.extract_low());
+        simd_half v2    = atan2(y.extract_high(), x.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_asin<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = asin(a.extract_low());
+        simd_half v2    = asin(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_asin<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = asin(a.extract_low());
+        simd_half v2    = asin(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_acos<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = acos(a.extract_low());
+        simd_half v2    = acos(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_acos<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = acos(a.extract_low());
+        simd_half v2    = acos(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          sinh/cosh/tanh/sigmoid/softplus
+//-----------------------------------------------------------------------
+template<>
+struct simd_sinh<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = sinh(a.extract_low());
+        simd_half v2    = sinh(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_sinh<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = sinh(a.extract_low());
+        simd_half v2    = sinh(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_cosh<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = cosh(a.extract_low());
+        simd_half v2    = cosh(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_cosh<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = cosh(a.extract_low());
+        simd_half v2    = cosh(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_tanh<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = tanh(a.extract_low());
+        simd_half v2    = tanh(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_tanh<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = tanh(a.extract_low());
+        simd_half v2    = tanh(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_sigmoid<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = sigmoid(a.extract_low());
+        simd_half v2    = sigmoid(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_sigmoid<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = sigmoid(a.extract_low());
+        simd_half v2    = sigmoid(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_softplus<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = softplus(a.extract_low());
+        simd_half v2    = softplus(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_softplus<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = softplus(a.extract_low());
+        simd_half v2    = softplus(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          erf/erfc/normcdf/norminv
+//-----------------------------------------------------------------------
+template<>
+struct simd_erf<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = erf(a.extract_low());
+        simd_half v2    = erf(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_erf<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = erf(a.extract_low());
+        simd_half v2    = erf(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_erfc<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = erfc(a.extract_low());
+        simd_half v2    = erfc(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_erfc<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = erfc(a.extract_low());
+        simd_half v2    = erfc(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_normcdf<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = normcdf(a.extract_low());
+        simd_half v2    = normcdf(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_normcdf<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = normcdf(a.extract_low());
+        simd_half v2    = normcdf(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_norminv<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = norminv(a.extract_low());
+        simd_half v2    = norminv(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_norminv<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = norminv(a.extract_low());
+        simd_half v2    = norminv(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          rcp/rsqrt/cbrt/hypot
+//-----------------------------------------------------------------------
+template<>
+struct simd_rcp_approx<float, 128, sse_tag>
+{
+    using simd_type     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm_rcp_ps(x.data);
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<float, 128, sse_tag>
+{
+    using simd_type     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return _mm_rsqrt_ps(x.data);
+    };
+};
+
+// relative error of rcp_approx and rsqrt_approx is at most 1.5 * 2^-12;
+// one Newton step is sufficient
+template<>
+struct simd_rcp<float, 128, sse_tag>
+{
+    using simd_type     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, 128, sse_tag>::eval_rcp<1>(x);
+    };
+};
+
+template<>
+struct simd_rsqrt<float, 128, sse_tag>
+{
+    using simd_type     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, 128, sse_tag>::eval_rsqrt<1>(x);
+    };
+};
+
+template<>
+struct simd_rcp_approx<float, 128, scalar_sse_tag>
+{
+    using simd_type     = simd<float, 128, scalar_sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type(rcp_approx(x.as_vector()));
+    };
+};
+
+template<>
+struct simd_rcp<float, 128, scalar_sse_tag>
+{
+    using simd_type     = simd<float, 128, scalar_sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type(rcp(x.as_vector()));
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<float, 128, scalar_sse_tag>
+{
+    using simd_type     = simd<float, 128, scalar_sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type(rsqrt_approx(x.as_vector()));
+    };
+};
+
+template<>
+struct simd_rsqrt<float, 128, scalar_sse_tag>
+{
+    using simd_type     = simd<float, 128, scalar_sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type(rsqrt(x.as_vector()));
+    };
+};
+
+template<>
+struct simd_rcp_approx<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rcp_approx(a.extract_low());
+        simd_half v2    = rcp_approx(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rcp_approx<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rcp_approx(a.extract_low());
+        simd_half v2    = rcp_approx(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rcp<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rcp(a.extract_low());
+        simd_half v2    = rcp(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rcp<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rcp(a.extract_low());
+        simd_half v2    = rcp(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rsqrt_approx(a.extract_low());
+        simd_half v2    = rsqrt_approx(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rsqrt_approx<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rsqrt_approx(a.extract_low());
+        simd_half v2    = rsqrt_approx(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rsqrt<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rsqrt(a.extract_low());
+        simd_half v2    = rsqrt(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_rsqrt<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = rsqrt(a.extract_low());
+        simd_half v2    = rsqrt(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_cbrt<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = cbrt(a.extract_low());
+        simd_half v2    = cbrt(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_cbrt<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = cbrt(a.extract_low());
+        simd_half v2    = cbrt(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_hypot<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        simd_half v1    = hypot(x.extract_low(), y.extract_low());
+        simd_half v2    = hypot(x.extract_high(), y.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_hypot<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        simd_half v1    = hypot(x.extract_low(), y.extract_low());
+        simd_half v2    = hypot(x.extract_high(), y.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                          lgamma/tgamma/digamma
+//-----------------------------------------------------------------------
+template<>
+struct simd_lgamma<double, 256, sse_tag>
 {
     using simd_type     = simd<double, 256, sse_tag>;
     using simd_half     = simd<double, 128, sse_tag>;
@@ -61,15 +1047,15 @@ struct simd_log<double, 256, sse_tag>
     force_inline
     static simd_type eval(const simd_type& a)
     {
-        simd_half v1    = log(a.extract_low());
-        simd_half v2    = log(a.extract_high());
+        simd_half v1    = lgamma(a.extract_low());
+        simd_half v2    = lgamma(a.extract_high());
 
         return simd_type(v1, v2);
     };
 };
 
 template<>
-struct simd_log<float, 256, sse_tag>
+struct simd_lgamma<float, 256, sse_tag>
 {
     using simd_type     = simd<float, 256, sse_tag>;
     using simd_half     = simd<float, 128, sse_tag>;
@@ -77,8 +1063,72 @@ struct simd_log<float, 256, sse_tag>
     force_inline
     static simd_type eval(const simd_type& a)
     {
-        simd_half v1    = log(a.extract_low());
-        simd_half v2    = log(a.extract_high());
+        simd_half v1    = lgamma(a.extract_low());
+        simd_half v2    = lgamma(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_tgamma<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = tgamma(a.extract_low());
+        simd_half v2    = tgamma(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_tgamma<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = tgamma(a.extract_low());
+        simd_half v2    = tgamma(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_digamma<double, 256, sse_tag>
+{
+    using simd_type     = simd<double, 256, sse_tag>;
+    using simd_half     = simd<double, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = digamma(a.extract_low());
+        simd_half v2    = digamma(a.extract_high());
+
+        return simd_type(v1, v2);
+    };
+};
+
+template<>
+struct simd_digamma<float, 256, sse_tag>
+{
+    using simd_type     = simd<float, 256, sse_tag>;
+    using simd_half     = simd<float, 128, sse_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        simd_half v1    = digamma(a.extract_low());
+        simd_half v2    = digamma(a.extract_high());
 
         return simd_type(v1, v2);
     };
@@ -321,6 +1371,17 @@ struct simd_sincos<double, 256, sse_tag>
 
         return simd_type(v1, v2);
     };
+
+    force_inline
+    static void eval_sincos_both(const simd_type& a, simd_type& ret_s, simd_type& ret_c)
+    {
+        simd_half s1, s2, c1, c2;
+        sincos(a.extract_low(), s1, c1);
+        sincos(a.extract_high(), s2, c2);
+
+        ret_s           = simd_type(s1, s2);
+        ret_c           = simd_type(c1, c2);
+    };
 };
 
 template<>
@@ -346,6 +1407,17 @@ struct simd_sincos<float, 256, sse_tag>
 
         return simd_type(v1, v2);
     };
+
+    force_inline
+    static void eval_sincos_both(const simd_type& a, simd_type& ret_s, simd_type& ret_c)
+    {
+        simd_half s1, s2, c1, c2;
+        sincos(a.extract_low(), s1, c1);
+        sincos(a.extract_high(), s2, c2);
+
+        ret_s           = simd_type(s1, s2);
+        ret_c           = simd_type(c1, c2);
+    };
 };
 
 //-----------------------------------------------------------------------
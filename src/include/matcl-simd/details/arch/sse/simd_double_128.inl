@@ -282,6 +282,17 @@ simd<double, 128, sse_tag>::load(const double* arr, std::false_type not_aligned)
     return _mm_loadu_pd(arr);
 };
 
+force_inline simd<double, 128, sse_tag> 
+simd<double, 128, sse_tag>::load_partial(const double* arr, int n)
+{
+    switch (n)
+    {
+        case 0:     return zero();
+        case 1:     return _mm_load_sd(arr);
+        default:    return _mm_loadu_pd(arr);
+    };
+};
+
 force_inline simd<double, 128, sse_tag> 
 simd<double, 128, sse_tag>::gather(const double* arr, const simd_int32& ind)
 {
@@ -330,6 +341,17 @@ simd<double, 128, sse_tag>::store(double* arr, std::false_type not_aligned) cons
     _mm_storeu_pd(arr, data);
 };
 
+force_inline void 
+simd<double, 128, sse_tag>::store_partial(double* arr, int n) const
+{
+    switch (n)
+    {
+        case 0:     return;
+        case 1:     _mm_store_sd(arr, data); return;
+        default:    _mm_storeu_pd(arr, data); return;
+    };
+};
+
 template<int Step>
 force_inline
 void simd<double, 128, sse_tag>::scatter(double* arr) const
@@ -207,6 +207,26 @@ simd<double, 256, sse_tag>::load(const double* arr, std::false_type not_aligned)
     return ret;
 };
 
+force_inline simd<double, 256, sse_tag> 
+simd<double, 256, sse_tag>::load_partial(const double* arr, int n)
+{
+    simd<double, 256, sse_tag> ret;
+
+    if (n <= simd_half::vector_size)
+    {
+        ret.data[0] = simd_half::load_partial(arr, n);
+        ret.data[1] = simd_half::zero();
+    }
+    else
+    {
+        ret.data[0] = simd_half::load(arr, std::false_type());
+        ret.data[1] = simd_half::load_partial(arr + simd_half::vector_size, 
+                                            n - simd_half::vector_size);
+    };
+
+    return ret;
+};
+
 force_inline simd<double, 256, sse_tag> 
 simd<double, 256, sse_tag>::gather(const double* arr, const simd_int32_half& ind)
 {
@@ -264,6 +284,20 @@ simd<double, 256, sse_tag>::store(double* arr, std::false_type not_aligned) cons
     data[1].store(arr + 2, not_aligned);
 };
 
+force_inline void 
+simd<double, 256, sse_tag>::store_partial(double* arr, int n) const
+{
+    if (n <= simd_half::vector_size)
+    {
+        data[0].store_partial(arr, n);
+    }
+    else
+    {
+        data[0].store(arr, std::false_type());
+        data[1].store_partial(arr + simd_half::vector_size, n - simd_half::vector_size);
+    };
+};
+
 force_inline simd<float, 128, sse_tag>
 simd<double, 256, sse_tag>::convert_to_float() const
 {
@@ -169,6 +169,20 @@ simd<float, 128, sse_tag>::load(const float* arr, std::false_type not_aligned)
     return _mm_loadu_ps(arr);
 };
 
+force_inline simd<float, 128, sse_tag> 
+simd<float, 128, sse_tag>::load_partial(const float* arr, int n)
+{
+    switch (n)
+    {
+        case 0:     return zero();
+        case 1:     return _mm_load_ss(arr);
+        case 2:     return _mm_castpd_ps(_mm_load_sd((const double*)arr));
+        case 3:     return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((const double*)arr)), 
+                                         _mm_load_ss(arr + 2));
+        default:    return _mm_loadu_ps(arr);
+    };
+};
+
 force_inline simd<float, 128, sse_tag>
 simd<float, 128, sse_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -223,6 +237,22 @@ simd<float, 128, sse_tag>::store(float* arr, std::false_type not_aligned) const
     _mm_storeu_ps(arr, data);
 };
 
+force_inline void 
+simd<float, 128, sse_tag>::store_partial(float* arr, int n) const
+{
+    switch (n)
+    {
+        case 0:     return;
+        case 1:     _mm_store_ss(arr, data); return;
+        case 2:     _mm_store_sd((double*)arr, _mm_castps_pd(data)); return;
+        case 3:
+            _mm_store_sd((double*)arr, _mm_castps_pd(data));
+            _mm_store_ss(arr + 2, _mm_movehl_ps(data, data));
+            return;
+        default:    _mm_storeu_ps(arr, data); return;
+    };
+};
+
 force_inline simd<double, 128, sse_tag>
 simd<float, 128, sse_tag>::convert_low_to_double() const
 {
@@ -266,6 +266,26 @@ simd<float, 256, sse_tag>::load(const float* arr, std::false_type not_aligned)
     return ret;
 };
 
+force_inline simd<float, 256, sse_tag> 
+simd<float, 256, sse_tag>::load_partial(const float* arr, int n)
+{
+    simd<float, 256, sse_tag> ret;
+
+    if (n <= simd_half::vector_size)
+    {
+        ret.data[0] = simd_half::load_partial(arr, n);
+        ret.data[1] = simd_half::zero();
+    }
+    else
+    {
+        ret.data[0] = simd_half::load(arr, std::false_type());
+        ret.data[1] = simd_half::load_partial(arr + simd_half::vector_size, 
+                                            n - simd_half::vector_size);
+    };
+
+    return ret;
+};
+
 force_inline simd<float, 256, sse_tag> 
 simd<float, 256, sse_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -319,6 +339,20 @@ simd<float, 256, sse_tag>::store(float* arr, std::false_type not_aligned) const
     data[1].store(arr + 4, not_aligned);
 };
 
+force_inline void 
+simd<float, 256, sse_tag>::store_partial(float* arr, int n) const
+{
+    if (n <= simd_half::vector_size)
+    {
+        data[0].store_partial(arr, n);
+    }
+    else
+    {
+        data[0].store(arr, std::false_type());
+        data[1].store_partial(arr + simd_half::vector_size, n - simd_half::vector_size);
+    };
+};
+
 template<int Step>
 force_inline
 void simd<float, 256, sse_tag>::scatter(float* arr) const
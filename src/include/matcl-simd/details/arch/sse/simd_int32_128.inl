@@ -198,6 +198,13 @@ simd<int32_t, 128, sse_tag>::load(const int32_t* arr, std::false_type not_aligne
     return _mm_loadu_si128 ((const __m128i*)arr);
 };
 
+force_inline simd<int32_t, 128, sse_tag> 
+simd<int32_t, 128, sse_tag>::load_partial(const int32_t* arr, int n)
+{
+    using simd_float = simd<float, 128, sse_tag>;
+    return _mm_castps_si128(simd_float::load_partial((const float*)arr, n).data);
+};
+
 force_inline simd<int32_t, 128, sse_tag>
 simd<int32_t, 128, sse_tag>::gather(const int32_t* arr, const simd_int32& ind)
 {
@@ -253,6 +260,13 @@ simd<int32_t, 128, sse_tag>::store(int32_t* arr, std::false_type not_aligned) co
     _mm_storeu_si128((__m128i*)arr, data);
 };
 
+force_inline void 
+simd<int32_t, 128, sse_tag>::store_partial(int32_t* arr, int n) const
+{
+    using simd_float = simd<float, 128, sse_tag>;
+    simd_float(_mm_castsi128_ps(data)).store_partial((float*)arr, n);
+};
+
 force_inline simd<int64_t, 128, sse_tag>
 simd<int32_t, 128, sse_tag>::convert_low_to_int64() const
 {
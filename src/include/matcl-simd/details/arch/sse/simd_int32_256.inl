@@ -233,6 +233,26 @@ simd<int32_t, 256, sse_tag>::load(const int32_t* arr, std::false_type not_aligne
     return ret;
 };
 
+force_inline simd<int32_t, 256, sse_tag> 
+simd<int32_t, 256, sse_tag>::load_partial(const int32_t* arr, int n)
+{
+    simd<int32_t, 256, sse_tag> ret;
+
+    if (n <= simd_half::vector_size)
+    {
+        ret.data[0] = simd_half::load_partial(arr, n);
+        ret.data[1] = simd_half::zero();
+    }
+    else
+    {
+        ret.data[0] = simd_half::load(arr, std::false_type());
+        ret.data[1] = simd_half::load_partial(arr + simd_half::vector_size, 
+                                            n - simd_half::vector_size);
+    };
+
+    return ret;
+};
+
 force_inline simd<int32_t, 256, sse_tag> 
 simd<int32_t, 256, sse_tag>::gather(const int32_t* arr, const simd_int32& ind)
 {
@@ -286,6 +306,20 @@ simd<int32_t, 256, sse_tag>::store(int32_t* arr, std::false_type not_aligned) co
     data[1].store(arr + 4, not_aligned);
 };
 
+force_inline void 
+simd<int32_t, 256, sse_tag>::store_partial(int32_t* arr, int n) const
+{
+    if (n <= simd_half::vector_size)
+    {
+        data[0].store_partial(arr, n);
+    }
+    else
+    {
+        data[0].store(arr, std::false_type());
+        data[1].store_partial(arr + simd_half::vector_size, n - simd_half::vector_size);
+    };
+};
+
 template<int Step>
 force_inline
 void simd<int32_t, 256, sse_tag>::scatter(int32_t* arr) const
@@ -280,6 +280,17 @@ simd<int64_t, 128, sse_tag>::load(const int64_t* arr, std::false_type not_aligne
     return _mm_loadu_si128 ((const __m128i*)arr);
 };
 
+force_inline simd<int64_t, 128, sse_tag> 
+simd<int64_t, 128, sse_tag>::load_partial(const int64_t* arr, int n)
+{
+    switch (n)
+    {
+        case 0:     return zero();
+        case 1:     return _mm_loadl_epi64((const __m128i*)arr);
+        default:    return _mm_loadu_si128((const __m128i*)arr);
+    };
+};
+
 force_inline simd<int64_t, 128, sse_tag>
 simd<int64_t, 128, sse_tag>::gather(const int64_t* arr, const simd_int32& ind)
 {
@@ -328,6 +339,17 @@ simd<int64_t, 128, sse_tag>::store(int64_t* arr, std::false_type not_aligned) co
     _mm_storeu_si128((__m128i*)arr, data);
 };
 
+force_inline void 
+simd<int64_t, 128, sse_tag>::store_partial(int64_t* arr, int n) const
+{
+    switch (n)
+    {
+        case 0:     return;
+        case 1:     _mm_storel_epi64((__m128i*)arr, data); return;
+        default:    _mm_storeu_si128((__m128i*)arr, data); return;
+    };
+};
+
 template<int Step>
 force_inline
 void simd<int64_t, 128, sse_tag>::scatter(int64_t* arr) const
@@ -188,6 +188,26 @@ simd<int64_t, 256, sse_tag>::load(const int64_t* arr, std::false_type not_aligne
     return ret;
 };
 
+force_inline simd<int64_t, 256, sse_tag> 
+simd<int64_t, 256, sse_tag>::load_partial(const int64_t* arr, int n)
+{
+    simd<int64_t, 256, sse_tag> ret;
+
+    if (n <= simd_half::vector_size)
+    {
+        ret.data[0] = simd_half::load_partial(arr, n);
+        ret.data[1] = simd_half::zero();
+    }
+    else
+    {
+        ret.data[0] = simd_half::load(arr, std::false_type());
+        ret.data[1] = simd_half::load_partial(arr + simd_half::vector_size, 
+                                            n - simd_half::vector_size);
+    };
+
+    return ret;
+};
+
 force_inline simd<int64_t, 256, sse_tag> 
 simd<int64_t, 256, sse_tag>::gather(const int64_t* arr, const simd_int32_half& ind)
 {
@@ -245,6 +265,20 @@ simd<int64_t, 256, sse_tag>::store(int64_t* arr, std::false_type not_aligned) co
     data[1].store(arr + 2, not_aligned);
 };
 
+force_inline void 
+simd<int64_t, 256, sse_tag>::store_partial(int64_t* arr, int n) const
+{
+    if (n <= simd_half::vector_size)
+    {
+        data[0].store_partial(arr, n);
+    }
+    else
+    {
+        data[0].store(arr, std::false_type());
+        data[1].store_partial(arr + simd_half::vector_size, n - simd_half::vector_size);
+    };
+};
+
 force_inline simd<int32_t, 128, sse_tag>
 simd<int64_t, 256, sse_tag>::convert_to_int32() const
 {
@@ -191,6 +191,15 @@ simd<double, 128, scalar_sse_tag>::load(const double* arr, std::false_type not_a
     return _mm_load1_pd(arr);
 };
 
+force_inline simd<double, 128, scalar_sse_tag> 
+simd<double, 128, scalar_sse_tag>::load_partial(const double* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<double, 128, scalar_sse_tag> 
 simd<double, 128, scalar_sse_tag>::gather(const double* arr, const simd_int32& ind)
 {
@@ -217,6 +226,15 @@ simd<double, 128, scalar_sse_tag>::store(double* arr, std::false_type not_aligne
     arr[0] = first();
 };
 
+force_inline void 
+simd<double, 128, scalar_sse_tag>::store_partial(double* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 template<int Step>
 force_inline
 void simd<double, 128, scalar_sse_tag>::scatter(double* arr) const
@@ -125,6 +125,15 @@ simd<float, 128, scalar_sse_tag>::load(const float* arr, std::false_type not_ali
     return _mm_load1_ps(arr);
 };
 
+force_inline simd<float, 128, scalar_sse_tag> 
+simd<float, 128, scalar_sse_tag>::load_partial(const float* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<float, 128, scalar_sse_tag>
 simd<float, 128, scalar_sse_tag>::gather(const float* arr, const simd_int32& ind)
 {
@@ -157,6 +166,15 @@ simd<float, 128, scalar_sse_tag>::store(float* arr, std::false_type not_aligned)
     arr[0] = first();
 };
 
+force_inline void 
+simd<float, 128, scalar_sse_tag>::store_partial(float* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 force_inline
 typename simd<double, 128, scalar_sse_tag>
 simd<float, 128, scalar_sse_tag>::convert_to_double() const
@@ -120,6 +120,15 @@ simd<int32_t, 128, scalar_sse_tag>::load(const int32_t* arr, std::false_type not
     return _mm_set1_epi32(arr[0]);
 };
 
+force_inline simd<int32_t, 128, scalar_sse_tag> 
+simd<int32_t, 128, scalar_sse_tag>::load_partial(const int32_t* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<int32_t, 128, scalar_sse_tag>
 simd<int32_t, 128, scalar_sse_tag>::gather(const int32_t* arr, const simd_int32& ind)
 {
@@ -153,6 +162,15 @@ simd<int32_t, 128, scalar_sse_tag>::store(int32_t* arr, std::false_type not_alig
     arr[0] = first();
 };
 
+force_inline void 
+simd<int32_t, 128, scalar_sse_tag>::store_partial(int32_t* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 force_inline simd<int64_t, 128, scalar_sse_tag>
 simd<int32_t, 128, scalar_sse_tag>::convert_to_int64() const
 {
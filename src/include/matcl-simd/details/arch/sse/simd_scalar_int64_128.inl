@@ -175,6 +175,15 @@ simd<int64_t, 128, scalar_sse_tag>::load(const int64_t* arr, std::false_type not
     return _mm_set1_epi64x(arr[0]);
 };
 
+force_inline simd<int64_t, 128, scalar_sse_tag> 
+simd<int64_t, 128, scalar_sse_tag>::load_partial(const int64_t* arr, int n)
+{
+    if (n <= 0)
+        return zero();
+
+    return load(arr, std::false_type());
+};
+
 force_inline simd<int64_t, 128, scalar_sse_tag>
 simd<int64_t, 128, scalar_sse_tag>::gather(const int64_t* arr, const simd_int32& ind)
 {
@@ -201,6 +210,15 @@ simd<int64_t, 128, scalar_sse_tag>::store(int64_t* arr, std::false_type not_alig
     arr[0] = first();
 };
 
+force_inline void 
+simd<int64_t, 128, scalar_sse_tag>::store_partial(int64_t* arr, int n) const
+{
+    if (n <= 0)
+        return;
+
+    store(arr, std::false_type());
+};
+
 template<int Step>
 force_inline
 void simd<int64_t, 128, scalar_sse_tag>::scatter(int64_t* arr) const
@@ -123,6 +123,13 @@ simd_compl<double, 128, Simd_tag>::load(const simd_double_complex* arr, std::fal
     return impl_type::load((const double*)arr, not_aligned);
 };
 
+template<class Simd_tag>
+force_inline simd_compl<double, 128, Simd_tag> 
+simd_compl<double, 128, Simd_tag>::load_partial(const simd_double_complex* arr, int n)
+{
+    return impl_type::load_partial((const double*)arr, 2 * n);
+};
+
 template<class Simd_tag>
 force_inline void 
 simd_compl<double, 128, Simd_tag>::store(simd_double_complex* arr, std::true_type aligned) const
@@ -137,6 +144,13 @@ simd_compl<double, 128, Simd_tag>::store(simd_double_complex* arr, std::false_ty
     data.store((double*)arr, not_aligned);
 };
 
+template<class Simd_tag>
+force_inline void 
+simd_compl<double, 128, Simd_tag>::store_partial(simd_double_complex* arr, int n) const
+{
+    data.store_partial((double*)arr, 2 * n);
+};
+
 template<class Simd_tag>
 force_inline
 simd_double_complex simd_compl<double, 128, Simd_tag>::get(int pos) const
@@ -326,6 +340,13 @@ simd_compl<float, 128, Simd_tag>::load(const simd_single_complex* arr, std::fals
     return impl_type::load((const float*)arr, not_aligned);
 };
 
+template<class Simd_tag>
+force_inline simd_compl<float, 128, Simd_tag> 
+simd_compl<float, 128, Simd_tag>::load_partial(const simd_single_complex* arr, int n)
+{
+    return impl_type::load_partial((const float*)arr, 2 * n);
+};
+
 template<class Simd_tag>
 force_inline void 
 simd_compl<float, 128, Simd_tag>::store(simd_single_complex* arr, std::false_type not_aligned) const
@@ -333,6 +354,13 @@ simd_compl<float, 128, Simd_tag>::store(simd_single_complex* arr, std::false_typ
     data.store((float*)arr, not_aligned);
 };
 
+template<class Simd_tag>
+force_inline void 
+simd_compl<float, 128, Simd_tag>::store_partial(simd_single_complex* arr, int n) const
+{
+    data.store_partial((float*)arr, 2 * n);
+};
+
 template<class Simd_tag>
 force_inline void 
 simd_compl<float, 128, Simd_tag>::store(simd_single_complex* arr, std::true_type aligned) const
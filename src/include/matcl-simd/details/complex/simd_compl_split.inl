@@ -0,0 +1,213 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/complex/simd_compl_split.h"
+#include "matcl-simd/details/func/simd_func_complex_def.h"
+
+namespace matcl { namespace simd
+{
+
+//-------------------------------------------------------------------
+//                          SPLIT COMPLEX
+//-------------------------------------------------------------------
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>::simd_compl_split(Val re_)
+    : re(re_), im(impl_type::zero())
+{};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>::simd_compl_split(Val re_, Val im_)
+    : re(re_), im(im_)
+{};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>::simd_compl_split(const value_type& val)
+    : re(real(val)), im(imag(val))
+{};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>::simd_compl_split(const impl_type& re_)
+    : re(re_), im(impl_type::zero())
+{};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>::simd_compl_split(const impl_type& re_, const impl_type& im_)
+    : re(re_), im(im_)
+{};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>::zero()
+{
+    return simd_compl_split(impl_type::zero(), impl_type::zero());
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>::broadcast(const value_type& val)
+{
+    return simd_compl_split(val);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>::load(const value_type* arr, std::true_type aligned)
+{
+    using shuffle   = details::simd_compl_split_shuffle<Val, Bits, Simd_tag>;
+
+    const Val* ptr  = reinterpret_cast<const Val*>(arr);
+    impl_type a     = impl_type::load(ptr, aligned);
+    impl_type b     = impl_type::load(ptr + vector_size, aligned);
+
+    simd_compl_split res;
+    shuffle::eval_deinterleave(a, b, res.re, res.im);
+
+    return res;
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>::load(const value_type* arr, std::false_type not_aligned)
+{
+    using shuffle   = details::simd_compl_split_shuffle<Val, Bits, Simd_tag>;
+
+    const Val* ptr  = reinterpret_cast<const Val*>(arr);
+    impl_type a     = impl_type::load(ptr, not_aligned);
+    impl_type b     = impl_type::load(ptr + vector_size, not_aligned);
+
+    simd_compl_split res;
+    shuffle::eval_deinterleave(a, b, res.re, res.im);
+
+    return res;
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>::load_split(const Val* arr_re, const Val* arr_im,
+                                                  std::true_type aligned)
+{
+    return simd_compl_split(impl_type::load(arr_re, aligned), impl_type::load(arr_im, aligned));
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>
+simd_compl_split<Val, Bits, Simd_tag>::load_split(const Val* arr_re, const Val* arr_im,
+                                                  std::false_type not_aligned)
+{
+    return simd_compl_split(impl_type::load(arr_re, not_aligned),
+                            impl_type::load(arr_im, not_aligned));
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline void
+simd_compl_split<Val, Bits, Simd_tag>::store(value_type* arr, std::true_type aligned) const
+{
+    using shuffle   = details::simd_compl_split_shuffle<Val, Bits, Simd_tag>;
+
+    impl_type a, b;
+    shuffle::eval_interleave(re, im, a, b);
+
+    Val* ptr        = reinterpret_cast<Val*>(arr);
+    a.store(ptr, aligned);
+    b.store(ptr + vector_size, aligned);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline void
+simd_compl_split<Val, Bits, Simd_tag>::store(value_type* arr, std::false_type not_aligned) const
+{
+    using shuffle   = details::simd_compl_split_shuffle<Val, Bits, Simd_tag>;
+
+    impl_type a, b;
+    shuffle::eval_interleave(re, im, a, b);
+
+    Val* ptr        = reinterpret_cast<Val*>(arr);
+    a.store(ptr, not_aligned);
+    b.store(ptr + vector_size, not_aligned);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline void
+simd_compl_split<Val, Bits, Simd_tag>::store_split(Val* arr_re, Val* arr_im,
+                                                   std::true_type aligned) const
+{
+    re.store(arr_re, aligned);
+    im.store(arr_im, aligned);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline void
+simd_compl_split<Val, Bits, Simd_tag>::store_split(Val* arr_re, Val* arr_im,
+                                                   std::false_type not_aligned) const
+{
+    re.store(arr_re, not_aligned);
+    im.store(arr_im, not_aligned);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline typename simd_compl_split<Val, Bits, Simd_tag>::value_type
+simd_compl_split<Val, Bits, Simd_tag>::get(int pos) const
+{
+    return value_type(re.get(pos), im.get(pos));
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline typename simd_compl_split<Val, Bits, Simd_tag>::value_type
+simd_compl_split<Val, Bits, Simd_tag>::first() const
+{
+    return value_type(re.first(), im.first());
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline void
+simd_compl_split<Val, Bits, Simd_tag>::set(int pos, const value_type& val)
+{
+    re.set(pos, real(val));
+    im.set(pos, imag(val));
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>&
+simd_compl_split<Val, Bits, Simd_tag>::operator+=(const simd_compl_split& x)
+{
+    *this = *this + x;
+    return *this;
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>&
+simd_compl_split<Val, Bits, Simd_tag>::operator-=(const simd_compl_split& x)
+{
+    *this = *this - x;
+    return *this;
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>&
+simd_compl_split<Val, Bits, Simd_tag>::operator*=(const simd_compl_split& x)
+{
+    *this = *this * x;
+    return *this;
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl_split<Val, Bits, Simd_tag>&
+simd_compl_split<Val, Bits, Simd_tag>::operator/=(const simd_compl_split& x)
+{
+    *this = *this / x;
+    return *this;
+};
+
+}}
@@ -0,0 +1,266 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/accurate_sum.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                      SUM2, DOT2, AXPY2
+//-----------------------------------------------------------------------
+template<class Simd_type>
+struct accurate_sum_impl
+{
+    using simd_type     = Simd_type;
+    using value_type    = typename Simd_type::value_type;
+    using twofold_simd  = twofold<Simd_type>;
+    using twofold_val   = twofold<value_type>;
+
+    static const size_t
+    vector_size         = Simd_type::vector_size;
+
+    // number of independent accumulators; the loop is bounded by latency
+    // of additions otherwise
+    static const size_t
+    unroll              = 4;
+
+    // add x to the accumulator s + c, where s + x is computed exactly and
+    // rounding errors are accumulated in c
+    force_inline
+    static void add(simd_type& s, simd_type& c, const simd_type& x)
+    {
+        twofold_simd t  = twofold_sum(s, x);
+        s               = t.value;
+        c               = c + t.error;
+    };
+
+    // add x * y to the accumulator s + c, where x * y and s + x * y are
+    // computed exactly and rounding errors are accumulated in c
+    force_inline
+    static void add_prod(simd_type& s, simd_type& c, const simd_type& x, const simd_type& y)
+    {
+        twofold_simd p  = twofold_mult(x, y);
+        twofold_simd t  = twofold_sum(s, p.value);
+        s               = t.value;
+        c               = c + (t.error + p.error);
+    };
+
+    // sum all accumulators and all elements in the accumulator using the Sum2
+    // algorithm
+    static twofold_val reduce(simd_type& s0, simd_type& c0, const simd_type& s1,
+                            const simd_type& c1, const simd_type& s2, const simd_type& c2,
+                            const simd_type& s3, const simd_type& c3)
+    {
+        add(s0, c0, s1);
+        add(s0, c0, s2);
+        add(s0, c0, s3);
+
+        c0              = c0 + ((c1 + c2) + c3);
+
+        value_type buf_s[vector_size];
+        value_type buf_c[vector_size];
+
+        s0.store(buf_s, std::false_type());
+        c0.store(buf_c, std::false_type());
+
+        value_type s    = buf_s[0];
+        value_type c    = buf_c[0];
+
+        for (size_t i = 1; i < vector_size; ++i)
+        {
+            twofold_val t   = twofold_sum(s, buf_s[i]);
+            s               = t.value;
+            c               = c + (t.error + buf_c[i]);
+        };
+
+        return twofold_sum(s, c);
+    };
+
+    static twofold_val eval_sum2(const value_type* x, size_t n)
+    {
+        static const size_t step = unroll * vector_size;
+
+        simd_type s0    = simd_type::zero();
+        simd_type s1    = simd_type::zero();
+        simd_type s2    = simd_type::zero();
+        simd_type s3    = simd_type::zero();
+        simd_type c0    = simd_type::zero();
+        simd_type c1    = simd_type::zero();
+        simd_type c2    = simd_type::zero();
+        simd_type c3    = simd_type::zero();
+
+        size_t i        = 0;
+
+        for (; i + step <= n; i += step)
+        {
+            add(s0, c0, simd_type::load(x + i + 0 * vector_size, std::false_type()));
+            add(s1, c1, simd_type::load(x + i + 1 * vector_size, std::false_type()));
+            add(s2, c2, simd_type::load(x + i + 2 * vector_size, std::false_type()));
+            add(s3, c3, simd_type::load(x + i + 3 * vector_size, std::false_type()));
+        };
+
+        for (; i + vector_size <= n; i += vector_size)
+            add(s0, c0, simd_type::load(x + i, std::false_type()));
+
+        if (i < n)
+            add(s1, c1, simd_type::load_partial(x + i, int(n - i)));
+
+        return reduce(s0, c0, s1, c1, s2, c2, s3, c3);
+    };
+
+    static twofold_val eval_dot2(const value_type* x, const value_type* y, size_t n)
+    {
+        static const size_t step = unroll * vector_size;
+
+        simd_type s0    = simd_type::zero();
+        simd_type s1    = simd_type::zero();
+        simd_type s2    = simd_type::zero();
+        simd_type s3    = simd_type::zero();
+        simd_type c0    = simd_type::zero();
+        simd_type c1    = simd_type::zero();
+        simd_type c2    = simd_type::zero();
+        simd_type c3    = simd_type::zero();
+
+        size_t i        = 0;
+
+        for (; i + step <= n; i += step)
+        {
+            size_t i0   = i + 0 * vector_size;
+            size_t i1   = i + 1 * vector_size;
+            size_t i2   = i + 2 * vector_size;
+            size_t i3   = i + 3 * vector_size;
+
+            add_prod(s0, c0, simd_type::load(x + i0, std::false_type()),
+                             simd_type::load(y + i0, std::false_type()));
+            add_prod(s1, c1, simd_type::load(x + i1, std::false_type()),
+                             simd_type::load(y + i1, std::false_type()));
+            add_prod(s2, c2, simd_type::load(x + i2, std::false_type()),
+                             simd_type::load(y + i2, std::false_type()));
+            add_prod(s3, c3, simd_type::load(x + i3, std::false_type()),
+                             simd_type::load(y + i3, std::false_type()));
+        };
+
+        for (; i + vector_size <= n; i += vector_size)
+        {
+            add_prod(s0, c0, simd_type::load(x + i, std::false_type()),
+                             simd_type::load(y + i, std::false_type()));
+        };
+
+        if (i < n)
+        {
+            int rem     = int(n - i);
+            add_prod(s1, c1, simd_type::load_partial(x + i, rem),
+                             simd_type::load_partial(y + i, rem));
+        };
+
+        return reduce(s0, c0, s1, c1, s2, c2, s3, c3);
+    };
+
+    force_inline
+    static void eval_axpy2(const simd_type& a, const simd_type& x, simd_type& y, simd_type& y_err)
+    {
+        twofold_simd r  = twofold_simd(y, y_err) + twofold_mult(a, x);
+        y               = r.value;
+        y_err           = r.error;
+    };
+
+    static void eval_axpy2(const value_type& a, const value_type* x, value_type* y,
+                           value_type* y_err, size_t n)
+    {
+        simd_type av    = simd_type(a);
+        size_t i        = 0;
+
+        // the loop is not bounded by latency; there are no dependencies between
+        // iterations
+        for (; i + vector_size <= n; i += vector_size)
+        {
+            simd_type xv    = simd_type::load(x + i, std::false_type());
+            simd_type yv    = simd_type::load(y + i, std::false_type());
+            simd_type ev    = simd_type::load(y_err + i, std::false_type());
+
+            eval_axpy2(av, xv, yv, ev);
+
+            yv.store(y + i, std::false_type());
+            ev.store(y_err + i, std::false_type());
+        };
+
+        if (i < n)
+        {
+            int rem         = int(n - i);
+            simd_type xv    = simd_type::load_partial(x + i, rem);
+            simd_type yv    = simd_type::load_partial(y + i, rem);
+            simd_type ev    = simd_type::load_partial(y_err + i, rem);
+
+            eval_axpy2(av, xv, yv, ev);
+
+            yv.store_partial(y + i, rem);
+            ev.store_partial(y_err + i, rem);
+        };
+    };
+};
+
+}}}
+
+namespace matcl { namespace simd
+{
+
+namespace ms = matcl::simd;
+
+template<class Val>
+force_inline
+twofold<Val> ms::sum2(const Val* x, size_t n)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    return details::accurate_sum_impl<simd_type>::eval_sum2(x, n);
+};
+
+template<class Simd_type>
+force_inline
+twofold<typename Simd_type::value_type>
+ms::sum2(const typename Simd_type::value_type* x, size_t n)
+{
+    return details::accurate_sum_impl<Simd_type>::eval_sum2(x, n);
+};
+
+template<class Val>
+force_inline
+twofold<Val> ms::dot2(const Val* x, const Val* y, size_t n)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    return details::accurate_sum_impl<simd_type>::eval_dot2(x, y, n);
+};
+
+template<class Simd_type>
+force_inline
+twofold<typename Simd_type::value_type>
+ms::dot2(const typename Simd_type::value_type* x, const typename Simd_type::value_type* y,
+         size_t n)
+{
+    return details::accurate_sum_impl<Simd_type>::eval_dot2(x, y, n);
+};
+
+template<class Val>
+force_inline
+void ms::axpy2(const Val& a, const Val* x, Val* y, Val* y_err, size_t n)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    details::accurate_sum_impl<simd_type>::eval_axpy2(a, x, y, y_err, n);
+};
+
+template<class Simd_type>
+force_inline
+void ms::axpy2(const typename Simd_type::value_type& a, const typename Simd_type::value_type* x,
+               typename Simd_type::value_type* y, typename Simd_type::value_type* y_err, size_t n)
+{
+    details::accurate_sum_impl<Simd_type>::eval_axpy2(a, x, y, y_err, n);
+};
+
+}}
@@ -0,0 +1,445 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/accurate_sum.h"
+#include "matcl-simd/details/scalar_mat_func.h"
+
+#include <limits>
+#include <cmath>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                      REPRODUCIBLE SUMS
+//-----------------------------------------------------------------------
+
+// conversion of summands and products to vectors of doubles
+template<class Simd_type, class Val = typename Simd_type::value_type>
+struct repro_convert
+{
+    static_assert(md::dependent_false<Simd_type>::value, "unsupported simd type");
+};
+
+template<class Simd_type>
+struct repro_convert<Simd_type, double>
+{
+    using simd_double   = typename Simd_type::simd_double;
+
+    // number of vectors of doubles obtained from one vector of summands
+    static const int
+    parts               = 1;
+
+    force_inline
+    static void eval(const Simd_type& x, simd_double* out)
+    {
+        out[0]          = x;
+    };
+
+    // product is represented exactly as value + error
+    force_inline
+    static void eval_prod(const Simd_type& x, const Simd_type& y, simd_double* out)
+    {
+        twofold<simd_double> p  = twofold_mult(x, y);
+        out[0]          = p.value;
+        out[1]          = p.error;
+    };
+};
+
+template<class Simd_type>
+struct repro_convert<Simd_type, float>
+{
+    using simd_double   = typename Simd_type::simd_double;
+
+    // number of vectors of doubles obtained from one vector of summands
+    static const int
+    parts               = 2;
+
+    force_inline
+    static void eval(const Simd_type& x, simd_double* out)
+    {
+        out[0]          = x.convert_low_to_double();
+        out[1]          = x.convert_high_to_double();
+    };
+
+    // product of two floats is exact in double precision
+    force_inline
+    static void eval_prod(const Simd_type& x, const Simd_type& y, simd_double* out)
+    {
+        out[0]          = x.convert_low_to_double() * y.convert_low_to_double();
+        out[1]          = x.convert_high_to_double() * y.convert_high_to_double();
+    };
+};
+
+template<class Simd_type, int Fold>
+struct repro_kernel
+{
+    using value_type    = typename Simd_type::value_type;
+    using convert       = repro_convert<Simd_type>;
+    using simd_double   = typename convert::simd_double;
+
+    static const size_t
+    vector_size         = Simd_type::vector_size;
+
+    // split x into Fold parts on the grid given by sigma and add parts to acc;
+    // all operations are exact except of the pre-rounding sigma + r, which
+    // depends only on r
+    force_inline
+    static void deposit(simd_double* acc, const simd_double* sigma, const simd_double& x)
+    {
+        simd_double r       = x;
+
+        for (int k = 0; k < Fold - 1; ++k)
+        {
+            simd_double q   = (sigma[k] + r) - sigma[k];
+            acc[k]          = acc[k] + q;
+            r               = r - q;
+        };
+
+        simd_double q       = (sigma[Fold - 1] + r) - sigma[Fold - 1];
+        acc[Fold - 1]       = acc[Fold - 1] + q;
+    };
+
+    // add accumulated values to res; all additions are exact
+    force_inline
+    static void reduce(const simd_double* acc0, const simd_double* acc1, double* res)
+    {
+        for (int k = 0; k < Fold; ++k)
+            res[k]          = res[k] + horizontal_sum(acc0[k] + acc1[k]);
+    };
+
+    static void eval_sum(const value_type* x, size_t n, const double* sigma_s, double scale_s,
+                         double* res)
+    {
+        static const int parts  = convert::parts;
+        static const int loads  = 2 / parts;
+        static const size_t step = loads * vector_size;
+
+        simd_double sigma[Fold];
+        simd_double acc0[Fold];
+        simd_double acc1[Fold];
+        simd_double v[2];
+
+        simd_double scale   = simd_double(scale_s);
+
+        for (int k = 0; k < Fold; ++k)
+        {
+            sigma[k]        = simd_double(sigma_s[k]);
+            acc0[k]         = simd_double::zero();
+            acc1[k]         = simd_double::zero();
+        };
+
+        size_t i            = 0;
+
+        for (; i + step <= n; i += step)
+        {
+            for (int j = 0; j < loads; ++j)
+                convert::eval(Simd_type::load(x + i + j * vector_size, std::false_type()), v + j * parts);
+
+            deposit(acc0, sigma, v[0] * scale);
+            deposit(acc1, sigma, v[1] * scale);
+        };
+
+        for (; i < n; i += vector_size)
+        {
+            int rem         = (n - i < vector_size) ? int(n - i) : int(vector_size);
+
+            convert::eval(Simd_type::load_partial(x + i, rem), v);
+
+            for (int j = 0; j < parts; ++j)
+                deposit(acc0, sigma, v[j] * scale);
+        };
+
+        reduce(acc0, acc1, res);
+    };
+
+    static void eval_dot(const value_type* x, const value_type* y, size_t n, const double* sigma_s,
+                         double scale_s, double* res)
+    {
+        simd_double sigma[Fold];
+        simd_double acc0[Fold];
+        simd_double acc1[Fold];
+        simd_double v[2];
+
+        simd_double scale   = simd_double(scale_s);
+
+        for (int k = 0; k < Fold; ++k)
+        {
+            sigma[k]        = simd_double(sigma_s[k]);
+            acc0[k]         = simd_double::zero();
+            acc1[k]         = simd_double::zero();
+        };
+
+        size_t i            = 0;
+
+        for (; i + vector_size <= n; i += vector_size)
+        {
+            convert::eval_prod(Simd_type::load(x + i, std::false_type()),
+                               Simd_type::load(y + i, std::false_type()), v);
+
+            deposit(acc0, sigma, v[0] * scale);
+            deposit(acc1, sigma, v[1] * scale);
+        };
+
+        if (i < n)
+        {
+            int rem         = int(n - i);
+
+            convert::eval_prod(Simd_type::load_partial(x + i, rem),
+                               Simd_type::load_partial(y + i, rem), v);
+
+            deposit(acc0, sigma, v[0] * scale);
+            deposit(acc1, sigma, v[1] * scale);
+        };
+
+        reduce(acc0, acc1, res);
+    };
+
+    static double eval_max_abs(const value_type* x, size_t n)
+    {
+        simd_double mx      = simd_double::zero();
+        simd_double v[2];
+
+        for (size_t i = 0; i < n; i += vector_size)
+        {
+            int rem         = (n - i < vector_size) ? int(n - i) : int(vector_size);
+
+            convert::eval(Simd_type::load_partial(x + i, rem), v);
+
+            for (int j = 0; j < convert::parts; ++j)
+                mx          = max(mx, abs(v[j]));
+        };
+
+        return horizontal_max(mx);
+    };
+
+    static double eval_max_abs_prod(const value_type* x, const value_type* y, size_t n)
+    {
+        simd_double mx      = simd_double::zero();
+        simd_double v[2];
+
+        for (size_t i = 0; i < n; i += vector_size)
+        {
+            int rem         = (n - i < vector_size) ? int(n - i) : int(vector_size);
+
+            convert::eval_prod(Simd_type::load_partial(x + i, rem),
+                               Simd_type::load_partial(y + i, rem), v);
+
+            mx              = max(mx, max(abs(v[0]), abs(v[1])));
+        };
+
+        return horizontal_max(mx);
+    };
+};
+
+}}}
+
+namespace matcl { namespace simd
+{
+
+namespace ms = matcl::simd;
+
+template<class Val>
+repro_accumulator<Val>::repro_accumulator(double max_abs, size_t n)
+{
+    namespace msf   = ms::scalar_func;
+
+    double M        = std::abs(max_abs);
+
+    // inf or nan
+    m_special       = !(M <= std::numeric_limits<double>::max());
+    m_scale         = 1.0;
+    m_scale_inv     = 1.0;
+
+    for (int k = 0; k < fold; ++k)
+    {
+        m_acc[k]    = 0.0;
+        m_sigma[k]  = 0.0;
+    };
+
+    if (m_special == true)
+        return;
+
+    // each product in dot adds two summands; L = ceil(log2(2n))
+    int L           = 0;
+
+    while (L < 52 && (size_t(1) << L) < 2 * n)
+        ++L;
+
+    // M < 2^e; sum of 2^L summands bounded by 2^e is bounded by 2^(E - 1),
+    // therefore s + x, s = 1.5 * 2^E, is in [2^E, 2^(E+1)) and the sum
+    // of q parts, being multiples of 2^(E - 52), is exact
+    int e           = (int)msf::iexponent(M);
+    int E           = e + L + 1;
+
+    // 1.5 * 2^E must be finite
+    if (E > 1022)
+    {
+        m_scale     = msf::pow2k(double(1022 - E));
+        m_scale_inv = msf::pow2k(double(E - 1022));
+        E           = 1022;
+    };
+
+    // remainder after pre-rounding at level k is bounded by 2^(E_k - 53)
+    for (int k = 0; k < fold; ++k)
+    {
+        int E_k     = E - k * (52 - L);
+        E_k         = (E_k < -1022) ? -1022 : E_k;
+        m_sigma[k]  = 1.5 * msf::pow2k(double(E_k));
+    };
+};
+
+template<class Val>
+template<class Simd_type>
+force_inline
+void repro_accumulator<Val>::add(const Val* x, size_t n)
+{
+    if (m_special == true)
+    {
+        for (size_t i = 0; i < n; ++i)
+            m_acc[0]    += double(x[i]);
+
+        return;
+    };
+
+    add_impl<Simd_type>(x, n);
+};
+
+template<class Val>
+template<class Simd_type>
+force_inline
+void repro_accumulator<Val>::add_dot(const Val* x, const Val* y, size_t n)
+{
+    if (m_special == true)
+    {
+        for (size_t i = 0; i < n; ++i)
+            m_acc[0]    += double(x[i]) * double(y[i]);
+
+        return;
+    };
+
+    add_dot_impl<Simd_type>(x, y, n);
+};
+
+template<class Val>
+template<class Simd_type>
+void repro_accumulator<Val>::add_impl(const Val* x, size_t n)
+{
+    static_assert(std::is_same<typename Simd_type::value_type, Val>::value,
+                  "invalid simd type");
+
+    using kernel    = details::repro_kernel<Simd_type, fold>;
+    kernel::eval_sum(x, n, m_sigma, m_scale, m_acc);
+};
+
+template<class Val>
+template<class Simd_type>
+void repro_accumulator<Val>::add_dot_impl(const Val* x, const Val* y, size_t n)
+{
+    static_assert(std::is_same<typename Simd_type::value_type, Val>::value,
+                  "invalid simd type");
+
+    using kernel    = details::repro_kernel<Simd_type, fold>;
+    kernel::eval_dot(x, y, n, m_sigma, m_scale, m_acc);
+};
+
+template<class Val>
+force_inline
+void repro_accumulator<Val>::merge(const repro_accumulator& acc)
+{
+    for (int k = 0; k < fold; ++k)
+        m_acc[k]    = m_acc[k] + acc.m_acc[k];
+};
+
+template<class Val>
+Val repro_accumulator<Val>::value() const
+{
+    if (m_special == true)
+        return Val(m_acc[0]);
+
+    // sum of bins in fixed order
+    double val      = m_acc[0];
+    double err      = 0.0;
+
+    for (int k = 1; k < fold; ++k)
+    {
+        twofold<double> t   = twofold_sum(val, m_acc[k]);
+        val                 = t.value;
+        err                 = err + t.error;
+    };
+
+    double res      = (val + err) * m_scale_inv;
+    return Val(res);
+};
+
+template<class Val>
+template<class Simd_type>
+force_inline
+double repro_accumulator<Val>::max_abs(const Val* x, size_t n)
+{
+    using kernel    = details::repro_kernel<Simd_type, fold>;
+    return kernel::eval_max_abs(x, n);
+};
+
+template<class Val>
+template<class Simd_type>
+force_inline
+double repro_accumulator<Val>::max_abs_prod(const Val* x, const Val* y, size_t n)
+{
+    using kernel    = details::repro_kernel<Simd_type, fold>;
+    return kernel::eval_max_abs_prod(x, y, n);
+};
+
+template<class Val>
+force_inline
+Val ms::sum_repro(const Val* x, size_t n)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    return sum_repro<simd_type>(x, n);
+};
+
+template<class Simd_type>
+force_inline
+typename Simd_type::value_type
+ms::sum_repro(const typename Simd_type::value_type* x, size_t n)
+{
+    using value_type    = typename Simd_type::value_type;
+    using accumulator   = repro_accumulator<value_type>;
+
+    accumulator acc(accumulator::template max_abs<Simd_type>(x, n), n);
+    acc.template add<Simd_type>(x, n);
+
+    return acc.value();
+};
+
+template<class Val>
+force_inline
+Val ms::dot_repro(const Val* x, const Val* y, size_t n)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    return dot_repro<simd_type>(x, y, n);
+};
+
+template<class Simd_type>
+force_inline
+typename Simd_type::value_type
+ms::dot_repro(const typename Simd_type::value_type* x, const typename Simd_type::value_type* y,
+              size_t n)
+{
+    using value_type    = typename Simd_type::value_type;
+    using accumulator   = repro_accumulator<value_type>;
+
+    accumulator acc(accumulator::template max_abs_prod<Simd_type>(x, y, n), n);
+    acc.template add_dot<Simd_type>(x, y, n);
+
+    return acc.value();
+};
+
+}}
@@ -275,4 +275,36 @@ uint64_t simd::mulh(uint64_t x, uint64_t y)
     #endif
 };
 
+force_inline
+uint32_t simd::mulh(uint32_t x, uint32_t y)
+{
+    return uint32_t((uint64_t(x) * uint64_t(y)) >> 32);
+};
+
+force_inline
+int32_t simd::mulh(int32_t x, int32_t y)
+{
+    // arithmetic shift of negative values
+    return int32_t((int64_t(x) * int64_t(y)) >> 32);
+};
+
+force_inline
+int64_t simd::mulh(int64_t x, int64_t y)
+{
+    #if MATCL_ARCHITECTURE_64 && defined (_MSC_VER)
+
+        return __mulh(x, y);
+
+    #else
+
+        // signed high part is equal to the unsigned high part minus y if
+        // x < 0 and minus x if y < 0
+        uint64_t res        = mulh(uint64_t(x), uint64_t(y));
+        res                 -= (x < 0) ? uint64_t(y) : 0;
+        res                 -= (y < 0) ? uint64_t(x) : 0;
+
+        return int64_t(res);
+    #endif
+};
+
 }
@@ -0,0 +1,207 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd_divider.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                      MAGIC NUMBERS
+//-----------------------------------------------------------------------
+// magic number M and shift s for signed division by d, |d| >= 2 (Hacker's
+// Delight, figure 10-1); all computations are performed in unsigned
+// arithmetic; M is the smallest multiplier satisfying 2^(W+s) <= M*|d|
+// <= 2^(W+s) + 2^(s+1), stored modulo 2^W (M can be larger than the maximum
+// value of Val)
+template<class Val>
+struct divider_magic
+{
+    using uint_type     = typename std::make_unsigned<Val>::type;
+
+    static const int
+    bits                = int(sizeof(Val) * 8);
+
+    static void eval(Val d, Val& magic, unsigned int& shift)
+    {
+        const uint_type two = uint_type(1) << (bits - 1);
+
+        uint_type ad    = (d < 0) ? uint_type(0) - uint_type(d) : uint_type(d);
+        uint_type t     = two + (uint_type(d) >> (bits - 1));
+
+        // absolute value of nc
+        uint_type anc   = t - 1 - t % ad;
+
+        int p           = bits - 1;
+
+        // q1 = 2^p / |nc|, r1 = rem(2^p, |nc|)
+        uint_type q1    = two / anc;
+        uint_type r1    = two - q1 * anc;
+
+        // q2 = 2^p / |d|, r2 = rem(2^p, |d|)
+        uint_type q2    = two / ad;
+        uint_type r2    = two - q2 * ad;
+
+        uint_type delta;
+
+        do
+        {
+            ++p;
+
+            q1          = 2 * q1;
+            r1          = 2 * r1;
+
+            if (r1 >= anc)
+            {
+                q1      = q1 + 1;
+                r1      = r1 - anc;
+            };
+
+            q2          = 2 * q2;
+            r2          = 2 * r2;
+
+            if (r2 >= ad)
+            {
+                q2      = q2 + 1;
+                r2      = r2 - ad;
+            };
+
+            delta       = ad - r2;
+        }
+        while (q1 < delta || (q1 == delta && r1 == 0));
+
+        uint_type M     = q2 + 1;
+
+        if (d < 0)
+            M           = uint_type(0) - M;
+
+        magic           = Val(M);
+        shift           = (unsigned int)(p - bits);
+    };
+};
+
+}}}
+
+namespace matcl { namespace simd
+{
+
+namespace ms = matcl::simd;
+
+template<class Val>
+simd_divider<Val>::simd_divider(Val d)
+    :m_divisor(d)
+{
+    using uint_type = typename std::make_unsigned<Val>::type;
+
+    uint_type ad    = (d < 0) ? uint_type(0) - uint_type(d) : uint_type(d);
+
+    m_sign          = (d < 0) ? Val(-1) : Val(0);
+    m_is_one        = (ad == 1);
+
+    if (m_is_one == true)
+    {
+        m_magic     = 0;
+        m_shift     = 0;
+        m_add_mask  = 0;
+        return;
+    };
+
+    details::divider_magic<Val>::eval(d, m_magic, m_shift);
+
+    // the magic number does not fit in Val (stored value has wrong sign);
+    // n must be added (d > 0) or subtracted (d < 0) to the result of mulh
+    bool add        = (d > 0 && m_magic < 0) || (d < 0 && m_magic > 0);
+    m_add_mask      = add ? Val(-1) : Val(0);
+};
+
+template<class Val>
+force_inline
+Val simd_divider<Val>::divisor() const
+{
+    return m_divisor;
+};
+
+template<class Val>
+force_inline
+Val simd_divider<Val>::divide(Val x) const
+{
+    using uint_type = typename std::make_unsigned<Val>::type;
+
+    static const int bits   = int(sizeof(Val) * 8);
+
+    uint_type sign  = uint_type(m_sign);
+
+    // x or -x
+    if (m_is_one == true)
+        return Val((uint_type(x) ^ sign) - sign);
+
+    uint_type q     = uint_type(ms::mulh(m_magic, x));
+
+    // add x, subtract x, or do nothing
+    uint_type corr  = uint_type(x) & uint_type(m_add_mask);
+    q               = q + ((corr ^ sign) - sign);
+
+    Val qs          = Val(q) >> m_shift;
+
+    // add 1 if the quotient is negative
+    return Val(uint_type(qs) + (uint_type(qs) >> (bits - 1)));
+};
+
+template<class Val>
+force_inline
+Val simd_divider<Val>::remainder(Val x) const
+{
+    using uint_type = typename std::make_unsigned<Val>::type;
+
+    Val q           = divide(x);
+    return Val(uint_type(x) - uint_type(q) * uint_type(m_divisor));
+};
+
+template<class Val>
+template<int Bits, class Simd_tag>
+force_inline
+simd<Val, Bits, Simd_tag>
+simd_divider<Val>::divide(const simd<Val, Bits, Simd_tag>& x) const
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+
+    static const int bits   = int(sizeof(Val) * 8);
+
+    simd_type sign  = simd_type(m_sign);
+
+    // x or -x
+    if (m_is_one == true)
+        return bitwise_xor(x, sign) - sign;
+
+    simd_type q     = mulh(simd_type(m_magic), x);
+
+    // add x, subtract x, or do nothing
+    simd_type corr  = bitwise_and(x, simd_type(m_add_mask));
+    q               = q + (bitwise_xor(corr, sign) - sign);
+
+    q               = shift_right_arithmetic(q, m_shift);
+
+    // add 1 if the quotient is negative
+    return q + shift_right(q, bits - 1);
+};
+
+template<class Val>
+template<int Bits, class Simd_tag>
+force_inline
+simd<Val, Bits, Simd_tag>
+simd_divider<Val>::remainder(const simd<Val, Bits, Simd_tag>& x) const
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+
+    simd_type q     = divide(x);
+    return x - q * simd_type(m_divisor);
+};
+
+}}
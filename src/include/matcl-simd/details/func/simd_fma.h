@@ -15,6 +15,11 @@ namespace matcl { namespace simd { namespace details
 
 #if MATCL_ARCHITECTURE_HAS_FMA
 
+// functions compiled with FMA instructions are placed in the instruction set
+// namespace
+inline namespace MATCL_SIMD_ISA_NAMESPACE
+{
+
 // return x * y + z; use FMA instruction
 inline double fma_f(double x, double y, double z);
 inline float  fma_f(float x, float y, float z);
@@ -31,6 +36,8 @@ inline float  fnma_f(float x, float y, float z);
 inline double fnms_f(double x, double y, double z);
 inline float  fnms_f(float x, float y, float z);
 
+}
+
 #endif
 
 }}}
@@ -178,6 +178,22 @@ ms::mult(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
     return details::simd_mult<Val, Bits, Simd_tag>::eval(x, y);
 };
 
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd<Val, Bits, Simd_tag> 
+ms::mulh(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_mulh<Val, Bits, Simd_tag>::eval(x, y);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd<Val, Bits, Simd_tag> 
+ms::mulhu(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_mulhu<Val, Bits, Simd_tag>::eval(x, y);
+};
+
 template<class Val, int Bits, class Simd_tag>
 force_inline
 simd<Val, Bits, Simd_tag> 
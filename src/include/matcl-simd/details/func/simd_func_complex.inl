@@ -81,6 +81,73 @@ ms::operator/(const simd_compl<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Si
     return details::simd_compl_div<Val, Bits, Simd_tag>::eval_cr(x, y);
 };
 
+namespace details
+{
+
+template<class Policy>
+struct simd_compl_policy
+{
+    static_assert(md::dependent_false<Policy>::value, "unsupported policy");
+};
+
+template<>
+struct simd_compl_policy<compl_strict>
+{
+    template<class Val, int Bits, class Simd_tag>
+    force_inline
+    static simd_compl<Val, Bits, Simd_tag>
+    eval_mult(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+    {
+        return simd_compl_mult<Val, Bits, Simd_tag>::eval(x, y);
+    };
+
+    template<class Val, int Bits, class Simd_tag>
+    force_inline
+    static simd_compl<Val, Bits, Simd_tag>
+    eval_div(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+    {
+        return simd_compl_div<Val, Bits, Simd_tag>::eval(x, y);
+    };
+};
+
+template<>
+struct simd_compl_policy<compl_fast>
+{
+    template<class Val, int Bits, class Simd_tag>
+    force_inline
+    static simd_compl<Val, Bits, Simd_tag>
+    eval_mult(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+    {
+        return simd_compl_mult<Val, Bits, Simd_tag>::eval_fast(x, y);
+    };
+
+    template<class Val, int Bits, class Simd_tag>
+    force_inline
+    static simd_compl<Val, Bits, Simd_tag>
+    eval_div(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+    {
+        return simd_compl_div<Val, Bits, Simd_tag>::eval_fast(x, y);
+    };
+};
+
+}
+
+template<class Policy, class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl<Val, Bits, Simd_tag>
+ms::mult(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_compl_policy<Policy>::eval_mult(x, y);
+};
+
+template<class Policy, class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl<Val, Bits, Simd_tag>
+ms::div(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_compl_policy<Policy>::eval_div(x, y);
+};
+
 template<class Val, int Bits, class Simd_tag>
 force_inline
 simd_compl<Val, Bits, Simd_tag>
@@ -37,4 +37,11 @@ struct simd_compl_uminus{};
 template<class Val, int Bits, class Simd_tag>
 struct simd_compl_horizontal_sum{};
 
+// conversion between interleaved and planar representation of complex numbers
+// used by simd_compl_split; eval_deinterleave(a, b, re, im) stores real parts
+// of complex numbers [a, b] in re and imaginary parts in im, eval_interleave
+// is the inverse operation
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_split_shuffle{};
+
 }}}
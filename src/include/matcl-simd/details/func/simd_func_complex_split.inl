@@ -0,0 +1,212 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/basic_complex_functions.h"
+#include "matcl-simd/details/complex/simd_compl_split.inl"
+
+#include <limits>
+
+namespace matcl { namespace simd
+{
+
+namespace ms = matcl::simd;
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::conj(const simd_compl_split<Val, Bits, Simd_tag>& x)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(x.re, -x.im);
+};
+
+// (x.re * y.re - x.im * y.im, x.re * y.im + x.im * y.re)
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator*(const simd_compl_split<Val, Bits, Simd_tag>& x,
+              const simd_compl_split<Val, Bits, Simd_tag>& y)
+{
+    simd<Val, Bits, Simd_tag> re    = fms_f(x.re, y.re, x.im * y.im);
+    simd<Val, Bits, Simd_tag> im    = fma_f(x.re, y.im, x.im * y.re);
+
+    return simd_compl_split<Val, Bits, Simd_tag>(re, im);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator*(const simd<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(x * y.re, x * y.im);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator*(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(x.re * y, x.im * y);
+};
+
+// x / y = x * conj(z) / (s * |z|^2), where z = y / s, s = max(|y.re|, |y.im|)
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator/(const simd_compl_split<Val, Bits, Simd_tag>& x,
+              const simd_compl_split<Val, Bits, Simd_tag>& y)
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+
+    simd_type s     = max(abs(y.re), abs(y.im));
+    simd_type a     = y.re / s;
+    simd_type b     = y.im / s;
+    simd_type d     = s * fma_f(a, a, b * b);
+
+    simd_type re    = fma_f(x.re, a, x.im * b) / d;
+    simd_type im    = fms_f(x.im, a, x.re * b) / d;
+
+    return simd_compl_split<Val, Bits, Simd_tag>(re, im);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator/(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(x.re / y, x.im / y);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator+(const simd_compl_split<Val, Bits, Simd_tag>& x,
+              const simd_compl_split<Val, Bits, Simd_tag>& y)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(x.re + y.re, x.im + y.im);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator-(const simd_compl_split<Val, Bits, Simd_tag>& x,
+              const simd_compl_split<Val, Bits, Simd_tag>& y)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(x.re - y.re, x.im - y.im);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::operator-(const simd_compl_split<Val, Bits, Simd_tag>& x)
+{
+    return simd_compl_split<Val, Bits, Simd_tag>(-x.re, -x.im);
+};
+
+// (z.re + x.re * y.re - x.im * y.im, z.im + x.re * y.im + x.im * y.re)
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::fma_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y,
+          const simd_compl_split<Val, Bits, Simd_tag>& z)
+{
+    simd<Val, Bits, Simd_tag> re    = fma_f(x.re, y.re, fnma_f(x.im, y.im, z.re));
+    simd<Val, Bits, Simd_tag> im    = fma_f(x.re, y.im, fma_f(x.im, y.re, z.im));
+
+    return simd_compl_split<Val, Bits, Simd_tag>(re, im);
+};
+
+// (x.re * y.re - (x.im * y.im + z.re), x.re * y.im + (x.im * y.re - z.im))
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::fms_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y,
+          const simd_compl_split<Val, Bits, Simd_tag>& z)
+{
+    simd<Val, Bits, Simd_tag> re    = fms_f(x.re, y.re, fma_f(x.im, y.im, z.re));
+    simd<Val, Bits, Simd_tag> im    = fma_f(x.re, y.im, fms_f(x.im, y.re, z.im));
+
+    return simd_compl_split<Val, Bits, Simd_tag>(re, im);
+};
+
+// (-x.re * y.re + (x.im * y.im + z.re), -x.re * y.im + (-x.im * y.re + z.im))
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::fnma_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y,
+          const simd_compl_split<Val, Bits, Simd_tag>& z)
+{
+    simd<Val, Bits, Simd_tag> re    = fnma_f(x.re, y.re, fma_f(x.im, y.im, z.re));
+    simd<Val, Bits, Simd_tag> im    = fnma_f(x.re, y.im, fnma_f(x.im, y.re, z.im));
+
+    return simd_compl_split<Val, Bits, Simd_tag>(re, im);
+};
+
+// (-x.re * y.re - (-x.im * y.im + z.re), -x.re * y.im - (x.im * y.re + z.im))
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd_compl_split<Val, Bits, Simd_tag>
+ms::fnms_f(const simd_compl_split<Val, Bits, Simd_tag>& x, const simd_compl_split<Val, Bits, Simd_tag>& y,
+          const simd_compl_split<Val, Bits, Simd_tag>& z)
+{
+    simd<Val, Bits, Simd_tag> re    = fnms_f(x.re, y.re, fnma_f(x.im, y.im, z.re));
+    simd<Val, Bits, Simd_tag> im    = fnms_f(x.re, y.im, fma_f(x.im, y.re, z.im));
+
+    return simd_compl_split<Val, Bits, Simd_tag>(re, im);
+};
+
+// abs(x) = mx * sqrt(1 + (mn / mx)^2), where mx = max(|x.re|, |x.im|) and
+// mn = min(|x.re|, |x.im|)
+template<class Val, int Bits, class Simd_tag>
+force_inline
+simd<Val, Bits, Simd_tag>
+ms::abs(const simd_compl_split<Val, Bits, Simd_tag>& x)
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+
+    const simd_type zero    = simd_type::zero();
+    const simd_type one     = simd_type::one();
+    const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+    simd_type ar    = abs(x.re);
+    simd_type ai    = abs(x.im);
+    simd_type mx    = max(ar, ai);
+    simd_type mn    = min(ar, ai);
+
+    simd_type r     = mn / mx;
+    simd_type res   = mx * sqrt(fma_f(r, r, one));
+
+    // mx = 0 or mx = inf gives r = NaN; max and min do not propagate NaN
+    res             = if_then_else(eeq(mx, zero), zero, res);
+
+    simd_type sum   = ar + ai;
+    res             = if_then_else(is_nan(sum), sum, res);
+    res             = if_then_else(eeq(ar, inf) || eeq(ai, inf), inf, res);
+
+    return res;
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+typename simd_compl_split<Val, Bits, Simd_tag>::value_type
+ms::horizontal_sum(const simd_compl_split<Val, Bits, Simd_tag>& x)
+{
+    using value_type    = typename simd_compl_split<Val, Bits, Simd_tag>::value_type;
+    return value_type(horizontal_sum(x.re), horizontal_sum(x.im));
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline
+bool
+ms::any_nan(const simd_compl_split<Val, Bits, Simd_tag>& x)
+{
+    return any_nan(x.re) || any_nan(x.im);
+};
+
+}}
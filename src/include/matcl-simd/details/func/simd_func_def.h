@@ -99,6 +99,20 @@ struct simd_mult
                 "function mult not defined for for given arguments");
 };
 
+template<class Val, int Bits, class Simd_tag>
+struct simd_mulh
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function mulh not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_mulhu
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function mulhu not defined for for given arguments");
+};
+
 template<class Val, int Bits, class Simd_tag>
 struct simd_div
 {
@@ -0,0 +1,211 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd_mask.h"
+#include "matcl-simd/other_functions.h"
+#include "matcl-simd/details/func/simd_mask_def.h"
+
+namespace matcl { namespace simd
+{
+
+namespace ms = matcl::simd;
+
+//-----------------------------------------------------------------------
+//                   simd_mask
+//-----------------------------------------------------------------------
+template<class Val, int Bits, class Tag>
+force_inline
+simd_mask<Val, Bits, Tag>::simd_mask(const impl_type& bits)
+    : data(bits)
+{};
+
+template<class Val, int Bits, class Tag>
+force_inline
+simd_mask<Val, Bits, Tag>::simd_mask(const simd_type& test)
+    : data(details::simd_mask_from_vector<Val, Bits, Tag>::eval(test))
+{};
+
+template<class Val, int Bits, class Tag>
+force_inline
+bool simd_mask<Val, Bits, Tag>::get(int pos) const
+{
+    return ((uint32_t(data) >> pos) & 1) != 0;
+};
+
+template<class Val, int Bits, class Tag>
+force_inline typename simd_mask<Val, Bits, Tag>::simd_type
+simd_mask<Val, Bits, Tag>::as_vector() const
+{
+    return details::simd_mask_to_vector<Val, Bits, Tag>::eval(data);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+simd_mask<Val, Bits, Tag>::zero()
+{
+    return simd_mask(impl_type(0));
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+simd_mask<Val, Bits, Tag>::full()
+{
+    return simd_mask(impl_type((uint32_t(1) << vector_size) - 1));
+};
+
+//-----------------------------------------------------------------------
+//                   LOGICAL FUNCTIONS
+//-----------------------------------------------------------------------
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::operator &&(const simd_mask<Val, Bits, Tag>& x, const simd_mask<Val, Bits, Tag>& y)
+{
+    using impl_type = typename simd_mask<Val, Bits, Tag>::impl_type;
+    return simd_mask<Val, Bits, Tag>(impl_type(x.data & y.data));
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::operator ||(const simd_mask<Val, Bits, Tag>& x, const simd_mask<Val, Bits, Tag>& y)
+{
+    using impl_type = typename simd_mask<Val, Bits, Tag>::impl_type;
+    return simd_mask<Val, Bits, Tag>(impl_type(x.data | y.data));
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::operator !(const simd_mask<Val, Bits, Tag>& x)
+{
+    using impl_type = typename simd_mask<Val, Bits, Tag>::impl_type;
+    return simd_mask<Val, Bits, Tag>(impl_type(~x.data & simd_mask<Val, Bits, Tag>::full().data));
+};
+
+//-----------------------------------------------------------------------
+//                   REDUCE FUNCTIONS
+//-----------------------------------------------------------------------
+template<class Val, int Bits, class Tag>
+force_inline
+int ms::popcount(const simd_mask<Val, Bits, Tag>& x)
+{
+    return (int)number_bits_set(uint32_t(x.data));
+};
+
+template<class Val, int Bits, class Tag>
+force_inline
+bool ms::any(const simd_mask<Val, Bits, Tag>& x)
+{
+    return x.data != 0;
+};
+
+template<class Val, int Bits, class Tag>
+force_inline
+bool ms::all(const simd_mask<Val, Bits, Tag>& x)
+{
+    return x.data == simd_mask<Val, Bits, Tag>::full().data;
+};
+
+template<class Val, int Bits, class Tag>
+force_inline
+int ms::first_set(const simd_mask<Val, Bits, Tag>& x)
+{
+    if (x.data == 0)
+        return -1;
+
+    return (int)number_trailing_zeros(uint32_t(x.data));
+};
+
+//-----------------------------------------------------------------------
+//                   COMPARISON FUNCTIONS
+//-----------------------------------------------------------------------
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::eeq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::eeq(x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::neq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::neq(x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::lt_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::lt(x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::gt_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::gt(x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::leq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::leq(x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::geq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::geq(x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::is_nan_mask(const simd<Val, Bits, Tag>& x)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::is_nan(x);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd_mask<Val, Bits, Tag>
+ms::is_finite_mask(const simd<Val, Bits, Tag>& x)
+{
+    return details::simd_mask_compare<Val, Bits, Tag>::is_finite(x);
+};
+
+//-----------------------------------------------------------------------
+//                   CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+template<class Val, int Bits, class Tag>
+force_inline simd<Val, Bits, Tag>
+ms::if_then_else(const simd_mask<Val, Bits, Tag>& test, const simd<Val, Bits, Tag>& val_true,
+                 const simd<Val, Bits, Tag>& val_false)
+{
+    return details::simd_mask_conditional<Val, Bits, Tag>
+                ::if_then_else(test.data, val_true, val_false);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd<Val, Bits, Tag>
+ms::if_add(const simd_mask<Val, Bits, Tag>& test, const simd<Val, Bits, Tag>& x,
+           const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_conditional<Val, Bits, Tag>::if_add(test.data, x, y);
+};
+
+template<class Val, int Bits, class Tag>
+force_inline simd<Val, Bits, Tag>
+ms::if_sub(const simd_mask<Val, Bits, Tag>& test, const simd<Val, Bits, Tag>& x,
+           const simd<Val, Bits, Tag>& y)
+{
+    return details::simd_mask_conditional<Val, Bits, Tag>::if_sub(test.data, x, y);
+};
+
+}}
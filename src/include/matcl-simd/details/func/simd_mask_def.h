@@ -0,0 +1,227 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd_general.h"
+#include "matcl-simd/basic_functions.h"
+#include "matcl-simd/details/utils.h"
+
+#include <type_traits>
+
+namespace matcl { namespace simd { namespace details
+{
+
+namespace ms = matcl::simd;
+
+// implementation type of simd_mask<Val, Bits, Simd_tag>; bit field returned
+// by movemask instructions by default
+template<class Val, int Bits, class Simd_tag>
+struct simd_mask_impl_type
+{
+    using type = uint32_t;
+};
+
+// vector of integers with i-th bit set in i-th element
+template<class Int>
+struct simd_mask_lane_bits
+{};
+
+template<>
+struct simd_mask_lane_bits<int32_t>
+{
+    force_inline
+    static const int32_t* get()
+    {
+        alignas(64) static const int32_t bits[16]
+            = { 0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000 };
+
+        return bits;
+    };
+};
+
+template<>
+struct simd_mask_lane_bits<int64_t>
+{
+    force_inline
+    static const int64_t* get()
+    {
+        alignas(64) static const int64_t bits[8]
+            = { 0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080 };
+
+        return bits;
+    };
+};
+
+template<class Val_ret, class Val, int Bits, class Simd_tag,
+         bool Same = std::is_same<Val_ret, Val>::value>
+struct simd_mask_reinterpret
+{
+    force_inline
+    static simd<Val_ret, Bits, Simd_tag> eval(const simd<Val, Bits, Simd_tag>& x)
+    {
+        return ms::reinterpret_as<Val_ret>(x);
+    };
+};
+
+template<class Val_ret, class Val, int Bits, class Simd_tag>
+struct simd_mask_reinterpret<Val_ret, Val, Bits, Simd_tag, true>
+{
+    force_inline
+    static simd<Val_ret, Bits, Simd_tag> eval(const simd<Val, Bits, Simd_tag>& x)
+    {
+        return x;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                  CONVERSIONS
+//-----------------------------------------------------------------------
+// convert a vector containing true_value or false_value to a mask; generic
+// version testing sign bits of all elements
+template<class Val, int Bits, class Simd_tag>
+struct simd_mask_from_vector
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+    using impl_type = typename simd_mask_impl_type<Val, Bits, Simd_tag>::type;
+    using int_type  = typename integer_type<Val>::type;
+
+    static const int
+    vector_size     = simd_type::vector_size;
+
+    force_inline
+    static impl_type eval(const simd_type& x)
+    {
+        const int_type* ptr = reinterpret_cast<const int_type*>(x.get_raw_ptr());
+
+        impl_type res   = 0;
+        for (int i = 0; i < vector_size; ++i)
+            res         |= impl_type(ptr[i] < 0 ? 1 : 0) << i;
+
+        return res;
+    };
+};
+
+// convert a mask to a vector containing true_value or false_value; generic
+// version based on integer vector operations
+template<class Val, int Bits, class Simd_tag>
+struct simd_mask_to_vector
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+    using impl_type = typename simd_mask_impl_type<Val, Bits, Simd_tag>::type;
+    using int_type  = typename integer_type<Val>::type;
+    using simd_int  = simd<int_type, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const impl_type& m)
+    {
+        const int_type* ptr = simd_mask_lane_bits<int_type>::get();
+
+        simd_int bits   = simd_int::load(ptr, std::true_type());
+        simd_int test   = ms::bitwise_and(simd_int(int_type(m)), bits);
+        simd_int res    = ms::eeq(test, bits);
+
+        return simd_mask_reinterpret<Val, int_type, Bits, Simd_tag>::eval(res);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                  COMPARISON FUNCTIONS
+//-----------------------------------------------------------------------
+// comparisons returning masks; generic version converting results of
+// vector comparisons
+template<class Val, int Bits, class Simd_tag>
+struct simd_mask_compare
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+    using impl_type = typename simd_mask_impl_type<Val, Bits, Simd_tag>::type;
+    using convert   = simd_mask_from_vector<Val, Bits, Simd_tag>;
+
+    force_inline
+    static impl_type eeq(const simd_type& x, const simd_type& y)
+    {
+        return convert::eval(ms::eeq(x, y));
+    };
+
+    force_inline
+    static impl_type neq(const simd_type& x, const simd_type& y)
+    {
+        return convert::eval(ms::neq(x, y));
+    };
+
+    force_inline
+    static impl_type lt(const simd_type& x, const simd_type& y)
+    {
+        return convert::eval(ms::lt(x, y));
+    };
+
+    force_inline
+    static impl_type gt(const simd_type& x, const simd_type& y)
+    {
+        return convert::eval(ms::gt(x, y));
+    };
+
+    force_inline
+    static impl_type leq(const simd_type& x, const simd_type& y)
+    {
+        return convert::eval(ms::leq(x, y));
+    };
+
+    force_inline
+    static impl_type geq(const simd_type& x, const simd_type& y)
+    {
+        return convert::eval(ms::geq(x, y));
+    };
+
+    force_inline
+    static impl_type is_nan(const simd_type& x)
+    {
+        return convert::eval(ms::is_nan(x));
+    };
+
+    force_inline
+    static impl_type is_finite(const simd_type& x)
+    {
+        return convert::eval(ms::is_finite(x));
+    };
+};
+
+//-----------------------------------------------------------------------
+//                  CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+// conditional functions taking masks; generic version expanding masks
+// to vectors
+template<class Val, int Bits, class Simd_tag>
+struct simd_mask_conditional
+{
+    using simd_type = simd<Val, Bits, Simd_tag>;
+    using impl_type = typename simd_mask_impl_type<Val, Bits, Simd_tag>::type;
+    using convert   = simd_mask_to_vector<Val, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type if_then_else(const impl_type& test, const simd_type& val_true,
+                                  const simd_type& val_false)
+    {
+        return ms::if_then_else(convert::eval(test), val_true, val_false);
+    };
+
+    force_inline
+    static simd_type if_add(const impl_type& test, const simd_type& x, const simd_type& y)
+    {
+        return ms::if_add(convert::eval(test), x, y);
+    };
+
+    force_inline
+    static simd_type if_sub(const impl_type& test, const simd_type& x, const simd_type& y)
+    {
+        return ms::if_sub(convert::eval(test), x, y);
+    };
+};
+
+}}}
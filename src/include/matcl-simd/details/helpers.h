@@ -25,6 +25,12 @@ struct simd_half_tag<avx_tag>
     using type = sse_tag;
 };
 
+template<>
+struct simd_half_tag<avx512_tag>
+{
+    using type = avx_tag;
+};
+
 
 template<class T>
 struct simd_compl_from_real{};
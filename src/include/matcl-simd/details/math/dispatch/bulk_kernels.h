@@ -0,0 +1,52 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd_dispatch.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// functions available through the dispatch table
+enum class bulk_function
+{
+    exp, log, sin, cos, tan, cot,
+    sinh, cosh, tanh, sigmoid, softplus,
+    sqrt, abs, round, floor, ceil, trunc, fraction, exponent,
+    size
+};
+
+using bulk_func_double  = void (*)(const double* in, double* out, size_t n);
+using bulk_func_float   = void (*)(const float* in, float* out, size_t n);
+
+// functions with two outputs
+using bulk_func2_double = void (*)(const double* in, double* out_1, double* out_2, size_t n);
+using bulk_func2_float  = void (*)(const float* in, float* out_1, float* out_2, size_t n);
+
+// pointers to implementations of bulk functions compiled for one instruction
+// set
+struct bulk_function_table
+{
+    bulk_func_double    func_double[(int)bulk_function::size];
+    bulk_func_float     func_float[(int)bulk_function::size];
+
+    bulk_func2_double   sincos_double;
+    bulk_func2_float    sincos_float;
+};
+
+// fill the table with functions compiled for given instruction set; each
+// of these functions is defined in a separate translation unit compiled
+// with compiler flags enabling required instruction set; these functions
+// can be called on any processor
+void    init_bulk_table_sse2(bulk_function_table& table);
+void    init_bulk_table_sse41(bulk_function_table& table);
+void    init_bulk_table_avx2(bulk_function_table& table);
+void    init_bulk_table_avx512(bulk_function_table& table);
+
+}}}
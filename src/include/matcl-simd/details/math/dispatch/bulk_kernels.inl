@@ -0,0 +1,383 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+// this file must be included only by translation units implementing bulk
+// functions for one instruction set; MATCL_ARCHITECTURE_HAS_XXX macros and
+// MATCL_SIMD_ISA_NAMESPACE must be defined before including this file;
+// functions are not always inlined (for example in debug builds), therefore
+// simd types must be defined in a namespace specific to given instruction
+// set; kernels defined here have internal linkage
+
+#include "matcl-simd/details/math/dispatch/bulk_kernels.h"
+#include "matcl-simd/details/float/fma_dekker_double.inl"
+#include "matcl-simd/simd_math.h"
+#include "matcl-simd/simd_utils.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+namespace ms = matcl::simd;
+
+namespace
+{
+
+struct bulk_exp
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::exp(x); };
+};
+
+struct bulk_log
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::log(x); };
+};
+
+struct bulk_sin
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::sin(x); };
+};
+
+struct bulk_cos
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::cos(x); };
+};
+
+struct bulk_tan
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::tan(x); };
+};
+
+struct bulk_cot
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::cot(x); };
+};
+
+struct bulk_sinh
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::sinh(x); };
+};
+
+struct bulk_cosh
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::cosh(x); };
+};
+
+struct bulk_tanh
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::tanh(x); };
+};
+
+struct bulk_sigmoid
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::sigmoid(x); };
+};
+
+struct bulk_softplus
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::softplus(x); };
+};
+
+struct bulk_sqrt
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::sqrt(x); };
+};
+
+struct bulk_abs
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::abs(x); };
+};
+
+struct bulk_round
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::round(x); };
+};
+
+struct bulk_floor
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::floor(x); };
+};
+
+struct bulk_ceil
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::ceil(x); };
+};
+
+struct bulk_trunc
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::trunc(x); };
+};
+
+struct bulk_fraction
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::fraction(x); };
+};
+
+struct bulk_exponent
+{
+    template<class Simd_type>
+    force_inline
+    static Simd_type eval(const Simd_type& x)   { return ms::exponent(x); };
+};
+
+// evaluate Func on arrays using the widest simd type available in current
+// translation unit
+template<class Val, class Func>
+struct bulk_kernel
+{
+    using simd_type     = typename default_simd_type<Val>::type;
+
+    static const size_t
+    vector_size         = simd_type::vector_size;
+
+    static const size_t
+    alignment           = sizeof(simd_type);
+
+    // number of vectors processed in one iteration of the main loop; this
+    // hides latency of polynomial evaluations in math functions
+    static const size_t
+    unroll              = 4;
+
+    static void eval(const Val* in, Val* out, size_t n)
+    {
+        // aligned stores are not possible
+        if ((uintptr_t)out % sizeof(Val) != 0)
+            return eval_main(in, out, n, std::false_type());
+
+        // process elements before the first aligned position in out
+        size_t head     = get_offset<alignment, Val>(out);
+        head            = (head < n) ? head : n;
+
+        eval_partial(in, out, head);
+        eval_main(in + head, out + head, n - head, std::true_type());
+    };
+
+    template<class Aligned>
+    force_inline
+    static void eval_main(const Val* in, Val* out, size_t n, Aligned al)
+    {
+        static const size_t step = unroll * vector_size;
+
+        size_t i        = 0;
+
+        for (; i + step <= n; i += step)
+        {
+            simd_type x0    = simd_type::load(in + i + 0 * vector_size, std::false_type());
+            simd_type x1    = simd_type::load(in + i + 1 * vector_size, std::false_type());
+            simd_type x2    = simd_type::load(in + i + 2 * vector_size, std::false_type());
+            simd_type x3    = simd_type::load(in + i + 3 * vector_size, std::false_type());
+
+            simd_type y0    = Func::eval(x0);
+            simd_type y1    = Func::eval(x1);
+            simd_type y2    = Func::eval(x2);
+            simd_type y3    = Func::eval(x3);
+
+            y0.store(out + i + 0 * vector_size, al);
+            y1.store(out + i + 1 * vector_size, al);
+            y2.store(out + i + 2 * vector_size, al);
+            y3.store(out + i + 3 * vector_size, al);
+        };
+
+        for (; i + vector_size <= n; i += vector_size)
+        {
+            simd_type x     = simd_type::load(in + i, std::false_type());
+            Func::eval(x).store(out + i, al);
+        };
+
+        eval_partial(in + i, out + i, n - i);
+    };
+
+    // process n < vector_size elements using partial loads and stores;
+    // remaining elements of a vector are set to zero
+    force_inline
+    static void eval_partial(const Val* in, Val* out, size_t n)
+    {
+        if (n == 0)
+            return;
+
+        simd_type x     = simd_type::load_partial(in, (int)n);
+        Func::eval(x).store_partial(out, (int)n);
+    };
+};
+
+// evaluate sine and cosine on arrays; the same as bulk_kernel, but with two
+// outputs; alignment is determined by out_sin
+template<class Val>
+struct bulk_kernel_sincos
+{
+    using simd_type     = typename default_simd_type<Val>::type;
+
+    static const size_t
+    vector_size         = simd_type::vector_size;
+
+    static const size_t
+    alignment           = sizeof(simd_type);
+
+    static const size_t
+    unroll              = 4;
+
+    static void eval(const Val* in, Val* out_sin, Val* out_cos, size_t n)
+    {
+        // aligned stores are not possible
+        if ((uintptr_t)out_sin % sizeof(Val) != 0)
+            return eval_main(in, out_sin, out_cos, n, std::false_type(), std::false_type());
+
+        size_t head     = get_offset<alignment, Val>(out_sin);
+        head            = (head < n) ? head : n;
+
+        eval_partial(in, out_sin, out_cos, head);
+
+        in              += head;
+        out_sin         += head;
+        out_cos         += head;
+        n               -= head;
+
+        // out_cos is aligned only if it has the same offset as out_sin
+        if (get_offset<alignment, Val>(out_cos) == 0)
+            eval_main(in, out_sin, out_cos, n, std::true_type(), std::true_type());
+        else
+            eval_main(in, out_sin, out_cos, n, std::true_type(), std::false_type());
+    };
+
+    template<class Aligned_sin, class Aligned_cos>
+    force_inline
+    static void eval_main(const Val* in, Val* out_sin, Val* out_cos, size_t n, 
+                          Aligned_sin al_s, Aligned_cos al_c)
+    {
+        static const size_t step = unroll * vector_size;
+
+        size_t i        = 0;
+
+        for (; i + step <= n; i += step)
+        {
+            simd_type x0    = simd_type::load(in + i + 0 * vector_size, std::false_type());
+            simd_type x1    = simd_type::load(in + i + 1 * vector_size, std::false_type());
+            simd_type x2    = simd_type::load(in + i + 2 * vector_size, std::false_type());
+            simd_type x3    = simd_type::load(in + i + 3 * vector_size, std::false_type());
+
+            simd_type s0, s1, s2, s3, c0, c1, c2, c3;
+
+            ms::sincos(x0, s0, c0);
+            ms::sincos(x1, s1, c1);
+            ms::sincos(x2, s2, c2);
+            ms::sincos(x3, s3, c3);
+
+            s0.store(out_sin + i + 0 * vector_size, al_s);
+            s1.store(out_sin + i + 1 * vector_size, al_s);
+            s2.store(out_sin + i + 2 * vector_size, al_s);
+            s3.store(out_sin + i + 3 * vector_size, al_s);
+
+            c0.store(out_cos + i + 0 * vector_size, al_c);
+            c1.store(out_cos + i + 1 * vector_size, al_c);
+            c2.store(out_cos + i + 2 * vector_size, al_c);
+            c3.store(out_cos + i + 3 * vector_size, al_c);
+        };
+
+        for (; i + vector_size <= n; i += vector_size)
+        {
+            simd_type x     = simd_type::load(in + i, std::false_type());
+            simd_type s, c;
+
+            ms::sincos(x, s, c);
+
+            s.store(out_sin + i, al_s);
+            c.store(out_cos + i, al_c);
+        };
+
+        eval_partial(in + i, out_sin + i, out_cos + i, n - i);
+    };
+
+    force_inline
+    static void eval_partial(const Val* in, Val* out_sin, Val* out_cos, size_t n)
+    {
+        if (n == 0)
+            return;
+
+        simd_type x     = simd_type::load_partial(in, (int)n);
+        simd_type s, c;
+
+        ms::sincos(x, s, c);
+
+        s.store_partial(out_sin, (int)n);
+        c.store_partial(out_cos, (int)n);
+    };
+};
+
+#define MATCL_SIMD_INIT_BULK_FUNCTION(name)               \
+    table.func_double[(int)bulk_function::name]           \
+        = &bulk_kernel<double, bulk_##name>::eval;        \
+    table.func_float[(int)bulk_function::name]            \
+        = &bulk_kernel<float, bulk_##name>::eval;
+
+void init_bulk_table(bulk_function_table& table)
+{
+    MATCL_SIMD_INIT_BULK_FUNCTION(exp)
+    MATCL_SIMD_INIT_BULK_FUNCTION(log)
+    MATCL_SIMD_INIT_BULK_FUNCTION(sin)
+    MATCL_SIMD_INIT_BULK_FUNCTION(cos)
+    MATCL_SIMD_INIT_BULK_FUNCTION(tan)
+    MATCL_SIMD_INIT_BULK_FUNCTION(cot)
+    MATCL_SIMD_INIT_BULK_FUNCTION(sinh)
+    MATCL_SIMD_INIT_BULK_FUNCTION(cosh)
+    MATCL_SIMD_INIT_BULK_FUNCTION(tanh)
+    MATCL_SIMD_INIT_BULK_FUNCTION(sigmoid)
+    MATCL_SIMD_INIT_BULK_FUNCTION(softplus)
+    MATCL_SIMD_INIT_BULK_FUNCTION(sqrt)
+    MATCL_SIMD_INIT_BULK_FUNCTION(abs)
+    MATCL_SIMD_INIT_BULK_FUNCTION(round)
+    MATCL_SIMD_INIT_BULK_FUNCTION(floor)
+    MATCL_SIMD_INIT_BULK_FUNCTION(ceil)
+    MATCL_SIMD_INIT_BULK_FUNCTION(trunc)
+    MATCL_SIMD_INIT_BULK_FUNCTION(fraction)
+    MATCL_SIMD_INIT_BULK_FUNCTION(exponent)
+
+    table.sincos_double = &bulk_kernel_sincos<double>::eval;
+    table.sincos_float  = &bulk_kernel_sincos<float>::eval;
+};
+
+#undef MATCL_SIMD_INIT_BULK_FUNCTION
+
+}
+
+}}}
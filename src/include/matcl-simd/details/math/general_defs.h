@@ -10,8 +10,15 @@
 
 #include "matcl-simd/details/math/impl/simd_exp.h"
 #include "matcl-simd/details/math/impl/simd_log.h"
+#include "matcl-simd/details/math/impl/simd_pow.h"
 #include "matcl-simd/details/math/impl/simd_sincos_double.h"
 #include "matcl-simd/details/math/impl/simd_sincos_float.h"
 #include "matcl-simd/details/math/impl/simd_tan_double.h"
 #include "matcl-simd/details/math/impl/simd_tan_float.h"
+#include "matcl-simd/details/math/impl/simd_atan.h"
+#include "matcl-simd/details/math/impl/simd_hyperbolic.h"
+#include "matcl-simd/details/math/impl/simd_erf.h"
+#include "matcl-simd/details/math/impl/simd_root.h"
+#include "matcl-simd/details/math/impl/simd_gamma.h"
+#include "matcl-simd/details/math/impl/simd_complex_math.h"
 #include "matcl-simd/details/math/impl/simd_math_impl.h"
@@ -17,6 +17,10 @@ namespace matcl { namespace simd { namespace details
 struct MATCL_SIMD_EXPORT two_by_pi_table
 {
     static const uint32_t table[43];
+
+    // bits of table split into 24-bit blocks stored as doubles and preceded
+    // by 4 zero blocks; used by the vectorized Payne-Hanek algorithm
+    static const double table_24[61];
 };
 
 }}};
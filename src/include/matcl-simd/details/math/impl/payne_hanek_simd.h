@@ -0,0 +1,231 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/config.h"
+#include "matcl-simd/details/math/impl/payne_hanek.h"
+#include "matcl-simd/details/float/twofold.h"
+#include "matcl-simd/simd_math.h"
+
+#pragma warning(push)
+#pragma warning(disable: 4127)  //conditional expression is constant
+
+namespace matcl { namespace simd { namespace details
+{
+
+// vectorized version of the Payne-Hanek algorithm; decompose x as
+//      x = (k + 4 * l) * pi/2 + frac
+// where k, l are integers, 0 <= k < 4, |frac| <= pi/4;
+//
+// |x| is split into Num_digits digits storing 24 bits and 2/pi is represented
+// by 24-bit blocks stored in two_by_pi_table::table_24; products of digits are
+// exact in double precision and are accumulated in Num_columns columns with
+// 24-bit spacing, sums in each column are also exact; blocks of 2/pi are selected
+// based on the exponent of x such that contributions to k, which are multiples
+// of 4 are discarded and the integral part stored in the first column is smaller
+// than 2^52; after carry propagation the fractional part is formed using twofold
+// arithmetic; only loading blocks of 2/pi depends on a lane, all other operations
+// are performed on whole vectors
+//
+// the absolute error of frac * 2/pi is bounded by 2^(51 - 24 * Num_columns)
+template<int Bits, class Tag>
+struct payne_hanek_simd
+{
+    using simd_type         = ms::simd<double, Bits, Tag>;
+    using twofold_type      = twofold<simd_type>;
+
+    // maximum number of digits; table_24 is padded with max_digits + 1 zero
+    // blocks, since the first column can have negative index for |x| < 2^49
+    static const int max_digits = 3;
+    static const int padding    = max_digits + 1;
+
+    // reduction for double precision x; frac is represented as value + error;
+    // 8 columns give absolute error below 2^-140, i.e. more than 64 correct bits
+    // of frac for all double precision numbers; returns k stored as double;
+    // results are unspecified if |x| < 1 or x is not finite
+    force_inline
+    static simd_type eval(const simd_type& x, simd_type& value, simd_type& error)
+    {
+        twofold_type frac;
+        simd_type q         = eval_impl<3, 8>(x, frac);
+        twofold_type res    = frac * pi2();
+
+        value               = res.value;
+        error               = res.error;
+        return q;
+    };
+
+    // reduction for single precision x represented by the double type; it is
+    // required, that float(x) == x; frac is represented as value; 5 columns give
+    // absolute error below 2^-69, which is enough for single precision numbers;
+    // returns k stored as double; results are unspecified if |x| < 1 or x is not
+    // finite
+    force_inline
+    static simd_type eval_float(const simd_type& x, simd_type& value)
+    {
+        twofold_type frac;
+        simd_type q         = eval_impl<1, 5>(x, frac);
+
+        value               = frac.value * pi2().value;
+        return q;
+    };
+
+    // pi/2 = value + error
+    force_inline
+    static twofold_type pi2()
+    {
+        return twofold_type(simd_type(1.5707963267948966192313216916398),
+                            simd_type(6.1232339957367658e-17));
+    };
+
+    // compute k and frac * 2/pi
+    template<int Num_digits, int Num_columns>
+    force_inline
+    static simd_type eval_impl(const simd_type& x, twofold_type& frac)
+    {
+        static_assert(Num_digits >= 1 && Num_digits <= max_digits, "invalid number of digits");
+        static_assert(Num_columns >= 3, "too few columns");
+
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(0.5);
+        const simd_type four    = simd_type(4.0);
+        const simd_type quarter = simd_type(0.25);
+        const simd_type base    = simd_type(16777216.0);
+        const simd_type base_inv= simd_type(1.0 / 16777216.0);
+
+        //-----------------------------------------------------------------
+        //                      exponent and blocks of 2/pi
+        //-----------------------------------------------------------------
+        simd_type xa        = ms::abs(x);
+
+        // |x| = sig * 2^e, 1 <= sig < 2; e is clamped in order to keep table
+        // indices valid for unsupported values
+        simd_type e         = ms::exponent(xa) - one;
+        e                   = ms::max(e, zero);
+
+        // index of the first column n0 = floor((e - 49)/24) + 1; columns with lower
+        // indices contribute only multiples of 4; multiplication by 1/24 does not
+        // change the result of floor for integer e in [0, 1024]
+        simd_type n0        = ms::floor((e - simd_type(49.0)) * simd_type(1.0 / 24.0)) + one;
+
+        // the first column has weight 2^s, -22 <= s <= 1
+        simd_type s         = e - simd_type(47.0) - simd_type(24.0) * n0;
+
+        // g[j] = c[n0 + j - 2], where c[k] is the k-th 24-bit block of 2/pi
+        auto ind            = (n0 + simd_type(double(padding - 2))).convert_to_int32();
+
+        simd_type g[Num_columns + 2];
+
+        for (int j = 3 - Num_digits; j < Num_columns + 2; ++j)
+            g[j]            = simd_type::gather(two_by_pi_table::table_24 + j, ind);
+
+        //-----------------------------------------------------------------
+        //                      digits of x
+        //-----------------------------------------------------------------
+        // |x| = sum_i d[i] * 2^(24 * (Num_digits - 1 - i)) * 2^(e + 1 - 24 * Num_digits);
+        // z is an integer, 2^(24 * Num_digits - 1) <= z < 2^(24 * Num_digits);
+        // all operations are exact
+        simd_type z         = xa * ms::pow2k(simd_type(24.0 * Num_digits - 1.0) - e);
+        simd_type d[Num_digits];
+
+        for (int i = Num_digits - 1; i > 0; --i)
+        {
+            simd_type hi    = ms::floor(z * base_inv);
+            d[i]            = z - hi * base;
+            z               = hi;
+        };
+
+        d[0]                = z;
+
+        //-----------------------------------------------------------------
+        //                      products
+        //-----------------------------------------------------------------
+        // column m has weight 2^(s - 24 * m); products have at most 48 bits,
+        // sums of at most 3 products are exact
+        simd_type col[Num_columns];
+
+        for (int m = 0; m < Num_columns; ++m)
+        {
+            col[m]          = d[0] * g[m + 2];
+
+            for (int i = 1; i < Num_digits; ++i)
+                col[m]      = col[m] + d[i] * g[m + 2 - i];
+        };
+
+        // carry propagation; on exit 0 <= col[m] < 2^24 for m > 0 and
+        // col[0] < 2^51
+        for (int m = Num_columns - 1; m > 0; --m)
+        {
+            simd_type carry = ms::floor(col[m] * base_inv);
+            col[m]          = col[m] - carry * base;
+            col[m - 1]      = col[m - 1] + carry;
+        };
+
+        //-----------------------------------------------------------------
+        //                      integral part
+        //-----------------------------------------------------------------
+        simd_type w         = ms::pow2k(s);
+        simd_type t         = col[0] * w;
+        simd_type ip        = ms::floor(t);
+        simd_type u         = t - ip;
+
+        // the second column can also contribute to the integral part, since
+        // s can be positive; u < 3 has at most 48 bits, the sum is exact
+        w                   = w * base_inv;
+        u                   = u + col[1] * w;
+
+        simd_type ip1       = ms::floor(u);
+        u                   = u - ip1;
+        ip                  = ip - four * ms::floor(ip * quarter) + ip1;
+
+        // remaining columns are smaller than the last bit of u; therefore
+        // frac >= 1/2 iff u >= 1/2
+        simd_type big       = ms::geq(u, half);
+        u                   = ms::if_sub(big, u, one);
+        ip                  = ms::if_add(big, ip, one);
+
+        //-----------------------------------------------------------------
+        //                      fractional part
+        //-----------------------------------------------------------------
+        // remaining columns are nonnegative and have decreasing weights;
+        // summation from the smallest column is almost exact
+        simd_type r[Num_columns];
+
+        for (int m = 2; m < Num_columns; ++m)
+        {
+            w               = w * base_inv;
+            r[m]            = col[m] * w;
+        };
+
+        twofold_type f      = twofold_type(r[Num_columns - 1]);
+
+        for (int m = Num_columns - 2; m >= 2; --m)
+            f               = r[m] + f;
+
+        // if u != 0, then |u| is higher than the sum of remaining columns
+        f                   = u + f;
+
+        //-----------------------------------------------------------------
+        //                      sign
+        //-----------------------------------------------------------------
+        simd_type neg       = ms::lt(x, zero);
+        frac                = twofold_type(ms::if_then_else(neg, -f.value, f.value),
+                                           ms::if_then_else(neg, -f.error, f.error));
+
+        ip                  = ms::if_then_else(neg, -ip, ip);
+        ip                  = ip - four * ms::floor(ip * quarter);
+
+        return ip;
+    };
+};
+
+}}}
+
+#pragma warning(pop)
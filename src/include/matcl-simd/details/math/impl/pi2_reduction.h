@@ -13,6 +13,7 @@
 #include "matcl-simd/poly/poly_eval.h"
 #include "matcl-simd/details/float/twofold.h"
 #include "matcl-simd/details/math/impl/payne_hanek.inl"
+#include "matcl-simd/details/math/impl/payne_hanek_simd.h"
 #include "matcl-simd/details/math/impl/simd_sincos_helpers.h"
 
 #pragma warning(push)
@@ -117,39 +118,28 @@ struct pi2_reduction<double, Bits, Tag>
         return xv;
     };
 
-    // reduction using Payne-Hanek algorithm
+    // reduction using Payne-Hanek algorithm; xv, xe and q_lo are replaced
+    // in lanes, where in_range is false
     force_inline
     static void reduction_full(const simd_type& x, const simd_type& in_range, simd_type& xv, 
                             simd_type& xe, simd_int& q_lo)
     {
-        const double* ptr_x     = x.get_raw_ptr();
-        const double* ptr_inr   = in_range.get_raw_ptr();
-
-        double* ptr_xv          = xv.get_raw_ptr();
-        double* ptr_xe          = xe.get_raw_ptr();
-        int* ptr_qlo            = q_lo.get_raw_ptr();
+        // 2 / pi
+        const simd_type two_by_pi   = simd_type(0.63661977236758134307553505349006);
 
-        static const int vec_size   = simd_type::vector_size;
+        simd_type ph_xv, ph_xe;
+        simd_type ph_q      = payne_hanek_simd<Bits, Tag>::eval(x, ph_xv, ph_xe);
 
-        for (int i = 0; i < vec_size; ++i)
-        {
-            if (ptr_inr[i] == 0)
-            {
-                double value, error;
-                int q           = ms::reduce_pi2_ph(ptr_x[i], value, error);
+        // q_lo stores 32-bit integers and cannot be blended using a mask of
+        // doubles; quadrants in lanes in range are recomputed as in reduction_CW3
+        simd_type q         = round(x * two_by_pi);
 
-                ptr_xv[i]       = value;
-                ptr_xe[i]       = error;
-                ptr_qlo[i]      = q;
-            }
-        };
+        q                   = ms::if_then_else(in_range, q, ph_q);
+        xv                  = ms::if_then_else(in_range, xv, ph_xv);
+        xe                  = ms::if_then_else(in_range, xe, ph_xe);
 
-        if (vec_size == 1)
-        {
-            xv      = simd_type(xv.first());
-            xe      = simd_type(xe.first());
-            q_lo    = simd_int(q_lo.first());
-        };
+        q_lo                = q.convert_to_int32();
+        q_lo                = bitwise_and(q_lo, simd_int(3));
     };
 };
 
@@ -162,10 +152,10 @@ template<int Bits, class Tag>
 struct pi2_reduction_CW_float_double
 {};
 
-template<int Bits>
-struct pi2_reduction_CW_float_double<Bits, avx_tag>
+// version for vectors of floats converted to two vectors of doubles
+template<int Bits, class Tag>
+struct pi2_reduction_CW_float_double_split
 {
-    using Tag               = avx_tag;
     using simd_type         = ms::simd<float, Bits, Tag>;
     using simd_double       = ms::simd<double, Bits, Tag>;
     using simd_int          = ms::simd<int32_t, Bits, Tag>;    
@@ -214,16 +204,27 @@ struct pi2_reduction_CW_float_double<Bits, avx_tag>
         auto xv_lo              = xlo_red2.convert_to_float();
         auto xv_hi              = xhi_red2.convert_to_float();
 
-        auto xe_lo              = (xlo_red2 - xv_lo.convert_to_double()).convert_to_float();
-        auto xe_hi              = (xhi_red2 - xv_hi.convert_to_double()).convert_to_float();
-
         simd_type xv            = simd_type(xv_lo, xv_hi);
+
+        auto xe_lo              = (xlo_red2 - xv.convert_low_to_double()).convert_to_float();
+        auto xe_hi              = (xhi_red2 - xv.convert_high_to_double()).convert_to_float();
+
         xe                      = simd_type(xe_lo, xe_hi);
 
         return xv;
     };
 };
 
+template<int Bits>
+struct pi2_reduction_CW_float_double<Bits, avx_tag>
+    : public pi2_reduction_CW_float_double_split<Bits, avx_tag>
+{};
+
+template<int Bits>
+struct pi2_reduction_CW_float_double<Bits, avx512_tag>
+    : public pi2_reduction_CW_float_double_split<Bits, avx512_tag>
+{};
+
 template<>
 struct pi2_reduction_CW_float_double<128, sse_tag>
 {
@@ -273,6 +274,129 @@ struct pi2_reduction_CW_float_double<128, sse_tag>
     };
 };
 
+// Payne-Hanek reduction computed in double precision; this version
+// reduces each element separately
+template<int Bits, class Tag>
+struct pi2_reduction_PH_float_double
+{
+    using simd_type         = ms::simd<float, Bits, Tag>;
+    using simd_int          = ms::simd<int32_t, Bits, Tag>;
+
+    force_inline
+    static void eval(const simd_type& x, const simd_type& in_range, simd_type& xv, 
+                     simd_type& xe, simd_int& q_lo)
+    {
+        // 30 bits of accuracy is enough
+        static const 
+        int max_bits            = 30;
+
+        const float* ptr_x      = x.get_raw_ptr();
+        const float* ptr_inr    = in_range.get_raw_ptr();
+
+        float* ptr_xv           = xv.get_raw_ptr();
+        float* ptr_xe           = xe.get_raw_ptr();
+        int* ptr_qlo            = q_lo.get_raw_ptr();
+
+        static const int vec_size   = simd_type::vector_size;
+
+        for (int i = 0; i < vec_size; ++i)
+        {
+            if (ptr_inr[i] == 0)
+            {
+                float value, error;
+                int q           = ms::reduce_pi2_ph_float(ptr_x[i], max_bits, value, error);
+
+                ptr_xv[i]       = value;
+                ptr_xe[i]       = error;
+                ptr_qlo[i]      = q;
+            }
+        };
+    };
+};
+
+// version for vectors of floats converted to two vectors of doubles
+template<int Bits, class Tag>
+struct pi2_reduction_PH_float_double_split
+{
+    using simd_type         = ms::simd<float, Bits, Tag>;
+    using simd_double       = ms::simd<double, Bits, Tag>;
+    using simd_int          = ms::simd<int32_t, Bits, Tag>;
+    using payne_hanek       = payne_hanek_simd<Bits, Tag>;
+
+    force_inline
+    static void eval(const simd_type& x, const simd_type& in_range, simd_type& xv, 
+                     simd_type& xe, simd_int& q_lo)
+    {
+        simd_double xlo     = x.convert_low_to_double();
+        simd_double xhi     = x.convert_high_to_double();
+
+        simd_double v_lo, v_hi;
+        simd_double qd_lo   = payne_hanek::eval_float(xlo, v_lo);
+        simd_double qd_hi   = payne_hanek::eval_float(xhi, v_hi);
+
+        simd_type ph_xv     = simd_type(v_lo.convert_to_float(), v_hi.convert_to_float());
+
+        auto xe_lo          = (v_lo - ph_xv.convert_low_to_double()).convert_to_float();
+        auto xe_hi          = (v_hi - ph_xv.convert_high_to_double()).convert_to_float();
+
+        simd_type ph_xe     = simd_type(xe_lo, xe_hi);
+        simd_int ph_q       = simd_int(qd_lo.convert_to_int32(), qd_hi.convert_to_int32());
+
+        xv                  = ms::if_then_else(in_range, xv, ph_xv);
+        xe                  = ms::if_then_else(in_range, xe, ph_xe);
+
+        // q_lo stores 32-bit integers and cannot be blended using a mask of
+        // floats; quadrants are small integers and conversions are exact
+        simd_type q         = ms::if_then_else(in_range, q_lo.convert_to_float(), 
+                                               ph_q.convert_to_float());
+        q_lo                = q.convert_to_int32();
+    };
+};
+
+template<int Bits>
+struct pi2_reduction_PH_float_double<Bits, avx_tag>
+    : public pi2_reduction_PH_float_double_split<Bits, avx_tag>
+{};
+
+template<int Bits>
+struct pi2_reduction_PH_float_double<Bits, avx512_tag>
+    : public pi2_reduction_PH_float_double_split<Bits, avx512_tag>
+{};
+
+template<>
+struct pi2_reduction_PH_float_double<128, sse_tag>
+{
+    using Tag               = sse_tag;
+    using simd_type         = ms::simd<float, 128, Tag>;
+    using simd_double       = typename simd_type::simd_double_2;
+    using simd_int          = ms::simd<int32_t, 128, Tag>;
+    using payne_hanek       = payne_hanek_simd<simd_double::number_bits, 
+                                typename simd_double::simd_tag>;
+
+    force_inline
+    static void eval(const simd_type& x0, const simd_type& in_range, simd_type& xv, 
+                     simd_type& xe, simd_int& q_lo)
+    {
+        simd_double x       = x0.convert_to_double();
+
+        simd_double v;
+        simd_double qd      = payne_hanek::eval_float(x, v);
+
+        simd_type ph_xv     = v.convert_to_float();
+        simd_type ph_xe     = (v - ph_xv.convert_to_double()).convert_to_float();
+        simd_int ph_q       = qd.convert_to_int32();
+
+        xv                  = ms::if_then_else(in_range, xv, ph_xv);
+        xe                  = ms::if_then_else(in_range, xe, ph_xe);
+
+        // q_lo stores 32-bit integers and cannot be blended using a mask of
+        // floats; quadrants are small integers and conversions are exact
+        simd_type q         = ms::if_then_else(in_range, q_lo.convert_to_float(), 
+                                               ph_q.convert_to_float());
+        q_lo                = q.convert_to_int32();
+    };
+};
+
 template<int Bits, class Tag>
 struct pi2_reduction<float, Bits, Tag>
 {
@@ -341,36 +465,13 @@ struct pi2_reduction<float, Bits, Tag>
         return pi2_reduction_CW_float_double<Bits, Tag>::eval(x, xe, qi);
     }    
 
-    // reduction using Payne-Hanek algorithm
+    // reduction using Payne-Hanek algorithm; xv, xe and q_lo are replaced
+    // in lanes, where in_range is false
     force_inline
     static void reduction_full(const simd_type& x, const simd_type& in_range, simd_type& xv, 
                             simd_type& xe, simd_int& q_lo)
     {
-        // 30 bits of accuracy is enough
-        static const 
-        int max_bits            = 30;
-
-        const float* ptr_x      = x.get_raw_ptr();
-        const float* ptr_inr    = in_range.get_raw_ptr();
-
-        float* ptr_xv           = xv.get_raw_ptr();
-        float* ptr_xe           = xe.get_raw_ptr();
-        int* ptr_qlo            = q_lo.get_raw_ptr();
-
-        static const int vec_size   = simd_type::vector_size;
-
-        for (int i = 0; i < vec_size; ++i)
-        {
-            if (ptr_inr[i] == 0)
-            {
-                float value, error;
-                int q           = ms::reduce_pi2_ph_float(ptr_x[i], max_bits, value, error);
-
-                ptr_xv[i]       = value;
-                ptr_xe[i]       = error;
-                ptr_qlo[i]      = q;
-            }
-        };
+        pi2_reduction_PH_float_double<Bits, Tag>::eval(x, in_range, xv, xe, q_lo);
     };
 };
 
@@ -384,34 +485,21 @@ struct pi2_reduction<float, Bits, Tag>
         using simd_double       = ms::simd<double, 256, avx_tag>;
         using simd_int          = ms::simd<int32_t, 128, sse_tag>;    
 
-        // reduction using Payne-Hanek algorithm
+        // reduction using Payne-Hanek algorithm; xv and q_lo are replaced in
+        // lanes, where in_range is false
         force_inline
         static void reduction_full(const simd_double& x, const simd_double& in_range, 
                                     simd_double& xv, simd_int& q_lo)
         {
-            // 30 bits of accuracy is enough
-            static const 
-            int max_bits            = 30;
-
-            const double* ptr_x     = x.get_raw_ptr();
-            const double* ptr_inr   = in_range.get_raw_ptr();
-
-            double* ptr_xv          = xv.get_raw_ptr();
-            int* ptr_qlo            = q_lo.get_raw_ptr();
+            simd_double ph_xv;
+            simd_double ph_q    = payne_hanek_simd<256, avx_tag>::eval_float(x, ph_xv);
 
-            static const int vec_size   = simd_type::vector_size;
+            xv                  = ms::if_then_else(in_range, xv, ph_xv);
 
-            for (int i = 0; i < vec_size; ++i)
-            {
-                if (ptr_inr[i] == 0)
-                {
-                    double value;
-                    int q           = ms::reduce_pi2_ph_float(ptr_x[i], max_bits, value);
-
-                    ptr_xv[i]       = value;
-                    ptr_qlo[i]      = q;
-                }
-            };
+            // q_lo stores 32-bit integers and cannot be blended using a mask of
+            // doubles; quadrants are small integers and conversions are exact
+            simd_double q       = ms::if_then_else(in_range, q_lo.convert_to_double(), ph_q);
+            q_lo                = q.convert_to_int32();
         };
 
         // reduction scheme valid for |x| < 268435456 * pi/2
@@ -493,18 +581,17 @@ struct pi2_reduction_scalar<float, Bits, Tag>
         return x_red2;
     };
 
+    // reduction using Payne-Hanek algorithm; q_lo is used as a table index,
+    // non-finite values are replaced by zero (callers return nan for such
+    // values)
     force_inline
     static void reduction_full(const simd_double& x, simd_double& xv, simd_int& q_lo)
     {
-        // 30 bits of accuracy is enough
-        static const 
-        int max_bits    = 30;
-
-        double value;
-        int q           = ms::reduce_pi2_ph_float(x.first(), max_bits, value);
+        simd_double xf  = ms::if_then_else(ms::is_finite(x), x, simd_double::zero());
+        simd_double q   = payne_hanek_simd<Bits, Tag>::eval_float(xf, xv);
 
-        xv              = simd_double(value);
-        q_lo            = simd_int(q);
+        q_lo            = q.convert_to_int32();
+        q_lo            = bitwise_and(q_lo, simd_int(3));
     };
 };
 
@@ -0,0 +1,397 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/poly/poly_eval.h"
+
+#include <limits>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct atan_data
+{};
+
+template<>
+struct MATCL_SIMD_EXPORT atan_data<double>
+{
+    // approximation of P(z) = (atan(sqrt(z))/sqrt(z) - 1) / z on
+    // [0, tan(pi/8)^2]
+    static const double poly_atan[11];
+
+    // approximation of P(z) = (asin(sqrt(z))/sqrt(z) - 1) / z on [0, 1/4]
+    static const double poly_asin[13];
+
+    // pi/4 = pio4_hi + pio4_lo; k * pio4_hi is exact for k <= 4
+    static double   pio4_hi()       { return 0.78539816339744827900; };
+    static double   pio4_lo()       { return 3.0616169978683830179e-17; };
+
+    static double   tan_pi8()       { return 0.41421356237309504880; };
+
+    // arguments of atan2 larger than huge are scaled to avoid overflow
+    static double   huge()          { return 1.0715086071862673e+301; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_atan(const Arg& x)
+    {
+        return estrin<11>(x, poly_atan);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_asin(const Arg& x)
+    {
+        return estrin<13>(x, poly_asin);
+    };
+};
+
+template<>
+struct MATCL_SIMD_EXPORT atan_data<float>
+{
+    // see atan_data<double>
+    static const float poly_atan[4];
+    static const float poly_asin[6];
+
+    // high part of pi/4 stored with precision 21 bits
+    static float    pio4_hi()       { return 0.785398006439209f; };
+    static float    pio4_lo()       { return 1.5695823932524066e-07f; };
+
+    static float    tan_pi8()       { return 0.41421356237309504880f; };
+    static float    huge()          { return 1.329228e+36f; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_atan(const Arg& x)
+    {
+        return estrin<4>(x, poly_atan);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_asin(const Arg& x)
+    {
+        return estrin<6>(x, poly_asin);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              ATAN
+//-----------------------------------------------------------------------
+// inverse trigonometric functions; results are represented as k * pi/4 +- p,
+// where k = 0, ..., 4 and p is an approximation of atan or asin on a reduced
+// range; k * pi/4 is added in the last step, therefore error is below
+// 2.5 ulp
+template<class Val, int Bits, class Tag>
+struct simd_atan_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using data          = atan_data<Val>;
+
+    // atan(t) for |t| <= tan(pi/8)
+    force_inline
+    static simd_type approx_atan(const simd_type& t)
+    {
+        simd_type z     = t * t;
+        simd_type p     = data::eval_atan(z);
+
+        return fma_f(t * z, p, t);
+    };
+
+    // asin(s) for |s| <= 1/2, z = s^2
+    force_inline
+    static simd_type approx_asin(const simd_type& s, const simd_type& z)
+    {
+        simd_type p     = data::eval_asin(z);
+        return fma_f(s * z, p, s);
+    };
+
+    // return k * pi/4 + p
+    force_inline
+    static simd_type finalize(const simd_type& k, const simd_type& p)
+    {
+        simd_type r     = fma_f(k, simd_type(data::pio4_lo()), p);
+        return fma_f(k, simd_type(data::pio4_hi()), r);
+    };
+
+    // atan(mn / mx) = k * pi/4 + atan(t), where 0 <= mn <= mx, |t| <= tan(pi/8),
+    // and k = 0, 1
+    force_inline
+    static void reduce(const simd_type& mn, const simd_type& mx, simd_type& t, simd_type& k)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+
+        simd_type big   = gt(mn, mx * simd_type(data::tan_pi8()));
+
+        // atan(mn / mx) = pi/4 + atan((mn - mx) / (mn + mx))
+        simd_type num   = if_then_else(big, mn - mx, mn);
+        simd_type den   = if_then_else(big, mn + mx, mx);
+
+        t               = num / den;
+        k               = if_then_else(big, one, zero);
+    };
+
+    // return atan(mn / mx) if swap is false and pi/2 - atan(mn / mx) otherwise;
+    // result is additionally reflected to pi - result if neg is true
+    force_inline
+    static simd_type eval_reduced(const simd_type& t, const simd_type& k0,
+                                  const simd_type& swap, const simd_type& neg)
+    {
+        const simd_type two     = simd_type(Val(2.0));
+        const simd_type four    = simd_type(Val(4.0));
+
+        simd_type p     = approx_atan(t);
+
+        simd_type k     = if_then_else(swap, two - k0, k0);
+        p               = if_then_else(swap, -p, p);
+        k               = if_then_else(neg, four - k, k);
+        p               = if_then_else(neg, -p, p);
+
+        return finalize(k, p);
+    };
+
+    force_inline
+    static simd_type eval_atan(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+
+        simd_type ax    = abs(x);
+
+        // atan(x) = pi/2 - atan(1/x) for x > 1; NaN is propagated by mn
+        simd_type swap  = gt(ax, one);
+        simd_type mn    = if_then_else(swap, one, ax);
+        simd_type mx    = if_then_else(swap, ax, one);
+
+        simd_type t, k;
+        reduce(mn, mx, t, k);
+
+        simd_type res   = eval_reduced(t, k, swap, simd_type::zero());
+        return copysign(res, x);
+    };
+
+    force_inline
+    static simd_type eval_atan2(const simd_type& y, const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+
+        simd_type ax    = abs(x);
+        simd_type ay    = abs(y);
+
+        // NaN is propagated by mn or mx
+        simd_type swap  = gt(ay, ax);
+        simd_type mn    = if_then_else(swap, ax, ay);
+        simd_type mx    = if_then_else(swap, ay, ax);
+
+        // sign bit of x is set; atan2(+-0, -0) = +-pi
+        simd_type neg   = neq(copysign(simd_type::one(), x), simd_type::one());
+
+        simd_type t, k;
+        reduce(mn, mx, t, k);
+
+        simd_type special   = eeq(mx, zero) || geq(mx, simd_type(data::huge()));
+
+        if (any(special) == true)
+            process_special(mn, mx, t, k);
+
+        simd_type res   = eval_reduced(t, k, swap, neg);
+        return copysign(res, y);
+    };
+
+    // zero arguments, infinite arguments and arguments close to overflow
+    static void process_special(const simd_type& mn, const simd_type& mx, simd_type& t,
+                                simd_type& k)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type quarter = simd_type(Val(0.25));
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        // mn + mx can overflow
+        simd_type huge      = geq(mx, simd_type(data::huge()));
+        simd_type t_s, k_s;
+        reduce(mn * quarter, mx * quarter, t_s, k_s);
+
+        t                   = if_then_else(huge, t_s, t);
+        k                   = if_then_else(huge, k_s, k);
+
+        // atan2(+-0, +-0) = k * pi/4, atan2(+-inf, +-inf) = k * pi/4 + pi/4
+        simd_type is_zero   = eeq(mx, zero);
+        simd_type is_inf    = eeq(mn, inf);
+
+        t                   = if_then_else(is_zero || is_inf, zero, t);
+        k                   = if_then_else(is_zero, zero, k);
+        k                   = if_then_else(is_inf, one, k);
+    };
+
+    force_inline
+    static simd_type eval_asin(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+
+        simd_type ax    = abs(x);
+
+        // asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)) for x > 1/2; 1 - x is
+        // exact; NaN is returned by sqrt for x > 1
+        simd_type big   = gt(ax, half);
+        simd_type z_big = (one - ax) * half;
+        simd_type z     = if_then_else(big, z_big, ax * ax);
+        simd_type s     = if_then_else(big, sqrt(z_big), ax);
+
+        simd_type p     = approx_asin(s, z);
+
+        simd_type k     = if_then_else(big, two, zero);
+        p               = if_then_else(big, -(p + p), p);
+
+        simd_type res   = finalize(k, p);
+        return copysign(res, x);
+    };
+
+    force_inline
+    static simd_type eval_acos(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+        const simd_type four    = simd_type(Val(4.0));
+
+        simd_type ax    = abs(x);
+
+        // acos(x) = pi/2 - asin(x)                     for |x| <= 1/2
+        // acos(x) = 2 * asin(sqrt((1 - x) / 2))        for x > 1/2
+        // acos(x) = pi - 2 * asin(sqrt((1 + x) / 2))   for x < -1/2
+        simd_type big   = gt(ax, half);
+        simd_type neg   = lt(x, zero);
+        simd_type z_big = (one - ax) * half;
+        simd_type z     = if_then_else(big, z_big, x * x);
+        simd_type s     = if_then_else(big, sqrt(z_big), x);
+
+        simd_type p     = approx_asin(s, z);
+
+        simd_type p2    = p + p;
+        simd_type k_big = if_then_else(neg, four, zero);
+        simd_type p_big = if_then_else(neg, -p2, p2);
+
+        simd_type k     = if_then_else(big, k_big, two);
+        p               = if_then_else(big, p_big, -p);
+
+        return finalize(k, p);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_atan<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_atan_impl<double, Bits, Tag>::eval_atan(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_atan<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_atan_impl<float, Bits, Tag>::eval_atan(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_atan2<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& y, const simd_type& x)
+    {
+        return simd_atan_impl<double, Bits, Tag>::eval_atan2(y, x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_atan2<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& y, const simd_type& x)
+    {
+        return simd_atan_impl<float, Bits, Tag>::eval_atan2(y, x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_asin<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_atan_impl<double, Bits, Tag>::eval_asin(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_asin<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_atan_impl<float, Bits, Tag>::eval_asin(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_acos<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_atan_impl<double, Bits, Tag>::eval_acos(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_acos<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_atan_impl<float, Bits, Tag>::eval_acos(x);
+    };
+};
+
+}}}
@@ -0,0 +1,543 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/simd_complex.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/details/math/impl/simd_exp.h"
+#include "matcl-simd/details/math/impl/simd_log.h"
+#include "matcl-simd/details/math/impl/simd_sincos_double.h"
+#include "matcl-simd/details/math/impl/simd_sincos_float.h"
+#include "matcl-simd/details/math/impl/simd_atan.h"
+#include "matcl-simd/details/math/impl/simd_root.h"
+#include "matcl-simd/details/scalfunc_real.h"
+
+#include <complex>
+
+namespace matcl { namespace simd { namespace details
+{
+
+namespace mrd = matcl::raw::details;
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct compl_math_data
+{};
+
+template<>
+struct compl_math_data<double>
+{
+    // exp(x) is evaluated without overflow handling for x <= max_exp
+    static double   max_exp()       { return 708.0; };
+
+    // arguments of sqrt with absolute value of real or imaginary part above
+    // sqrt_big are scaled by 1/4, arguments with both parts below sqrt_small
+    // are scaled by 2^(2 * sqrt_scale)
+    static double   sqrt_big()      { return 1.1235582092889474e+307; };
+    static double   sqrt_small()    { return 4.0083367200179456e-292; };
+    static double   sqrt_scale()    { return 54.0; };
+};
+
+template<>
+struct compl_math_data<float>
+{
+    static float    max_exp()       { return 87.0f; };
+
+    static float    sqrt_big()      { return 2.126764793e+37f; };
+    static float    sqrt_small()    { return 7.888609052e-31f; };
+    static float    sqrt_scale()    { return 26.0f; };
+};
+
+//-----------------------------------------------------------------------
+//                              SCALAR
+//-----------------------------------------------------------------------
+// scalar versions of complex functions used for arguments, for which the
+// vector version gives inf or NaN; special values are handled according to
+// C99 Annex G by functions from the standard library
+template<class Val>
+struct compl_math_scalar
+{
+    using value_type    = typename complex_type<Val>::type;
+    using std_complex   = std::complex<Val>;
+
+    static std_complex to_std(const value_type& x)
+    {
+        return std_complex(real(x), imag(x));
+    };
+
+    static value_type from_std(const std_complex& x)
+    {
+        return value_type(x.real(), x.imag());
+    };
+
+    static value_type eval_exp(const value_type& x)
+    {
+        return from_std(std::exp(to_std(x)));
+    };
+
+    static value_type eval_log(const value_type& x)
+    {
+        return from_std(std::log(to_std(x)));
+    };
+
+    static value_type eval_sqrt(const value_type& x)
+    {
+        return from_std(std::sqrt(to_std(x)));
+    };
+
+    // cis(x) = exp(i * x)
+    static value_type eval_cis(const value_type& x)
+    {
+        return from_std(std::exp(std_complex(-imag(x), real(x))));
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              COMPLEX
+//-----------------------------------------------------------------------
+// elementary functions of complex vectors; real and imaginary parts are
+// duplicated in real vectors, i.e. [re_0, re_0, re_1, re_1, ...] and
+// [im_0, im_0, im_1, im_1, ...], and real functions are evaluated on these
+// vectors; results are interleaved by selecting even and odd elements
+template<class Val, int Bits, class Tag>
+struct simd_compl_math_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using compl_type    = simd_compl<Val, Bits, Tag>;
+    using value_type    = typename compl_type::value_type;
+    using data          = compl_math_data<Val>;
+    using scalar_func   = compl_math_scalar<Val>;
+    using func_type     = value_type (*)(const value_type&);
+
+    static const int
+    vector_size         = compl_type::vector_size;
+
+    // true_value on odd positions (imaginary parts); see also simd_cis
+    force_inline
+    static simd_type odd_mask()
+    {
+        const simd_type zero    = simd_type::zero();
+        return gt(sub_add(zero, simd_type::one()), zero);
+    };
+
+    // duplicate real and imaginary parts of x; elements of x are reversed
+    // twice, first as complex numbers, then as real numbers, which swaps
+    // real and imaginary parts
+    force_inline
+    static void split(const compl_type& x, simd_type& re, simd_type& im)
+    {
+        simd_type odd   = odd_mask();
+        simd_type sw    = reverse(reverse(x).data);
+
+        re              = if_then_else(odd, sw, x.data);
+        im              = if_then_else(odd, x.data, sw);
+    };
+
+    // complex vector with real parts taken from re and imaginary parts
+    // taken from im
+    force_inline
+    static compl_type combine(const simd_type& re, const simd_type& im)
+    {
+        return compl_type(if_then_else(odd_mask(), im, re));
+    };
+
+    // replace elements of res, for which real or imaginary part is not
+    // finite, by func(x)
+    static compl_type recover_special(const compl_type& x, const compl_type& res,
+                                      func_type func)
+    {
+        compl_type ret              = res;
+
+        value_type* ret_ptr         = ret.get_raw_ptr();
+        const value_type* x_ptr     = x.get_raw_ptr();
+
+        for (int i = 0; i < vector_size; ++i)
+        {
+            bool f_re   = mrd::scal_func::finite(real(ret_ptr[i]));
+            bool f_im   = mrd::scal_func::finite(imag(ret_ptr[i]));
+
+            if (f_re == true && f_im == true)
+                continue;
+
+            ret_ptr[i]  = func(x_ptr[i]);
+        };
+
+        return ret;
+    };
+
+    // exp(re + i * im) = exp(re) * cis(im); exp(re) is evaluated as
+    // exp(re/2)^2 close to overflow
+    force_inline
+    static compl_type eval_exp_parts(const simd_type& re, const simd_type& im)
+    {
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type c     = simd_cis<Val, Bits, Tag>::eval(im).data;
+        simd_type e     = simd_exp<Val, Bits, Tag>::eval(re);
+        simd_type res   = e * c;
+
+        simd_type large = gt(re, simd_type(data::max_exp()));
+
+        if (any(large) == true)
+        {
+            simd_type eh    = simd_exp<Val, Bits, Tag>::eval(re * half);
+            res             = if_then_else(large, (eh * c) * eh, res);
+        };
+
+        return compl_type(res);
+    };
+
+    force_inline
+    static compl_type eval_exp(const compl_type& x)
+    {
+        simd_type re, im;
+        split(x, re, im);
+
+        compl_type res  = eval_exp_parts(re, im);
+
+        if (any(!is_finite(res.data)) == true)
+            return recover_special(x, res, &scalar_func::eval_exp);
+
+        return res;
+    };
+
+    // cis(x) = exp(i * x) = exp(-im) * cis(re)
+    force_inline
+    static compl_type eval_cis(const compl_type& x)
+    {
+        simd_type re, im;
+        split(x, re, im);
+
+        compl_type res  = eval_exp_parts(-im, re);
+
+        if (any(!is_finite(res.data)) == true)
+            return recover_special(x, res, &scalar_func::eval_cis);
+
+        return res;
+    };
+
+    // log(x) = log(|x|) + i * arg(x); close to the unit circle log(|x|) is
+    // evaluated as log1p(mx^2 - 1 + mn^2) / 2, where mx = max(|re|, |im|)
+    // and mn = min(|re|, |im|) in order to avoid cancellation
+    force_inline
+    static compl_type eval_log(const compl_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type two     = simd_type(Val(2.0));
+
+        simd_type re, im;
+        split(x, re, im);
+
+        simd_type h     = simd_hypot<Val, Bits, Tag>::eval(re, im);
+        simd_type lr    = simd_log<Val, Bits, Tag>::eval(h);
+        simd_type li    = simd_atan2<Val, Bits, Tag>::eval(im, re);
+
+        simd_type near  = gt(h, half) && lt(h, two);
+
+        if (any(near) == true)
+        {
+            simd_type ar    = abs(re);
+            simd_type ai    = abs(im);
+            simd_type mx    = max(ar, ai);
+            simd_type mn    = min(ar, ai);
+
+            simd_type mn2   = mn * mn;
+            simd_type mn2_l = fms_f(mn, mn, mn2);
+            simd_type t     = (fms_f(mx, mx, one) + mn2) + mn2_l;
+            simd_type l1    = half * simd_log1p<Val, Bits, Tag>::eval(t);
+
+            lr              = if_then_else(near, l1, lr);
+        };
+
+        compl_type res  = combine(lr, li);
+
+        if (any(!is_finite(res.data)) == true)
+            return recover_special(x, res, &scalar_func::eval_log);
+
+        return res;
+    };
+
+    // sqrt(re + i * im) = t + i * im / (2t) if re >= 0 and
+    // |im| / (2t) + i * sign(im) * t otherwise, where
+    // t = sqrt((|re| + |x|) / 2); there is no cancellation; arguments are
+    // scaled in order to avoid overflow and loss of accuracy for denormals
+    force_inline
+    static compl_type eval_sqrt(const compl_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type re, im;
+        split(x, re, im);
+
+        simd_type mx    = max(abs(re), abs(im));
+        simd_type big   = gt(mx, simd_type(data::sqrt_big()));
+        simd_type small = lt(mx, simd_type(data::sqrt_small()));
+
+        simd_type s_in  = if_then_else(big, simd_type(Val(0.25)), one);
+        simd_type s_out = if_then_else(big, simd_type(Val(2.0)), one);
+
+        if (any(small) == true)
+        {
+            simd_type k = simd_type(data::sqrt_scale());
+            s_in        = if_then_else(small, pow2k(k + k), s_in);
+            s_out       = if_then_else(small, pow2k(-k), s_out);
+        };
+
+        simd_type a     = re * s_in;
+        simd_type b     = im * s_in;
+
+        simd_type h     = simd_hypot<Val, Bits, Tag>::eval(a, b);
+        simd_type t     = sqrt(half * (abs(a) + h));
+        simd_type q     = b / (t + t);
+
+        simd_type pos   = geq(re, zero);
+        simd_type r_re  = if_then_else(pos, t, abs(q));
+        simd_type r_im  = if_then_else(pos, q, copysign(t, im));
+
+        // sqrt(+-0 + i * (+-0)) = +0 + i * (+-0)
+        r_im            = if_then_else(eeq(t, zero), im, r_im);
+
+        compl_type res  = combine(r_re * s_out, r_im * s_out);
+
+        if (any(!is_finite(res.data)) == true)
+            return recover_special(x, res, &scalar_func::eval_sqrt);
+
+        return res;
+    };
+
+    force_inline
+    static simd_type eval_abs(const compl_type& x)
+    {
+        simd_type re, im;
+        split(x, re, im);
+
+        return simd_hypot<Val, Bits, Tag>::eval(re, im);
+    };
+
+    force_inline
+    static simd_type eval_arg(const compl_type& x)
+    {
+        simd_type re, im;
+        split(x, re, im);
+
+        return simd_atan2<Val, Bits, Tag>::eval(im, re);
+    };
+
+    // pow(x, y) = exp(y * log(x)); pow(x, 0) = 1 and pow(0, y) = 0 if
+    // real(y) > 0
+    force_inline
+    static compl_type eval_pow(const compl_type& x, const compl_type& y)
+    {
+        const simd_type zero    = simd_type::zero();
+
+        compl_type l    = eval_log(x);
+        compl_type res  = eval_exp(y * l);
+
+        simd_type x_re, x_im, y_re, y_im;
+        split(x, x_re, x_im);
+        split(y, y_re, y_im);
+
+        simd_type x0    = eeq(x_re, zero) && eeq(x_im, zero);
+        simd_type y0    = eeq(y_re, zero) && eeq(y_im, zero);
+
+        if (any(x0 || y0) == true)
+        {
+            simd_type pos   = gt(y_re, zero);
+            simd_type r     = if_then_else(x0 && pos, zero, res.data);
+            r               = if_then_else(y0, compl_type(Val(1.0)).data, r);
+
+            res             = compl_type(r);
+        };
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_compl_exp<double, Bits, Tag>
+{
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_exp(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_exp<float, Bits, Tag>
+{
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_exp(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_log<double, Bits, Tag>
+{
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_log(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_log<float, Bits, Tag>
+{
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_log(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_sqrt<double, Bits, Tag>
+{
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_sqrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_sqrt<float, Bits, Tag>
+{
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_sqrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_abs<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_abs(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_abs<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_abs(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_arg<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_arg(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_arg<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_arg(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_pow<double, Bits, Tag>
+{
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x, const compl_type& y)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_pow(x, y);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_pow<float, Bits, Tag>
+{
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x, const compl_type& y)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_pow(x, y);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_cis<double, Bits, Tag>
+{
+    using compl_type    = simd_compl<double, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<double, Bits, Tag>::eval_cis(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_compl_cis<float, Bits, Tag>
+{
+    using compl_type    = simd_compl<float, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const compl_type& x)
+    {
+        return simd_compl_math_impl<float, Bits, Tag>::eval_cis(x);
+    };
+};
+
+}}}
@@ -0,0 +1,435 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/details/math/impl/simd_exp.h"
+#include "matcl-simd/details/math/impl/simd_log.h"
+#include "matcl-simd/details/float/twofold.h"
+#include "matcl-simd/poly/poly_eval.h"
+
+#include <limits>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct erf_data
+{};
+
+template<>
+struct MATCL_SIMD_EXPORT erf_data<double>
+{
+    // approximation of E(z) = erf(sqrt(z)) / sqrt(z) on [0, 1/4]
+    static const double poly_erf[9];
+
+    // approximation of P(t) = (1 + 2x) * exp(x^2) * erfc(x) on [-1, 1],
+    // where t = (x - K) / (x + K), x in [0, inf), K = erfc_K
+    static const double poly_erfc[25];
+
+    // rational approximations of the inverse normal cdf by P. J. Acklam
+    // in the central region and in tails; relative error is 1.15e-9
+    static const double poly_inv_nom[6];
+    static const double poly_inv_den[6];
+    static const double poly_inv_tail_nom[6];
+    static const double poly_inv_tail_den[5];
+
+    template<int Bits, class Tag>
+    using exp_impl  = simd_exp_double_impl<Bits, Tag, exp_base_e>;
+
+    static double   erfc_K()        { return 3.0; };
+
+    // erfc(x) = 0 for x >= max_erfc, erf(x) = 1 for x >= max_erf
+    static double   max_erfc()      { return 28.0; };
+    static double   max_erf()       { return 6.0; };
+
+    // 1/sqrt(2) = inv_sqrt2_hi + inv_sqrt2_lo
+    static double   inv_sqrt2_hi()  { return 0.70710678118654757; };
+    static double   inv_sqrt2_lo()  { return -4.8336466567264567e-17; };
+
+    static double   sqrt_2pi()      { return 2.5066282746310002; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_erf(const Arg& x)
+    {
+        return estrin<9>(x, poly_erf);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_erfc(const Arg& x)
+    {
+        return estrin<25>(x, poly_erfc);
+    };
+};
+
+template<>
+struct MATCL_SIMD_EXPORT erf_data<float>
+{
+    // see erf_data<double>
+    static const float poly_erf[5];
+    static const float poly_erfc[12];
+
+    static const float poly_inv_nom[6];
+    static const float poly_inv_den[6];
+    static const float poly_inv_tail_nom[6];
+    static const float poly_inv_tail_den[5];
+
+    template<int Bits, class Tag>
+    using exp_impl  = simd_exp_float_impl<Bits, Tag, exp_base_e>;
+
+    static float    erfc_K()        { return 3.0f; };
+
+    static float    max_erfc()      { return 11.0f; };
+    static float    max_erf()       { return 4.0f; };
+
+    static float    inv_sqrt2_hi()  { return 0.70710677f; };
+    static float    inv_sqrt2_lo()  { return 1.2101617e-08f; };
+
+    static float    sqrt_2pi()      { return 2.5066283f; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_erf(const Arg& x)
+    {
+        return estrin<5>(x, poly_erf);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_erfc(const Arg& x)
+    {
+        return estrin<12>(x, poly_erfc);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              ERF
+//-----------------------------------------------------------------------
+// error function and the normal distribution; erf(x) is approximated by
+// a polynomial for |x| <= 1/2, otherwise erfc(x) = exp(-x^2) * P(t) / (1 + 2x)
+// is used, where P(t) is a single polynomial valid on [0, inf); relative
+// error of erf is below 3 ulp, relative error of erfc and normcdf is below
+// 4 ulp, and relative error of norminv is below 8 ulp
+template<class Val, int Bits, class Tag>
+struct simd_erf_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using twofold_type  = twofold<simd_type>;
+    using data          = erf_data<Val>;
+    using exp_impl      = typename data::template exp_impl<Bits, Tag>;
+
+    // erf(x) for |x| <= 1/2
+    force_inline
+    static simd_type approx_erf(const simd_type& x)
+    {
+        simd_type p     = data::eval_erf(x * x);
+        return x * p;
+    };
+
+    // erfc(z + z_lo) for z >= 0, where |z_lo| <= ulp(z)
+    force_inline
+    static simd_type approx_erfc(const simd_type& z, const simd_type& z_lo)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type K       = simd_type(data::erfc_K());
+        const simd_type max_z   = simd_type(data::max_erfc());
+
+        // exp(-z^2) underflows for z >= max_z
+        simd_type big   = gt(z, max_z);
+        simd_type zc    = if_then_else(big, max_z, z);
+        simd_type zc_lo = if_then_else(big, zero, z_lo);
+
+        simd_type t     = (zc - K) / (zc + K);
+        simd_type p     = data::eval_erfc(t);
+
+        // (z + z_lo)^2 = s.value + s_lo
+        simd_type z2    = zc + zc;
+        twofold_type s  = twofold_mult(zc, zc);
+        simd_type s_lo  = fma_f(z2, zc_lo, s.error);
+
+        simd_type e     = exp_impl::eval_ext(-s.value, -s_lo);
+        return e * (p / (one + z2));
+    };
+
+    force_inline
+    static simd_type eval_erf(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type max_x   = simd_type(data::max_erf());
+
+        simd_type ax    = abs(x);
+        simd_type small = leq(ax, half);
+        simd_type res   = approx_erf(ax);
+
+        if (all(small) == true)
+            return copysign(res, x);
+
+        // erf(x) = 1 - erfc(x); erfc(x) < erf(x) for x > 1/2; NaN is
+        // propagated
+        simd_type axc   = if_then_else(gt(ax, max_x), max_x, ax);
+        simd_type res_l = one - approx_erfc(axc, simd_type::zero());
+
+        res             = if_then_else(small, res, res_l);
+        return copysign(res, x);
+    };
+
+    force_inline
+    static simd_type eval_erfc(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+        const simd_type half    = simd_type(Val(0.5));
+
+        // erfc(x) = 1 - erf(x) for |x| <= 1/2, erfc(-x) = 2 - erfc(x)
+        simd_type ax    = abs(x);
+        simd_type small = leq(ax, half);
+        simd_type res   = one - approx_erf(x);
+
+        if (all(small) == true)
+            return res;
+
+        simd_type res_l = approx_erfc(ax, simd_type::zero());
+        res_l           = if_then_else(lt(x, simd_type::zero()), two - res_l, res_l);
+
+        return if_then_else(small, res, res_l);
+    };
+
+    // normcdf(x) = erfc(-x / sqrt(2)) / 2; -x / sqrt(2) is computed in
+    // twofold precision, otherwise rounding error of the argument would be
+    // amplified by the factor x^2 in tails
+    force_inline
+    static simd_type eval_normcdf(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type mx    = -x;
+        twofold_type z  = twofold_mult(mx, simd_type(data::inv_sqrt2_hi()));
+        simd_type z_lo  = fma_f(mx, simd_type(data::inv_sqrt2_lo()), z.error);
+        simd_type zh    = z.value;
+
+        simd_type az    = abs(zh);
+        simd_type small = leq(az, half);
+
+        // erf(z + z_lo) ~ erf(z) + z_lo * 2/sqrt(pi)
+        simd_type p     = data::eval_erf(zh * zh);
+        simd_type e     = fma_f(zh, p, z_lo * simd_type(data::poly_erf[0]));
+        simd_type res   = one - e;
+
+        if (all(small) == true)
+            return half * res;
+
+        simd_type neg   = lt(zh, zero);
+        simd_type az_lo = if_then_else(neg, -z_lo, z_lo);
+        simd_type res_l = approx_erfc(az, az_lo);
+        res_l           = if_then_else(neg, two - res_l, res_l);
+
+        res             = if_then_else(small, res, res_l);
+        return half * res;
+    };
+
+    // inverse of the normal cdf; initial approximation by P. J. Acklam
+    // is improved by one step of the Halley's method
+    static simd_type eval_norminv(const simd_type& p)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type quarter = simd_type(Val(0.25));
+        const simd_type lim     = simd_type(Val(0.47575));
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+        const simd_type sqrt2pi = simd_type(data::sqrt_2pi());
+
+        // q is exact for p >= 1/4; pm = min(p, 1 - p) is exact
+        simd_type upper     = gt(p, half);
+        simd_type pm        = if_then_else(upper, one - p, p);
+        simd_type q         = p - half;
+        simd_type central   = leq(abs(q), lim);
+
+        bool any_central    = any(central);
+        bool all_central    = all(central);
+
+        simd_type x, u;
+
+        //-----------------------------------------------------------------
+        //                      central region
+        //-----------------------------------------------------------------
+        // e = normcdf(x) - p = erf(x / sqrt(2)) / 2 - q; erf is evaluated
+        // directly in order to avoid cancellation for x close to 0
+        if (any_central == true)
+        {
+            simd_type r     = q * q;
+            simd_type x0    = q * estrin<6>(r, data::poly_inv_nom)
+                            / estrin<6>(r, data::poly_inv_den);
+
+            simd_type e     = fms_f(half, eval_erf(x0 * simd_type(data::inv_sqrt2_hi())), q);
+            simd_type u0    = e * sqrt2pi * simd_exp<Val, Bits, Tag>::eval(half * x0 * x0);
+
+            x               = x0;
+            u               = u0;
+        };
+
+        //-----------------------------------------------------------------
+        //                      tails
+        //-----------------------------------------------------------------
+        // x0 <= 0 is the solution of normcdf(x0) = pm; relative residual
+        // r = normcdf(x0) / pm - 1 is used, since pm can be very small;
+        // u = r * pm / pdf(x0)
+        if (all_central == false)
+        {
+            simd_type log_p = simd_log<Val, Bits, Tag>::eval(pm);
+            simd_type s     = sqrt(-two * log_p);
+            simd_type x0    = estrin<6>(s, data::poly_inv_tail_nom)
+                            / estrin<5>(s, data::poly_inv_tail_den);
+
+            simd_type r     = eval_normcdf(x0) / pm - one;
+            simd_type ex    = simd_exp<Val, Bits, Tag>::eval(quarter * x0 * x0);
+            simd_type u0    = r * ((pm * sqrt2pi * ex) * ex);
+
+            if (any_central == true)
+            {
+                x           = if_then_else(central, x, x0);
+                u           = if_then_else(central, u, u0);
+            }
+            else
+            {
+                x           = x0;
+                u           = u0;
+            };
+        };
+
+        //-----------------------------------------------------------------
+        //                      finalization
+        //-----------------------------------------------------------------
+        // Halley's step x = x - u / (1 + x * u / 2), u = (normcdf(x) - p) / pdf(x)
+        x                   = x - u / fma_f(half * x, u, one);
+
+        simd_type flip      = upper && !central;
+        x                   = if_then_else(flip, -x, x);
+
+        // norminv(0) = -inf, norminv(1) = inf, NaN for p outside [0, 1]
+        simd_type is_inf    = eeq(pm, zero);
+        x                   = if_then_else(is_inf, copysign(inf, q), x);
+        x                   = if_nan_else(lt(pm, zero), x);
+
+        return x;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_erf<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_erf_impl<double, Bits, Tag>::eval_erf(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_erf<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_erf_impl<float, Bits, Tag>::eval_erf(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_erfc<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_erf_impl<double, Bits, Tag>::eval_erfc(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_erfc<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_erf_impl<float, Bits, Tag>::eval_erfc(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_normcdf<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_erf_impl<double, Bits, Tag>::eval_normcdf(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_normcdf<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_erf_impl<float, Bits, Tag>::eval_normcdf(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_norminv<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& p)
+    {
+        return simd_erf_impl<double, Bits, Tag>::eval_norminv(p);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_norminv<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& p)
+    {
+        return simd_erf_impl<float, Bits, Tag>::eval_norminv(p);
+    };
+};
+
+}}}
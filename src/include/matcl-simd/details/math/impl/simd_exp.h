@@ -12,6 +12,9 @@
 #include "matcl-simd/details/math/simd_math_func_def.h"
 #include "matcl-simd/poly/poly_eval.h"
 
+#pragma warning(push)
+#pragma warning(disable: 4127)  //conditional expression is constant
+
 namespace matcl { namespace simd { namespace details
 {
 
@@ -23,6 +26,9 @@ struct MATCL_SIMD_EXPORT exp_table_double
     // polynomial coefficients
     static const double exp_poly[4];
 
+    // Taylor coefficients of (exp(x) - 1 - x)/x^2, i.e. 1/2!, 1/3!, ..., 1/15!
+    static const double expm1_poly[14];
+
     // precomputed values of exp(i * log(2) / L)
     static double lookup_table_arr[L + 1];
     
@@ -39,6 +45,17 @@ struct MATCL_SIMD_EXPORT exp_table_double
     {
         return estrin<4>(x, exp_table_double::exp_poly);
     };
+
+    // return exp(x) - 1 for |x| < 0.5
+    template<class Arg>
+    force_inline
+    static Arg eval_m1(const Arg& x)
+    {
+        Arg x2  = x * x;
+        Arg p   = estrin<14>(x, exp_table_double::expm1_poly);
+        p       = fma_f(p, x2, x);
+        return p;
+    };
 };
 
 struct MATCL_SIMD_EXPORT exp_table_float
@@ -54,45 +71,127 @@ struct MATCL_SIMD_EXPORT exp_table_float
         p       = fma_f(p, x, Arg(1));
         return p;
     };
+
+    // return exp(x) - 1
+    template<class Arg>
+    force_inline
+    static Arg eval_m1(const Arg& x)
+    {
+        Arg p   =  estrin<6>(x, exp_table_float::exp_poly);
+        p       = p * x;
+        return p;
+    };
 };
 
-template<int Bits, class Simd_tag>
-struct simd_exp<double, Bits, Simd_tag>
+// base of exponential functions
+static const int exp_base_e     = 0;
+static const int exp_base_2     = 1;
+static const int exp_base_10    = 2;
+
+// evaluate B^a, where B is given by the Base argument, using the table
+// exp_table_double; B^a = 2^k * exp(l * log(2)/L) * (1 + p), where
+// p = exp(x) - 1, |x| <= log(2)/L/2 
+template<int Bits, class Simd_tag, int Base>
+struct simd_exp_double_impl
 {
     using simd_type     = simd<double, Bits, Simd_tag>;
 
     static const int L  = exp_table_double::L;
 
     force_inline
-    static simd_type eval(const simd_type& a)
+    static simd_type reduction(const simd_type& a, simd_type& k, simd_type& l)
     {
-        const simd_type inv_log2 = simd_type(L * 1.442695040888963407359924681001);
-
-        // high part of log(2)/L stored with precision 35 bits
-        const simd_type log2_hi  = simd_type(0.69314718057285062969 / L);
-
-        // low part of log(2)/L
-        const simd_type log2_lo  = simd_type(-1.2905320270077143679e-11 / L);                                        
-
         const simd_type M       = simd_type(double(L));
         const simd_type M_inv   = simd_type(1.0 / L);
-        const simd_type max_k   = simd_type(1022);
         const simd_type max_l   = simd_type(double(L/2));
 
+        simd_type kl, x;
+
+        if (Base == exp_base_e)
+        {
+            const simd_type inv_log2 = simd_type(L * 1.442695040888963407359924681001);
+
+            // high part of log(2)/L stored with precision 35 bits
+            const simd_type log2_hi  = simd_type(0.69314718057285062969 / L);
+
+            // low part of log(2)/L
+            const simd_type log2_lo  = simd_type(-1.2905320270077143679e-11 / L);                                        
+
+            // this reduction scheme will produce inaccurate d = a - k*inv_log2, when a is close
+            // to k*inv_log2 (worst case for 7804143460206699 x 2^?49), but then d ~ 0 and 
+            // result exp(d) ~ 1 is accurate
+            kl          = round(inv_log2 * a);
+            x           = fnma_f(kl, log2_hi, a);   // a - k*LH; exact for |kl| < 2^18
+            x           = fnma_f(kl, log2_lo, x);   // x - k*LL
+        }
+        else if (Base == exp_base_2)
+        {
+            const simd_type log2_hi  = simd_type(0.6931471805599453);
+            const simd_type log2_lo  = simd_type(2.3190468138462996e-17);
+
+            // 2^a = exp(r * log(2)) * 2^(kl/L), r = a - kl/L
+            kl          = round(M * a);
+            simd_type r = fnma_f(kl, M_inv, a);     // exact
+            x           = fma_f(r, log2_hi, r * log2_lo);
+        }
+        else
+        {
+            const simd_type inv_log = simd_type(850.4135922911647);     // L * log2(10)
+
+            // high part of log10(2)/L stored with precision 32 bits
+            const simd_type log_hi  = simd_type(0.0011758984205698653);
+
+            // low part of log10(2)/L
+            const simd_type log_lo  = simd_type(-7.438722057486045e-15);
+
+            const simd_type log10_hi = simd_type(2.302585092994046);
+            const simd_type log10_lo = simd_type(-2.1707562233822494e-16);
+
+            // 10^a = exp(r * log(10)) * 2^(kl/L), r = a - kl * log10(2)/L
+            kl          = round(inv_log * a);
+            simd_type r = fnma_f(kl, log_hi, a);    // a - k*LH; exact for |kl| < 2^21
+            r           = fnma_f(kl, log_lo, r);    // r - k*LL
+            x           = fma_f(r, log10_hi, r * log10_lo);
+        };
+
+        k               = round(M_inv * kl);
+        l               = fnma_f(k, M, kl);         // kl - k*M        
+        l               = min(l, max_l);
+
+        return x;
+    };
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
         //-----------------------------------------------------------------
         //                      reduction
         //-----------------------------------------------------------------
+        simd_type k, l;
+        simd_type x     = reduction(a, k, l);
 
-        // this reduction scheme will produce inaccurate d = a - k*inv_log2, when a is close
-        // to k*inv_log2 (worst case for 7804143460206699 x 2^?49), but then d ~ 0 and 
-        // result exp(d) ~ 1 is accurate
-        simd_type kl    = round(inv_log2 * a);
-        simd_type x     = fnma_f(kl, log2_hi, a);   // a - k*LH; exact for |kl| < 2^18
-        x               = fnma_f(kl, log2_lo, x);   // x - k*LL
+        return eval_reduced(a, x, k, l);
+    };
 
-        simd_type k     = round(M_inv * kl);
-        simd_type l     = fnma_f(k, M, kl);         // kl - k*M        
-        l               = min(l, max_l);
+    // evaluate exp(a + a_lo), where |a_lo| is not greater than ulp(a); this
+    // function is available only for Base = exp_base_e
+    force_inline
+    static simd_type eval_ext(const simd_type& a, const simd_type& a_lo)
+    {
+        static_assert(Base == exp_base_e, "eval_ext requires natural base");
+
+        simd_type k, l;
+        simd_type x     = reduction(a, k, l);
+        x               = x + a_lo;
+
+        return eval_reduced(a, x, k, l);
+    };
+
+    force_inline
+    static simd_type eval_reduced(const simd_type& a, const simd_type& x, const simd_type& k,
+                                  const simd_type& l)
+    {
+        const simd_type max_k   = simd_type(1022);
 
         bool normal     = all(leq(abs(k), max_k));
         
@@ -121,12 +220,47 @@ struct simd_exp<double, Bits, Simd_tag>
         return c;
     };
 
+    // evaluate B^a - 1; accurate only if |B^a - 1| is not small
+    force_inline
+    static simd_type eval_m1(const simd_type& a)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type max_k   = simd_type(1022);
+
+        simd_type k, l;
+        simd_type x     = reduction(a, k, l);
+
+        bool normal     = all(leq(abs(k), max_k));
+        
+        simd_type mult  = simd_type::gather(exp_table_double::lookup_table, l.convert_to_int32());
+
+        simd_type p     = exp_table_double::eval(x);
+        p               = p * x;
+
+        // res = (p + 1) * m - 1, m = exp(M_inv * l) * 2^k; m - 1 is exact
+        // if 1/2 <= m <= 2
+        simd_type m     = mult * pow2k(k);
+        simd_type c     = fma_f(p, m, m - one);
+
+        if (normal == false)
+        {
+            simd_type c_over    = process_overflows(a, p, k, l) - one;
+            c                   = if_then_else(leq(abs(k), max_k), c, c_over);
+        };
+
+        return c;
+    };
+
     static simd_type process_overflows(const simd_type& a, const simd_type& p, 
                                        const simd_type& k, const simd_type& l)
     {        
+        // B^max_a = inf, B^min_a = 0
+        const double lim        = (Base == exp_base_e) ? 1000.0 
+                                : (Base == exp_base_2) ? 1100.0 : 330.0;
+
         const simd_type val_inf = simd_type(std::numeric_limits<double>::infinity());
-        const simd_type max_a   = simd_type(1000.0);
-        const simd_type min_a   = simd_type(-1000.0);
+        const simd_type max_a   = simd_type(lim);
+        const simd_type min_a   = simd_type(-lim);
         
         simd_type k1    = round(k * simd_type(0.5));
         simd_type k2    = k - k1;
@@ -145,32 +279,96 @@ struct simd_exp<double, Bits, Simd_tag>
     };
 };
 
-template<int Bits, class Simd_tag>
-struct simd_exp<float, Bits, Simd_tag>
+// evaluate B^a, where B is given by the Base argument; B^a = 2^k * (1 + p),
+// where p = exp(x) - 1, |x| <= log(2)/2 
+template<int Bits, class Simd_tag, int Base>
+struct simd_exp_float_impl
 {
     using simd_type     = simd<float, Bits, Simd_tag>;
 
+    force_inline
+    static simd_type reduction(const simd_type& a, simd_type& k)
+    {
+        simd_type x;
+
+        if (Base == exp_base_e)
+        {
+            const simd_type inv_log2 = simd_type(1.442695040888963407359924681001f);
+
+            // high part of log(2) stored with precision 16 bits
+            const simd_type log2_hi  = simd_type(0.693145751953125f);
+
+            // low part of log(2)
+            const simd_type log2_lo  = simd_type(1.4286068203094172321e-06f);
+
+            k           = round(inv_log2 * a);
+            x           = fnma_f(k, log2_hi, a);    // a - k*LH; exact for |k| < 256
+            x           = fnma_f(k, log2_lo, x);    // x - k*LL
+        }
+        else if (Base == exp_base_2)
+        {
+            const simd_type log2_hi  = simd_type(0.6931471824645996f);
+            const simd_type log2_lo  = simd_type(-1.9046542121259336e-09f);
+
+            // 2^a = exp(r * log(2)) * 2^k, r = a - k
+            k           = round(a);
+            simd_type r = a - k;                    // exact
+            x           = fma_f(r, log2_hi, r * log2_lo);
+        }
+        else
+        {
+            const simd_type inv_log = simd_type(3.321928024291992f);    // log2(10)
+
+            // high part of log10(2) stored with precision 16 bits
+            const simd_type log_hi  = simd_type(0.30103302001953125f);
+
+            // low part of log10(2)
+            const simd_type log_lo  = simd_type(-3.024355464731343e-06f);
+
+            const simd_type log10_hi = simd_type(2.3025851249694824f);
+            const simd_type log10_lo = simd_type(-3.1975435632602967e-08f);
+
+            // 10^a = exp(r * log(10)) * 2^k, r = a - k * log10(2)
+            k           = round(inv_log * a);
+            simd_type r = fnma_f(k, log_hi, a);     // a - k*LH; exact for |k| < 256
+            r           = fnma_f(k, log_lo, r);     // r - k*LL
+            x           = fma_f(r, log10_hi, r * log10_lo);
+        };
+
+        return x;
+    };
+
     force_inline
     static simd_type eval(const simd_type& a)
     {
-        const simd_type one      = simd_type::one();
-        const simd_type inv_log2 = simd_type(1.442695040888963407359924681001f);
+        //-----------------------------------------------------------------
+        //                      reduction
+        //-----------------------------------------------------------------
+        simd_type k;
+        simd_type x     = reduction(a, k);
+
+        return eval_reduced(a, x, k);
+    };
+
+    // evaluate exp(a + a_lo), where |a_lo| is not greater than ulp(a); this
+    // function is available only for Base = exp_base_e
+    force_inline
+    static simd_type eval_ext(const simd_type& a, const simd_type& a_lo)
+    {
+        static_assert(Base == exp_base_e, "eval_ext requires natural base");
 
-        // high part of log(2) stored with precision 16 bits
-        const simd_type log2_hi  = simd_type(0.693145751953125f);
+        simd_type k;
+        simd_type x     = reduction(a, k);
+        x               = x + a_lo;
 
-        // low part of log(2)
-        const simd_type log2_lo  = simd_type(1.4286068203094172321e-06f);
+        return eval_reduced(a, x, k);
+    };
 
+    force_inline
+    static simd_type eval_reduced(const simd_type& a, const simd_type& x, const simd_type& k)
+    {
         const simd_type max_k   = simd_type(126.f);
 
-        //-----------------------------------------------------------------
-        //                      reduction
-        //-----------------------------------------------------------------
-        simd_type k     = round(inv_log2 * a);
-        simd_type x     = fnma_f(k, log2_hi, a);    // a - k*LH; exact for |k| < 256
-        x               = fnma_f(k, log2_lo, x);    // x - k*LL
-
         bool normal     = all(leq(abs(k), max_k));
         
         //-----------------------------------------------------------------
@@ -191,12 +389,43 @@ struct simd_exp<float, Bits, Simd_tag>
         return c;
     };
 
+    // evaluate B^a - 1
+    force_inline
+    static simd_type eval_m1(const simd_type& a)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type max_k   = simd_type(126.f);
+
+        simd_type k;
+        simd_type x     = reduction(a, k);
+
+        bool normal     = all(leq(abs(k), max_k));
+        
+        // res = (p + 1) * 2^k - 1, where p = exp(x) - 1; 2^k - 1 is exact
+        // for small k, and p is accurate also for small x
+        simd_type p     = exp_table_float::eval_m1(x);
+        simd_type pk    = pow2k(k);
+        simd_type c     = fma_f(p, pk, pk - one);
+
+        if (normal == false)
+        {
+            simd_type c_over    = process_overflows(a, p + one, k) - one;
+            c                   = if_then_else(leq(abs(k), max_k), c, c_over);
+        };
+
+        return c;
+    };
+
     static simd_type process_overflows(const simd_type& a, const simd_type& p, 
                                        const simd_type& k)
     {
+        // B^max_a = inf, B^min_a = 0
+        const float lim         = (Base == exp_base_e) ? 120.0f 
+                                : (Base == exp_base_2) ? 150.0f : 46.0f;
+
         const simd_type val_inf = simd_type(std::numeric_limits<float>::infinity());
-        const simd_type max_a   = simd_type(120.0f);
-        const simd_type min_a   = simd_type(-120.0f);
+        const simd_type max_a   = simd_type(lim);
+        const simd_type min_a   = simd_type(-lim);
 
         simd_type k1    = round(k * simd_type(0.5f));
         simd_type k2    = k - k1;
@@ -212,4 +441,117 @@ struct simd_exp<float, Bits, Simd_tag>
     };
 };
 
+template<int Bits, class Simd_tag>
+struct simd_exp<double, Bits, Simd_tag>
+{
+    using simd_type     = simd<double, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_double_impl<Bits, Simd_tag, exp_base_e>::eval(a);
+    };
+};
+
+template<int Bits, class Simd_tag>
+struct simd_exp<float, Bits, Simd_tag>
+{
+    using simd_type     = simd<float, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_float_impl<Bits, Simd_tag, exp_base_e>::eval(a);
+    };
+};
+
+template<int Bits, class Simd_tag>
+struct simd_exp2<double, Bits, Simd_tag>
+{
+    using simd_type     = simd<double, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_double_impl<Bits, Simd_tag, exp_base_2>::eval(a);
+    };
+};
+
+template<int Bits, class Simd_tag>
+struct simd_exp2<float, Bits, Simd_tag>
+{
+    using simd_type     = simd<float, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_float_impl<Bits, Simd_tag, exp_base_2>::eval(a);
+    };
+};
+
+template<int Bits, class Simd_tag>
+struct simd_exp10<double, Bits, Simd_tag>
+{
+    using simd_type     = simd<double, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_double_impl<Bits, Simd_tag, exp_base_10>::eval(a);
+    };
+};
+
+template<int Bits, class Simd_tag>
+struct simd_exp10<float, Bits, Simd_tag>
+{
+    using simd_type     = simd<float, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_float_impl<Bits, Simd_tag, exp_base_10>::eval(a);
+    };
+};
+
+
+template<int Bits, class Simd_tag>
+struct simd_expm1<double, Bits, Simd_tag>
+{
+    using simd_type     = simd<double, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        // for |a| < 1/2 Taylor expansion is used, otherwise exp(a) - 1 
+        // is computed using the lookup table
+        const simd_type max_a   = simd_type(0.5);
+
+        simd_type small     = lt(abs(a), max_a);
+
+        if (all(small) == true)
+            return exp_table_double::eval_m1(a);
+
+        simd_type res       = simd_exp_double_impl<Bits, Simd_tag, exp_base_e>::eval_m1(a);
+
+        if (any(small) == true)
+            res             = if_then_else(small, exp_table_double::eval_m1(a), res);
+
+        return res;
+    };
+};
+
+template<int Bits, class Simd_tag>
+struct simd_expm1<float, Bits, Simd_tag>
+{
+    using simd_type     = simd<float, Bits, Simd_tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& a)
+    {
+        return simd_exp_float_impl<Bits, Simd_tag, exp_base_e>::eval_m1(a);
+    };
+};
+
 }}}
+
+#pragma warning(pop)
@@ -0,0 +1,473 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/details/math/impl/simd_exp.h"
+#include "matcl-simd/details/math/impl/simd_log.h"
+#include "matcl-simd/details/math/impl/simd_pow.h"
+#include "matcl-simd/details/math/impl/simd_sincos_double.h"
+#include "matcl-simd/details/math/impl/simd_sincos_float.h"
+#include "matcl-simd/details/math/impl/simd_tan_double.h"
+#include "matcl-simd/details/math/impl/simd_tan_float.h"
+
+#include <limits>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct gamma_data
+{};
+
+template<>
+struct MATCL_SIMD_EXPORT gamma_data<double>
+{
+    // approximation of P(t) = lgamma(2 + t) / t on [-1/2, 1/2]
+    static const double poly_lgamma[18];
+
+    // approximation of P(w) = x * (lgamma(x) - (x - 1/2) * log(x) + x
+    // - log(2pi)/2) on [0, 1/x0^2], where w = 1/x^2, x0 = max_reduced
+    static const double poly_stirling[6];
+
+    // approximation of P(s) = y * digamma(y) / (y - r) on [-1/2, 1/2],
+    // where y = s + 3/2 and r is the positive root of digamma
+    static const double poly_digamma[16];
+
+    // approximation of P(w) = (log(x) - 1/(2x) - digamma(x)) / w on
+    // [0, 1/x0^2], where w = 1/x^2, x0 = max_reduced
+    static const double poly_digamma_asym[6];
+
+    // asymptotic expansions are used for x >= max_reduced, otherwise
+    // argument is shifted to [3/2, 5/2) or [1, 2)
+    static double   max_reduced()   { return 8.0; };
+
+    // tgamma(x) = inf for x > max_tgamma
+    static double   max_tgamma()    { return 172.0; };
+
+    // log(2pi)/2 - 1/2
+    static double   log_2pi_half()  { return 0.41893853320467274; };
+    static double   sqrt_2pi()      { return 2.5066282746310002; };
+    static double   pi()            { return 3.1415926535897931; };
+
+    // positive root of digamma, r = root_hi + root_lo
+    static double   root_hi()       { return 1.4616321449683622; };
+    static double   root_lo()       { return 9.5499954299656970e-17; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_lgamma(const Arg& x)
+    {
+        return estrin<18>(x, poly_lgamma);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_stirling(const Arg& x)
+    {
+        return estrin<6>(x, poly_stirling);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_digamma(const Arg& x)
+    {
+        return estrin<16>(x, poly_digamma);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_digamma_asym(const Arg& x)
+    {
+        return estrin<6>(x, poly_digamma_asym);
+    };
+};
+
+template<>
+struct MATCL_SIMD_EXPORT gamma_data<float>
+{
+    // see gamma_data<double>
+    static const float poly_lgamma[9];
+    static const float poly_stirling[3];
+    static const float poly_digamma[8];
+    static const float poly_digamma_asym[3];
+
+    static float    max_reduced()   { return 8.0f; };
+    static float    max_tgamma()    { return 36.0f; };
+
+    static float    log_2pi_half()  { return 0.418938547f; };
+    static float    sqrt_2pi()      { return 2.50662827f; };
+    static float    pi()            { return 3.14159274f; };
+
+    static float    root_hi()       { return 1.46163213f; };
+    static float    root_lo()       { return 1.24381501e-08f; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_lgamma(const Arg& x)
+    {
+        return estrin<9>(x, poly_lgamma);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_stirling(const Arg& x)
+    {
+        return estrin<3>(x, poly_stirling);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_digamma(const Arg& x)
+    {
+        return estrin<8>(x, poly_digamma);
+    };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_digamma_asym(const Arg& x)
+    {
+        return estrin<3>(x, poly_digamma_asym);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              GAMMA
+//-----------------------------------------------------------------------
+// gamma function and its derivatives; for x >= max_reduced asymptotic
+// expansions are used, otherwise x is shifted to a short interval using
+// recurrence relations; for negative arguments the reflection formula
+// is used; relative error of lgamma is below 7 ulp and relative error
+// of digamma is below 6 ulp for positive x; relative error of tgamma is
+// below 8 ulp; for negative x accuracy of lgamma and digamma is reduced
+// close to roots of these functions
+template<class Val, int Bits, class Tag>
+struct simd_gamma_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using data          = gamma_data<Val>;
+
+    // x = t + m, t in [-1/2, 1/2), m integer, x in [-1/2, max_reduced);
+    // Gamma(x) = Gamma(2 + t) * f    if m > 2
+    // Gamma(x) = Gamma(2 + t) / f    otherwise
+    // where f = (t + 2) * ... * (t + m - 1) for m > 2, f = x for m = 1,
+    // f = x * (x + 1) for m = 0, and f = 1 for m = 2; t is exact
+    force_inline
+    static void shift_2(const simd_type& x, simd_type& t, simd_type& f, simd_type& up)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type two     = simd_type(Val(2.0));
+
+        simd_type m     = floor(x + half);
+        t               = x - m;
+        up              = gt(m, two);
+
+        f               = if_then_else(eeq(m, zero), x * (x + one), one);
+        f               = if_then_else(eeq(m, one), x, f);
+
+        for (int i = 2; i < 8; ++i)
+        {
+            simd_type fi    = simd_type(Val(i));
+            f               = f * if_then_else(lt(fi, m), t + fi, one);
+        };
+    };
+
+    // lgamma(x) for x >= -1/2
+    force_inline
+    static simd_type eval_lgamma_pos(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type large     = geq(x, simd_type(data::max_reduced()));
+
+        simd_type t, f, up;
+        shift_2(x, t, f, up);
+
+        // log is shared by both branches
+        simd_type l         = simd_log<Val, Bits, Tag>::eval(if_then_else(large, x, abs(f)));
+
+        simd_type lg        = t * data::eval_lgamma(t);
+        simd_type res       = if_then_else(up, lg + l, lg - l);
+
+        if (any(large) == true)
+        {
+            // lgamma(x) = (x - 1/2) * (log(x) - 1) + log(2pi)/2 - 1/2 + P(w) / x
+            simd_type w     = one / (x * x);
+            simd_type s     = data::eval_stirling(w) / x;
+            simd_type res_l = fma_f(x - half, l - one, simd_type(data::log_2pi_half())) + s;
+
+            res             = if_then_else(large, res_l, res);
+        };
+
+        return res;
+    };
+
+    // Gamma(x) for x >= -1/2
+    force_inline
+    static simd_type eval_tgamma_pos(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        simd_type t, f, up;
+        shift_2(x, t, f, up);
+
+        simd_type g         = simd_exp<Val, Bits, Tag>::eval(t * data::eval_lgamma(t));
+        simd_type res       = if_then_else(up, g * f, g / f);
+
+        simd_type large     = geq(x, simd_type(data::max_reduced()));
+
+        if (any(large) == true)
+        {
+            // Gamma(x) = sqrt(2pi) * x^(x - 1/2) * exp(-x) * exp(P(w) / x);
+            // x^(x - 1/2) is split into two factors in order to avoid
+            // overflow
+            simd_type xl    = min(x, simd_type(data::max_tgamma()));
+            simd_type p     = simd_pow<Val, Bits, Tag>::eval(xl, (xl - half) * half);
+            simd_type e     = simd_exp<Val, Bits, Tag>::eval(-xl);
+
+            simd_type w     = one / (xl * xl);
+            simd_type s     = simd_exp<Val, Bits, Tag>::eval(data::eval_stirling(w) / xl);
+            simd_type res_l = ((p * e) * p) * (simd_type(data::sqrt_2pi()) * s);
+
+            res_l           = if_then_else(gt(x, simd_type(data::max_tgamma())), inf, res_l);
+            res             = if_then_else(large, res_l, res);
+        };
+
+        return res;
+    };
+
+    // digamma(x) for x >= 0; x = t + m, t in [0, 1), m integer;
+    // digamma(x) = digamma(1 + t) + 1/(t + 1) + ... + 1/(t + m - 1) for
+    // m > 1, and digamma(x) = digamma(1 + x) - 1/x for m = 0; the sum is
+    // accumulated as a single fraction num / den
+    force_inline
+    static simd_type eval_digamma_pos(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type m         = floor(x);
+        simd_type t         = x - m;
+        simd_type m0        = eeq(m, zero);
+
+        // digamma(y) = (y - r) / y * P(t - 1/2), y = 1 + t; y - r is
+        // computed accurately
+        simd_type d         = (t - (simd_type(data::root_hi()) - one)) - simd_type(data::root_lo());
+        simd_type py        = d / (one + t) * data::eval_digamma(t - half);
+
+        simd_type num       = if_then_else(m0, -one, zero);
+        simd_type den       = if_then_else(m0, x, one);
+
+        for (int i = 1; i < 7; ++i)
+        {
+            simd_type fi    = simd_type(Val(i));
+            simd_type use   = lt(fi, m);
+            simd_type a     = t + fi;
+
+            num             = if_then_else(use, fma_f(num, a, den), num);
+            den             = if_then_else(use, den * a, den);
+        };
+
+        simd_type res       = py + num / den;
+
+        simd_type large     = geq(x, simd_type(data::max_reduced()));
+
+        if (any(large) == true)
+        {
+            // digamma(x) = log(x) - 1/(2x) - w * P(w)
+            simd_type w     = one / (x * x);
+            simd_type l     = simd_log<Val, Bits, Tag>::eval(x);
+            simd_type res_l = l - half / x - w * data::eval_digamma_asym(w);
+
+            res             = if_then_else(large, res_l, res);
+        };
+
+        return res;
+    };
+
+    // sin(pi * r), where x = n + r, n integer, |r| <= 1/2; sin(pi * x)
+    // = (-1)^n * sin(pi * r)
+    force_inline
+    static simd_type eval_sin_pi_red(const simd_type& r)
+    {
+        return simd_sincos<Val, Bits, Tag>::eval_sin(simd_type(data::pi()) * r);
+    };
+
+    // lgamma(x) = log(pi / |x * sin(pi * x)|) - lgamma(-x) for x < -1/2
+    force_inline
+    static simd_type eval_lgamma(const simd_type& x)
+    {
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        simd_type neg       = lt(x, -half);
+        simd_type res       = eval_lgamma_pos(if_then_else(neg, -x, x));
+
+        if (any(neg) == true)
+        {
+            simd_type r     = x - round(x);
+            simd_type s     = eval_sin_pi_red(r);
+            simd_type res_n = simd_log<Val, Bits, Tag>::eval(simd_type(data::pi()) / abs(x * s))
+                            - res;
+
+            // poles at negative integers and lgamma(-inf) = inf
+            simd_type pole  = eeq(r, simd_type::zero()) || eeq(x, -inf);
+            res_n           = if_then_else(pole, inf, res_n);
+            res             = if_then_else(neg, res_n, res);
+        };
+
+        return res;
+    };
+
+    // Gamma(x) = pi / (sin(pi * x) * (-x)) / Gamma(-x) for x < -1/2
+    force_inline
+    static simd_type eval_tgamma(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type nan     = simd_type(std::numeric_limits<Val>::quiet_NaN());
+
+        simd_type neg       = lt(x, -half);
+        simd_type ax        = if_then_else(neg, -x, x);
+        simd_type res       = eval_tgamma_pos(ax);
+
+        if (any(neg) == true)
+        {
+            simd_type n     = round(x);
+            simd_type r     = x - n;
+            simd_type s     = eval_sin_pi_red(r);
+
+            simd_type nh    = n * half;
+            s               = if_then_else(neq(nh, floor(nh)), -s, s);
+
+            simd_type res_n = (simd_type(data::pi()) / (s * ax)) / res;
+
+            // poles at negative integers
+            res_n           = if_then_else(eeq(r, zero), nan, res_n);
+            res             = if_then_else(neg, res_n, res);
+        };
+
+        return res;
+    };
+
+    // digamma(x) = digamma(-x) - 1/x - pi * cot(pi * x) for x < 0
+    force_inline
+    static simd_type eval_digamma(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type nan     = simd_type(std::numeric_limits<Val>::quiet_NaN());
+
+        simd_type neg       = lt(x, zero);
+        simd_type res       = eval_digamma_pos(if_then_else(neg, -x, x));
+
+        if (any(neg) == true)
+        {
+            const simd_type pi  = simd_type(data::pi());
+
+            simd_type r     = x - round(x);
+            simd_type c     = simd_tancot<Val, Bits, Tag>::eval_cot(pi * r);
+            simd_type res_n = res - one / x - pi * c;
+
+            // poles at negative integers
+            res_n           = if_then_else(eeq(r, zero), nan, res_n);
+            res             = if_then_else(neg, res_n, res);
+        };
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_lgamma<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_gamma_impl<double, Bits, Tag>::eval_lgamma(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_lgamma<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_gamma_impl<float, Bits, Tag>::eval_lgamma(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_tgamma<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_gamma_impl<double, Bits, Tag>::eval_tgamma(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_tgamma<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_gamma_impl<float, Bits, Tag>::eval_tgamma(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_digamma<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_gamma_impl<double, Bits, Tag>::eval_digamma(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_digamma<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_gamma_impl<float, Bits, Tag>::eval_digamma(x);
+    };
+};
+
+}}}
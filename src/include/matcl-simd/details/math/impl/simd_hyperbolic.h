@@ -0,0 +1,269 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/details/math/impl/simd_exp.h"
+#include "matcl-simd/details/math/impl/simd_log.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct hyperbolic_data
+{};
+
+template<>
+struct hyperbolic_data<double>
+{
+    // exp(x) is evaluated without overflow handling for |x| <= max_exp
+    static double   max_exp()       { return 708.0; };
+
+    // tanh(x) rounds to 1 for x >= max_tanh
+    static double   max_tanh()      { return 22.0; };
+};
+
+template<>
+struct hyperbolic_data<float>
+{
+    static float    max_exp()       { return 87.0f; };
+    static float    max_tanh()      { return 10.0f; };
+};
+
+//-----------------------------------------------------------------------
+//                              HYPERBOLIC
+//-----------------------------------------------------------------------
+// hyperbolic functions evaluated using exp and expm1; accuracy is close to
+// accuracy of exp
+template<class Val, int Bits, class Tag>
+struct simd_hyperbolic_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using data          = hyperbolic_data<Val>;
+
+    // exp(ax) / 2 for ax close to overflow; exp(ax/2) is computed twice
+    // in order to avoid overflow of exp(ax) when exp(ax) / 2 is finite
+    static simd_type eval_half_exp_large(const simd_type& ax)
+    {
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type e     = simd_exp<Val, Bits, Tag>::eval(ax * half);
+        return (half * e) * e;
+    };
+
+    // sinh(x) = (t + t / (t + 1)) / 2, t = exp(|x|) - 1; there is no
+    // cancellation and t is accurate also for small |x|
+    force_inline
+    static simd_type eval_sinh(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type ax    = abs(x);
+        simd_type t     = simd_expm1<Val, Bits, Tag>::eval(ax);
+        simd_type res   = half * (t + t / (t + one));
+
+        simd_type large = gt(ax, simd_type(data::max_exp()));
+
+        if (any(large) == true)
+            res         = if_then_else(large, eval_half_exp_large(ax), res);
+
+        return copysign(res, x);
+    };
+
+    // cosh(x) = exp(|x|) / 2 + 1 / (2 * exp(|x|))
+    force_inline
+    static simd_type eval_cosh(const simd_type& x)
+    {
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type ax    = abs(x);
+        simd_type e     = simd_exp<Val, Bits, Tag>::eval(ax);
+        simd_type res   = fma_f(half, e, half / e);
+
+        simd_type large = gt(ax, simd_type(data::max_exp()));
+
+        if (any(large) == true)
+            res         = if_then_else(large, eval_half_exp_large(ax), res);
+
+        return res;
+    };
+
+    // tanh(x) = t / (t + 2), t = exp(2|x|) - 1; result is saturated for
+    // large |x|
+    force_inline
+    static simd_type eval_tanh(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+
+        simd_type ax    = abs(x);
+        simd_type sat   = geq(ax, simd_type(data::max_tanh()));
+        simd_type ax_s  = if_then_else(sat, simd_type::zero(), ax);
+
+        simd_type t     = simd_expm1<Val, Bits, Tag>::eval(ax_s + ax_s);
+        simd_type res   = t / (t + two);
+        res             = if_then_else(sat, one, res);
+
+        return copysign(res, x);
+    };
+
+    // sigmoid(x) = 1 / (1 + exp(-x)); exp(-x) = inf gives 0 and exp(-x) = 0
+    // gives 1
+    force_inline
+    static simd_type eval_sigmoid(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+
+        simd_type e     = simd_exp<Val, Bits, Tag>::eval(-x);
+        return one / (one + e);
+    };
+
+    // softplus(x) = log(1 + exp(x)) = max(x, 0) + log1p(exp(-|x|)); exp
+    // cannot overflow and x is returned if exp(-|x|) is negligible
+    force_inline
+    static simd_type eval_softplus(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+
+        simd_type e     = simd_exp<Val, Bits, Tag>::eval(-abs(x));
+        simd_type l     = simd_log1p<Val, Bits, Tag>::eval(e);
+
+        return max(x, zero) + l;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_sinh<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<double, Bits, Tag>::eval_sinh(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_sinh<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<float, Bits, Tag>::eval_sinh(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_cosh<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<double, Bits, Tag>::eval_cosh(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_cosh<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<float, Bits, Tag>::eval_cosh(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_tanh<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<double, Bits, Tag>::eval_tanh(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_tanh<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<float, Bits, Tag>::eval_tanh(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_sigmoid<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<double, Bits, Tag>::eval_sigmoid(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_sigmoid<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<float, Bits, Tag>::eval_sigmoid(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_softplus<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<double, Bits, Tag>::eval_softplus(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_softplus<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_hyperbolic_impl<float, Bits, Tag>::eval_softplus(x);
+    };
+};
+
+}}}
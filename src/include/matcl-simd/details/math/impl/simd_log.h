@@ -11,10 +11,19 @@
 #include "matcl-simd/details/arch/simd_impl.h"
 #include "matcl-simd/details/math/simd_math_func_def.h"
 #include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/details/float/twofold.h"
+
+#pragma warning(push)
+#pragma warning(disable: 4127)  //conditional expression is constant
 
 namespace matcl { namespace simd { namespace details
 {
 
+// base of logarithms
+static const int log_base_e     = 0;
+static const int log_base_2     = 1;
+static const int log_base_10    = 2;
+
 //-----------------------------------------------------------------------
 //                              DOUBLE
 //-----------------------------------------------------------------------
@@ -30,10 +39,17 @@ struct simd_log_approx_double
 {
     using simd_type     = simd<double, Bits, Tag>;
 
+    // coefficients are the same as in simd_log_approx_double_data::poly
     force_inline
     static simd_type eval(const simd_type& s)
-    {        
-        return estrin<7>(s, simd_log_approx_double_data::poly);
+    {
+        return estrin_c<6.66666666666688547299310656675190687e-01,
+                        3.99999999987401741406920347834347647e-01,
+                        2.85714288669539260936377812250363457e-01,
+                        2.22221871825960117598424175414698074e-01,
+                        1.81841095988965909080780869966928340e-01,
+                        1.53009602706038610316834383087625899e-01,
+                        1.49202865515212540004373762442151109e-01>(s);
     };
 };
 
@@ -63,10 +79,12 @@ struct simd_log_approx_double
     };
 #endif
 
-template<int Bits, class Tag> 
-struct simd_log<double, Bits, Tag>
+// evaluate logarithm with base given by the Base argument
+template<int Bits, class Tag, int Base> 
+struct simd_log_double_impl
 {
     using simd_type     = simd<double, Bits, Tag>;
+    using twofold_type  = twofold<simd_type>;
 
     force_inline
     static void reduction(const simd_type& x, simd_type& k0, simd_type& k, simd_type& frac)
@@ -97,6 +115,9 @@ struct simd_log<double, Bits, Tag>
         // low part of log(2)
         const simd_type log2_lo = simd_type(-1.2905320270077143679e-11);
 
+        if (Base != log_base_e)
+            return finalization_base(s * p, k, f);
+
         simd_type res       = fma_f(s, p, k * log2_lo);
         res                 = f + res;
         res                 = fma_f(k, log2_hi, res);
@@ -104,6 +125,48 @@ struct simd_log<double, Bits, Tag>
         return res;
     }
 
+    // log_B(x) = k * log_B(2) + C * (f + t), where C = log_B(e) and f + t
+    // = log(frac); C * f is evaluated exactly and k * log_B(2) + C * f is
+    // formed using twofold arithmetic
+    force_inline
+    static simd_type finalization_base(const simd_type& t, const simd_type& k, const simd_type& f)
+    {
+        simd_type C_hi, C_lo, kl_hi, kl_lo;
+
+        if (Base == log_base_2)
+        {
+            C_hi            = simd_type(1.4426950408889634);
+            C_lo            = simd_type(2.0355273740931033e-17);
+
+            kl_hi           = k;
+            kl_lo           = simd_type::zero();
+        }
+        else
+        {
+            C_hi            = simd_type(0.4342944819032518);
+            C_lo            = simd_type(1.098319650216765e-17);
+
+            // high part of log10(2) stored with precision 40 bits
+            const simd_type log_hi  = simd_type(0.3010299956640665);
+
+            // low part of log10(2)
+            const simd_type log_lo  = simd_type(-8.532344317057107e-14);
+
+            kl_hi           = k * log_hi;   // exact
+            kl_lo           = k * log_lo;
+        };
+
+        twofold_type y      = twofold_mult(C_hi, f);
+        simd_type lo        = fma_f(C_lo, f, y.error + kl_lo);
+        lo                  = fma_f(C_hi, t, lo);
+
+        // |kl_hi| >= |y| if k != 0
+        twofold_type h      = twofold_sum_sorted(kl_hi, y.value);
+        simd_type res       = h.value + (h.error + lo);
+
+        return res;
+    };
+
     force_inline
     static simd_type eval(const simd_type& x)
     {
@@ -273,10 +336,12 @@ struct simd_log_approx_float<Bits, scalar_sse_tag>
     };
 };
 
-template<int Bits, class Tag> 
-struct simd_log<float, Bits, Tag>
+// evaluate logarithm with base given by the Base argument
+template<int Bits, class Tag, int Base> 
+struct simd_log_float_impl
 {
     using simd_type     = matcl::simd::simd<float, Bits, Tag>;
+    using twofold_type  = twofold<simd_type>;
 
     force_inline
     static void reduction(const simd_type& x, simd_type& k0, simd_type& k, simd_type& frac)
@@ -307,6 +372,10 @@ struct simd_log<float, Bits, Tag>
         const simd_type log2_lo  = simd_type(1.4286068203094172321e-06f);
 
         simd_type s2        = s * s;
+
+        if (Base != log_base_e)
+            return finalization_base(p * s2, k, s);
+
         simd_type res       = p * s2;
         res                 = fma_f(k, log2_lo, res);
         res                 = res + s;
@@ -315,6 +384,47 @@ struct simd_log<float, Bits, Tag>
         return res;
     }
 
+    // log_B(x) = k * log_B(2) + C * (f + t), where C = log_B(e) and f + t
+    // = log(frac); see simd_log_double_impl::finalization_base
+    force_inline
+    static simd_type finalization_base(const simd_type& t, const simd_type& k, const simd_type& f)
+    {
+        simd_type C_hi, C_lo, kl_hi, kl_lo;
+
+        if (Base == log_base_2)
+        {
+            C_hi            = simd_type(1.4426950216293335f);
+            C_lo            = simd_type(1.925963033500011e-08f);
+
+            kl_hi           = k;
+            kl_lo           = simd_type::zero();
+        }
+        else
+        {
+            C_hi            = simd_type(0.4342944920063019f);
+            C_lo            = simd_type(-1.010305005223168e-08f);
+
+            // high part of log10(2) stored with precision 16 bits
+            const simd_type log_hi  = simd_type(0.301025390625f);
+
+            // low part of log10(2)
+            const simd_type log_lo  = simd_type(4.605038981195214e-06f);
+
+            kl_hi           = k * log_hi;   // exact
+            kl_lo           = k * log_lo;
+        };
+
+        twofold_type y      = twofold_mult(C_hi, f);
+        simd_type lo        = fma_f(C_lo, f, y.error + kl_lo);
+        lo                  = fma_f(C_hi, t, lo);
+
+        // |kl_hi| >= |y| if k != 0
+        twofold_type h      = twofold_sum_sorted(kl_hi, y.value);
+        simd_type res       = h.value + (h.error + lo);
+
+        return res;
+    };
+
     force_inline
     static simd_type eval(const simd_type& x)
     {
@@ -428,4 +538,118 @@ struct simd_log<float, Bits, Tag>
     }
 };
 
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_log<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_log_double_impl<Bits, Tag, log_base_e>::eval(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_log<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_log_float_impl<Bits, Tag, log_base_e>::eval(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_log2<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_log_double_impl<Bits, Tag, log_base_2>::eval(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_log2<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_log_float_impl<Bits, Tag, log_base_2>::eval(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_log10<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_log_double_impl<Bits, Tag, log_base_10>::eval(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_log10<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_log_float_impl<Bits, Tag, log_base_10>::eval(x);
+    };
+};
+
+// log1p(x) = log(u + e) = log(u) + e/u + O(e^2), where u + e = 1 + x
+// is evaluated exactly
+template<class Val, int Bits, class Tag>
+struct simd_log1p_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using twofold_type  = twofold<simd_type>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type min_x   = -one;
+        const simd_type max_x   = simd_type(std::numeric_limits<Val>::max());
+
+        twofold_type u          = twofold_sum(one, x);
+        simd_type res           = simd_log<Val, Bits, Tag>::eval(u.value);
+
+        // correction is valid only for -1 < x < inf
+        simd_type normal        = gt(x, min_x) && leq(x, max_x);
+
+        if (all(normal) == true)
+            return res + u.error / u.value;
+
+        simd_type res_corr      = res + u.error / u.value;
+        return if_then_else(normal, res_corr, res);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_log1p<double, Bits, Tag> : public simd_log1p_impl<double, Bits, Tag>
+{};
+
+template<int Bits, class Tag>
+struct simd_log1p<float, Bits, Tag> : public simd_log1p_impl<float, Bits, Tag>
+{};
+
 }}}
+
+#pragma warning(pop)
@@ -0,0 +1,416 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/details/math/impl/simd_exp.h"
+#include "matcl-simd/details/math/impl/simd_log.h"
+#include "matcl-simd/details/float/twofold.h"
+#include "matcl-simd/poly/poly_eval.h"
+
+#include <limits>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct pow_log_data
+{};
+
+// constants used by the logarithm evaluated in twofold precision
+template<>
+struct MATCL_SIMD_EXPORT pow_log_data<double>
+{
+    // approximation of Q(p) = (R(p) - 2/3) / p on [0, (3 - 2*sqrt(2))^2],
+    // where R(s^2) = (2*atanh(s) - 2*s) / s^3
+    static const double poly[8];
+
+    template<int Bits, class Tag>
+    using exp_impl  = simd_exp_double_impl<Bits, Tag, exp_base_e>;
+
+    // high part of log(2) stored with precision 35 bits
+    static double   log2_hi()       { return 0.69314718057285062969; };
+    static double   log2_lo()       { return -1.2905320270077143679e-11; };
+
+    // 2/3 = two_thirds_hi + two_thirds_lo
+    static double   two_thirds_hi() { return 0.6666666666666666; };
+    static double   two_thirds_lo() { return 3.700743415417188e-17; };
+
+    // denormal numbers are multiplied by 2^denorm_shift
+    static double   denorm_shift()  { return 52.0; };
+    static double   denorm_scale()  { return 4503599627370496.0; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        return estrin<8>(x, poly);
+    };
+};
+
+template<>
+struct MATCL_SIMD_EXPORT pow_log_data<float>
+{
+    // see pow_log_data<double>
+    static const float poly[4];
+
+    template<int Bits, class Tag>
+    using exp_impl  = simd_exp_float_impl<Bits, Tag, exp_base_e>;
+
+    // high part of log(2) stored with precision 16 bits
+    static float    log2_hi()       { return 0.693145751953125f; };
+    static float    log2_lo()       { return 1.428606765330187e-06f; };
+
+    static float    two_thirds_hi() { return 0.6666666865348816f; };
+    static float    two_thirds_lo() { return -1.9868215517249155e-08f; };
+
+    static float    denorm_shift()  { return 23.0f; };
+    static float    denorm_scale()  { return 8388608.0f; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        return estrin<4>(x, poly);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              POW
+//-----------------------------------------------------------------------
+// evaluate x^y = exp(y * log(x)), where log(x) is evaluated in twofold
+// precision and the low part of y * log(x) is added to the argument of exp
+// after reduction; relative error of log(x) is about 2^-65 for double
+// precision and 2^-36 for single precision, therefore x^y is as accurate
+// as exp
+template<class Val, int Bits, class Tag>
+struct simd_pow_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using twofold_type  = twofold<simd_type>;
+    using data          = pow_log_data<Val>;
+    using exp_impl      = typename data::template exp_impl<Bits, Tag>;
+
+    // log(x) = lh + ll for a normal, positive and finite x; k_shift is added
+    // to the exponent of x
+    force_inline
+    static void log_twofold(const simd_type& x, const simd_type& k_shift,
+                            simd_type& lh, simd_type& ll)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type two     = simd_type(Val(2.0));
+
+        // sqrt(2)/2
+        const simd_type min_x   = simd_type(Val(0.70710678118654752440084436210485));
+
+        //-----------------------------------------------------------------
+        //                      reduction
+        //-----------------------------------------------------------------
+        // x = 2^k * frac, frac in [sqrt(2)/2, sqrt(2))
+        simd_type frac0     = fraction(x);
+        simd_type k0        = exponent(x) + k_shift;
+
+        simd_type cond      = lt(frac0,  min_x);
+        simd_type frac      = if_add(cond, frac0, frac0);
+        simd_type k         = if_sub(cond, k0, one);
+
+        // log(frac) = 2 * atanh(s), s = f / (2 + f), |s| <= 3 - 2*sqrt(2);
+        // f is exact, s = sh + sl
+        simd_type f         = frac - one;
+        twofold_type d      = twofold_sum_sorted(two, f);
+
+        simd_type sh        = f / d.value;
+        simd_type r         = fnma_a(sh, d.value, f);   // exact
+        r                   = fnma_f(sh, d.error, r);
+        simd_type sl        = r / d.value;
+
+        //-----------------------------------------------------------------
+        //                      approximation
+        //-----------------------------------------------------------------
+        // 2 * atanh(s) = 2*s + s^3 * R(s^2), R(p) = 2/3 + p * Q(p);
+        // sl * d/ds (2 * atanh(s)) = 2*sl / (1 - s^2)
+        twofold_type p      = twofold_mult(sh, sh);
+        simd_type q         = data::eval(p.value);
+
+        // R = R.value + R_lo
+        twofold_type v      = twofold_mult(p.value, q);
+        twofold_type R      = twofold_sum_sorted(simd_type(data::two_thirds_hi()), v.value);
+        simd_type R_lo      = fma_f(p.error, q, v.error) + simd_type(data::two_thirds_lo());
+        R_lo                = R.error + R_lo;
+
+        // sh^3 = c3.value + c3_lo
+        twofold_type c3     = twofold_mult(p.value, sh);
+        simd_type c3_lo     = fma_f(p.error, sh, c3.error);
+
+        // T = sh^3 * R(sh^2)
+        twofold_type T      = twofold_mult(c3.value, R.value);
+        simd_type T_lo      = fma_f(c3.value, R_lo, T.error);
+        T_lo                = fma_f(c3_lo, R.value, T_lo);
+
+        // log(frac) = F.value + F_lo
+        twofold_type F      = twofold_sum_sorted(sh + sh, T.value);
+        simd_type sl2       = sl + sl;
+        simd_type F_lo      = fma_f(sl2, fma_f(p.value, p.value, p.value), sl2);
+        F_lo                = F.error + (F_lo + T_lo);
+
+        //-----------------------------------------------------------------
+        //                      finalization
+        //-----------------------------------------------------------------
+        // log(x) = k * log(2) + log(frac); k * log2_hi is exact
+        simd_type kl_hi     = k * simd_type(data::log2_hi());
+        simd_type kl_lo     = k * simd_type(data::log2_lo());
+
+        // |kl_hi| >= |log(frac)| if k != 0
+        twofold_type h      = twofold_sum_sorted(kl_hi, F.value);
+
+        lh                  = h.value;
+        ll                  = h.error + (F_lo + kl_lo);
+    };
+
+    // evaluate x^y for a normal, positive and finite x and finite y
+    force_inline
+    static simd_type eval_core(const simd_type& x, const simd_type& y, const simd_type& k_shift)
+    {
+        simd_type lh, ll;
+        log_twofold(x, k_shift, lh, ll);
+
+        // y * log(x) = z.value + z_lo
+        twofold_type z      = twofold_mult(y, lh);
+        simd_type z_lo      = fma_f(y, ll, z.error);
+
+        return exp_impl::eval_ext(z.value, z_lo);
+    };
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type min_x   = simd_type(std::numeric_limits<Val>::min());
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        simd_type ax        = abs(x);
+
+        // normal return for normal and finite x and finite y
+        simd_type cond_norm = geq(ax, min_x) && lt(ax, inf) && lt(abs(y), inf);
+
+        if (all(cond_norm) == false)
+            return process_special(x, y, ax, cond_norm);
+
+        simd_type res       = eval_core(ax, y, zero);
+
+        if (any(lt(x, zero)) == false)
+            return res;
+
+        return process_sign(x, y, res);
+    };
+
+    static simd_type process_special(const simd_type& x, const simd_type& y,
+                                     const simd_type& ax, const simd_type& cond_norm)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        // denormal x is moved to the normal range of exponents
+        simd_type denorm    = lt(ax, simd_type(std::numeric_limits<Val>::min()))
+                            && gt(ax, zero) && lt(abs(y), inf);
+
+        simd_type ax_s      = if_then_else(denorm, ax * simd_type(data::denorm_scale()), ax);
+        simd_type k_shift   = if_then_else(denorm, -simd_type(data::denorm_shift()), zero);
+        simd_type regular   = cond_norm || denorm;
+
+        simd_type res       = eval_core(ax_s, y, k_shift);
+
+        // x = 0, inf, NaN or y = inf, NaN; exp and log return correct
+        // results, except 0 * inf
+        simd_type log_x     = simd_log<Val, Bits, Tag>::eval(ax);
+        simd_type res_irr   = simd_exp<Val, Bits, Tag>::eval(y * log_x);
+
+        res                 = if_then_else(regular, res, res_irr);
+
+        // x^0 = 1, 1^y = 1, (-1)^(+-inf) = 1, also for NaN arguments
+        simd_type is_one    = eeq(y, zero) || eeq(x, one) || (eeq(ax, one) && eeq(abs(y), inf));
+        res                 = if_then_else(is_one, one, res);
+
+        return process_sign(x, y, res);
+    };
+
+    // x^y = (-1)^y * |x|^y for x < 0; result is NaN for finite x < 0 and
+    // noninteger y; sign of zero is also taken into account
+    static simd_type process_sign(const simd_type& x, const simd_type& y, const simd_type& res)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        // infinite y is an even integer
+        simd_type is_int    = eeq(round(y), y);
+        simd_type y2        = y * half;
+        simd_type is_odd    = is_int && neq(round(y2), y2);
+
+        simd_type res2      = if_then_else(is_odd, copysign(res, x), res);
+        simd_type is_nan    = lt(x, zero) && gt(x, -inf) && !is_int;
+
+        return if_nan_else(is_nan, res2);
+    };
+};
+
+// evaluate x^n for integer n using binary powering; relative error grows
+// linearly with log2(|n|)
+template<class Val, int Bits, class Tag>
+struct simd_powi_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& n)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        simd_type m         = abs(n);
+        simd_type res       = eval_abs(x, m);
+        simd_type neg       = lt(n, zero);
+
+        // x^|n| overflows for finite x, but x^-|n| can be a denormal number
+        simd_type over      = neg && eeq(abs(res), inf) && lt(abs(x), inf);
+
+        if (any(over) == true)
+        {
+            simd_type res_s = eval_inv_scaled(if_then_else(over, x, one), 
+                                              if_then_else(over, m, zero));
+
+            res             = if_then_else(neg, one / res, res);
+            return if_then_else(over, res_s, res);
+        };
+
+        return if_then_else(neg, one / res, res);
+    };
+
+    // evaluate x^m for nonnegative integer m
+    force_inline
+    static simd_type eval_abs(const simd_type& x, const simd_type& m0)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type m         = m0;
+        simd_type b         = x;
+        simd_type res       = simd_type::one();
+
+        for (;;)
+        {
+            simd_type m2    = floor(m * half);
+            simd_type odd   = gt(m, m2 + m2);
+
+            res             = if_then_else(odd, res * b, res);
+            m               = m2;
+
+            if (all(eeq(m, zero)) == true)
+                break;
+
+            b               = b * b;
+        };
+
+        return res;
+    };
+
+    // evaluate x^-m for nonnegative integer m and finite, nonzero x; x^m is 
+    // represented as f * 2^e, where 0.5 <= |f| < 1 and e is stored as floating
+    // point value; this representation cannot overflow
+    static simd_type eval_inv_scaled(const simd_type& x, const simd_type& m0)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+
+        // exponent of the smallest regular number
+        const simd_type min_exp = simd_type(Val(std::numeric_limits<Val>::min_exponent - 1));
+
+        simd_type m         = m0;
+        simd_type b         = fraction(x);
+        simd_type b_exp     = exponent(x);
+        simd_type res       = one;
+        simd_type res_exp   = zero;
+
+        for (;;)
+        {
+            simd_type m2    = floor(m * half);
+            simd_type odd   = gt(m, m2 + m2);
+
+            // products of regular numbers from [0.5, 1) are regular
+            simd_type r     = res * b;
+            res             = if_then_else(odd, fraction(r), res);
+            res_exp         = if_then_else(odd, res_exp + b_exp + exponent(r), res_exp);
+            m               = m2;
+
+            if (all(eeq(m, zero)) == true)
+                break;
+
+            simd_type b2    = b * b;
+            b               = fraction(b2);
+            b_exp           = b_exp + b_exp + exponent(b2);
+        };
+
+        // x^-m = 1/f * 2^-e; 2^-e can be smaller than the smallest regular
+        // number, therefore scaling is split into two steps; the first
+        // multiplication is exact and the second one rounds only once;
+        // for k < 2 * min_exp the result is zero
+        simd_type k         = max(-res_exp, min_exp + min_exp);
+        simd_type k1        = ceil(k * half);
+        simd_type k2        = k - k1;
+
+        return (one / res) * pow2k(k1) * pow2k(k2);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+template<int Bits, class Tag>
+struct simd_pow<double, Bits, Tag> : public simd_pow_impl<double, Bits, Tag>
+{};
+
+template<int Bits, class Tag>
+struct simd_pow<float, Bits, Tag> : public simd_pow_impl<float, Bits, Tag>
+{};
+
+template<int Bits, class Tag>
+struct simd_powi<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+    using simd_int      = simd<int64_t, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_int& n)
+    {
+        return simd_powi_impl<double, Bits, Tag>::eval(x, n.convert_to_double());
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_powi<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+    using simd_int      = simd<int32_t, Bits, Tag>;
+
+    // values of n are converted to float; conversion is exact if |n| <= 2^24
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_int& n)
+    {
+        return simd_powi_impl<float, Bits, Tag>::eval(x, n.convert_to_float());
+    };
+};
+
+}}}
@@ -0,0 +1,393 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/arch/simd_impl.h"
+#include "matcl-simd/details/math/simd_math_func_def.h"
+#include "matcl-simd/poly/poly_eval.h"
+
+#include <limits>
+#include <type_traits>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                              DATA
+//-----------------------------------------------------------------------
+template<class Val>
+struct root_data
+{};
+
+template<>
+struct MATCL_SIMD_EXPORT root_data<double>
+{
+    // approximation of cbrt(x) on [1/2, 1] with relative error 1.3e-5
+    static const double poly_cbrt[5];
+
+    // 2^(1/3), 2^(2/3)
+    static double   cbrt2()         { return 1.2599210498948732; };
+    static double   cbrt4()         { return 1.5874010519681994; };
+
+    // denormal arguments of cbrt are scaled by 2^(3 * denorm_scale)
+    static double   denorm_scale()  { return 18.0; };
+    static double   min_normal()    { return 2.2250738585072014e-308; };
+
+    // arguments of hypot are scaled by 2^-k, where k <= max_scale
+    static double   max_scale()     { return 1000.0; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_cbrt(const Arg& x)
+    {
+        return estrin<5>(x, poly_cbrt);
+    };
+};
+
+template<>
+struct MATCL_SIMD_EXPORT root_data<float>
+{
+    // see root_data<double>
+    static const float poly_cbrt[5];
+
+    static float    cbrt2()         { return 1.25992107f; };
+    static float    cbrt4()         { return 1.58740103f; };
+
+    static float    denorm_scale()  { return 8.0f; };
+    static float    min_normal()    { return 1.17549435e-38f; };
+
+    static float    max_scale()     { return 120.0f; };
+
+    template<class Arg>
+    force_inline
+    static Arg eval_cbrt(const Arg& x)
+    {
+        return estrin<5>(x, poly_cbrt);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              ROOTS
+//-----------------------------------------------------------------------
+// reciprocals, roots and hypot; hardware approximations of 1/x and
+// 1/sqrt(x) are defined in arch specific files and refined here
+template<class Val, int Bits, class Tag>
+struct simd_root_impl
+{
+    using simd_type     = simd<Val, Bits, Tag>;
+    using data          = root_data<Val>;
+
+    // one Newton step for 1/x, y ~ 1/x; relative error e of y is reduced
+    // to e^2
+    force_inline
+    static simd_type newton_rcp(const simd_type& x, const simd_type& y)
+    {
+        const simd_type one     = simd_type::one();
+
+        simd_type e     = fnma_f(x, y, one);
+        return fma_f(y, e, y);
+    };
+
+    // one Newton step for 1/sqrt(x), y ~ 1/sqrt(x); relative error e of y
+    // is reduced to 3/2 * e^2
+    force_inline
+    static simd_type newton_rsqrt(const simd_type& x, const simd_type& y)
+    {
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+
+        simd_type e     = fnma_f(x * y, y, one);
+        return fma_f(half * y, e, y);
+    };
+
+    // 1/x obtained from rcp_approx by Steps Newton steps; results of
+    // rcp_approx for x = 0 and x = inf are returned without refinement
+    template<int Steps>
+    force_inline
+    static simd_type eval_rcp(const simd_type& x)
+    {
+        simd_type y0    = simd_rcp_approx<Val, Bits, Tag>::eval(x);
+        simd_type y     = y0;
+
+        for (int i = 0; i < Steps; ++i)
+            y           = newton_rcp(x, y);
+
+        return if_then_else(is_nan(y), y0, y);
+    };
+
+    // 1/sqrt(x) obtained from rsqrt_approx by Steps Newton steps; see
+    // also eval_rcp
+    template<int Steps>
+    force_inline
+    static simd_type eval_rsqrt(const simd_type& x)
+    {
+        simd_type y0    = simd_rsqrt_approx<Val, Bits, Tag>::eval(x);
+        simd_type y     = y0;
+
+        for (int i = 0; i < Steps; ++i)
+            y           = newton_rsqrt(x, y);
+
+        return if_then_else(is_nan(y), y0, y);
+    };
+
+    // x = f * 2^(3q + r), 1/2 <= f < 1, r = 0, 1, 2; cbrt(m), m = f * 2^r
+    // is approximated by p(f) * 2^(r/3) and refined by Newton steps, in
+    // the last step the residual y^3 - m is computed in twofold precision
+    force_inline
+    static simd_type eval_cbrt(const simd_type& x)
+    {
+        const simd_type zero    = simd_type::zero();
+        const simd_type one     = simd_type::one();
+        const simd_type half    = simd_type(Val(0.5));
+        const simd_type three   = simd_type(Val(3.0));
+        const simd_type third   = simd_type(Val(1.0) / Val(3.0));
+
+        //-----------------------------------------------------------------
+        //                      reduction
+        //-----------------------------------------------------------------
+        simd_type ax        = abs(x);
+
+        // move denormal x to normal range of exponents
+        simd_type denorm    = lt(ax, simd_type(data::min_normal()));
+        simd_type ds        = simd_type(data::denorm_scale());
+        simd_type scale     = pow2k(three * ds);
+
+        ax                  = if_then_else(denorm, ax * scale, ax);
+
+        simd_type f         = fraction(ax);
+        simd_type e         = exponent(ax);
+        simd_type q         = floor((e + half) * third);
+        simd_type r         = e - three * q;
+        simd_type m         = f * pow2k(r);
+
+        q                   = if_then_else(denorm, q - ds, q);
+
+        //-----------------------------------------------------------------
+        //                      approximation
+        //-----------------------------------------------------------------
+        simd_type c         = if_then_else(eeq(r, one), simd_type(data::cbrt2()), one);
+        c                   = if_then_else(eeq(r, simd_type(Val(2.0))),
+                                simd_type(data::cbrt4()), c);
+
+        simd_type y         = data::eval_cbrt(f) * c;
+
+        // plain Newton step for double precision
+        if (std::is_same<Val, double>::value == true)
+        {
+            simd_type y2    = y * y;
+            simd_type d     = fms_f(y2, y, m);
+            y               = fnma_f(third, d / y2, y);
+        };
+
+        simd_type y2        = y * y;
+        simd_type y2_lo     = fms_f(y, y, y2);
+        simd_type d         = fma_f(y2_lo, y, fms_f(y2, y, m));
+        y                   = fnma_f(third, d / y2, y);
+
+        //-----------------------------------------------------------------
+        //                      finalization
+        //-----------------------------------------------------------------
+        simd_type res       = copysign(y * pow2k(q), x);
+
+        // cbrt(x) = x for x = +-0, +-inf, NaN
+        simd_type special   = eeq(x, zero) || !is_finite(x);
+        res                 = if_then_else(special, x, res);
+
+        return res;
+    };
+
+    // hypot(x, y) = 2^k * sqrt(a^2 + b^2), a = max(|x|, |y|) * 2^-k,
+    // b = min(|x|, |y|) * 2^-k, where k is the exponent of max(|x|, |y|);
+    // scaling is exact and a^2 + b^2 cannot overflow or underflow
+    force_inline
+    static simd_type eval_hypot(const simd_type& x, const simd_type& y)
+    {
+        const simd_type inf     = simd_type(std::numeric_limits<Val>::infinity());
+
+        simd_type ax        = abs(x);
+        simd_type ay        = abs(y);
+        simd_type mx        = max(ax, ay);
+        simd_type mn        = min(ax, ay);
+
+        simd_type k         = min(exponent(mx), simd_type(data::max_scale()));
+        simd_type s         = pow2k(-k);
+
+        simd_type a         = mx * s;
+        simd_type b         = mn * s;
+        simd_type h         = sqrt(fma_f(a, a, b * b));
+
+        simd_type res       = h * pow2k(k);
+
+        // ax + ay is inf or NaN if x or y is not finite; inf has priority
+        // over NaN
+        simd_type sum       = ax + ay;
+        simd_type special   = !is_finite(sum);
+
+        if (any(special) == true)
+        {
+            simd_type is_inf    = eeq(ax, inf) || eeq(ay, inf);
+
+            res                 = if_then_else(special, sum, res);
+            res                 = if_then_else(is_inf, inf, res);
+        };
+
+        return res;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                              INTERFACE
+//-----------------------------------------------------------------------
+// default implementations of approximations of 1/x and 1/sqrt(x) used if
+// no hardware approximation is available
+template<int Bits, class Tag>
+struct simd_rcp_approx<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / x;
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rcp_approx<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / x;
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rcp<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / x;
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rcp<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / x;
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rsqrt_approx<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / sqrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rsqrt_approx<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / sqrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rsqrt<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / sqrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_rsqrt<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_type::one() / sqrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_cbrt<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<double, Bits, Tag>::eval_cbrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_cbrt<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x)
+    {
+        return simd_root_impl<float, Bits, Tag>::eval_cbrt(x);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_hypot<double, Bits, Tag>
+{
+    using simd_type     = simd<double, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_root_impl<double, Bits, Tag>::eval_hypot(x, y);
+    };
+};
+
+template<int Bits, class Tag>
+struct simd_hypot<float, Bits, Tag>
+{
+    using simd_type     = simd<float, Bits, Tag>;
+
+    force_inline
+    static simd_type eval(const simd_type& x, const simd_type& y)
+    {
+        return simd_root_impl<float, Bits, Tag>::eval_hypot(x, y);
+    };
+};
+
+}}}
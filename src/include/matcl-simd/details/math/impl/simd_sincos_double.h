@@ -38,11 +38,18 @@ struct simd_sincos_table_double
 {
     using simd_type         = ms::simd<double, Bits, Tag>;
 
+    // polynomials are evaluated simultaneously in order to hide latency
     force_inline
     static void eval(const simd_type& x, simd_type& p_sin, simd_type& p_cos)
     {
-        p_sin               = estrin<6>(x, simd_sincos_table_double_data::poly_sin);
-        p_cos               = estrin<6>(x, simd_sincos_table_double_data::poly_cos);
+        const double* poly[2]   = {simd_sincos_table_double_data::poly_sin, 
+                                   simd_sincos_table_double_data::poly_cos};
+        simd_type res[2];
+
+        estrin_multi_poly<6, 2>(x, poly, res);
+
+        p_sin               = res[0];
+        p_cos               = res[1];
     };
 };
 
@@ -85,6 +92,18 @@ struct simd_sincos<double, Bits, Tag>
         return ret;
     }
 
+    static void process_overflow_both(const simd_type& x, const simd_type& in_range,
+                    simd_type& ret_s, simd_type& ret_c)
+    {
+        const simd_type nan_v   = simd_type(std::numeric_limits<double>::quiet_NaN());
+
+        simd_type fin   = ms::is_finite(x);
+        eval_with_full_reduction_both(x, in_range, ret_s, ret_c);
+
+        ret_s           = ms::if_then_else(fin, ret_s, nan_v);
+        ret_c           = ms::if_then_else(fin, ret_c, nan_v);
+    }
+
     template<int Version>
     force_inline
     static simd_type eval_sincos(const simd_type& x)
@@ -147,6 +166,39 @@ struct simd_sincos<double, Bits, Tag>
             ::eval_both(qi, pc, ps, ret_s, ret_c);
     };
 
+    force_inline
+    static void eval_sincos_both(const simd_type& x, simd_type& ret_s, simd_type& ret_c)
+    {        
+        // 2^19 * pi/2
+        const simd_type max_x   = simd_type(823549.6);
+
+        simd_type in_range  = gt(max_x, abs(x));
+        bool in_range_all   = all(in_range);
+
+        if (in_range_all == false)
+            return process_overflow_both(x, in_range, ret_s, ret_c);
+
+        //-----------------------------------------------------------------
+        //                      reduction
+        //-----------------------------------------------------------------
+        simd_type xe;
+        simd_int qi;
+
+        simd_type xv        = pi2_reduction<double, Bits, Tag>::reduction_CW3(x, xe, qi);        
+
+        //-----------------------------------------------------------------
+        //                      approximation
+        //-----------------------------------------------------------------
+        simd_type pc, ps;
+        approximation(xv, xe, pc, ps);
+
+        //-----------------------------------------------------------------
+        //                      reconstruction
+        //-----------------------------------------------------------------       
+        simd_sincos_reconstruction<double, Bits,Tag>
+            ::eval_both(qi, pc, ps, ret_s, ret_c);
+    };
+
     template<int Version>
     force_inline
     static simd_type eval_with_full_reduction(const simd_type& x, const simd_type& in_range)
@@ -176,6 +228,34 @@ struct simd_sincos<double, Bits, Tag>
         return ret;
     }
 
+    force_inline
+    static void eval_with_full_reduction_both(const simd_type& x, const simd_type& in_range,
+                    simd_type& ret_s, simd_type& ret_c)
+    {
+        //-----------------------------------------------------------------
+        //                      reduction
+        //-----------------------------------------------------------------
+        simd_type xv, xe;
+        simd_int q_lo;
+
+        if (any(in_range) == true)
+            xv  = pi2_reduction<double, Bits, Tag>::reduction_CW3(x, xe, q_lo); 
+
+        pi2_reduction<double, Bits, Tag>::reduction_full(x, in_range, xv, xe, q_lo);
+
+        //-----------------------------------------------------------------
+        //                      approximation
+        //-----------------------------------------------------------------
+        simd_type pc, ps;
+        approximation(xv, xe, pc, ps);
+
+        //-----------------------------------------------------------------
+        //                      reconstruction
+        //-----------------------------------------------------------------
+        simd_sincos_reconstruction<double, Bits, Tag>
+            ::eval_both(q_lo, pc, ps, ret_s, ret_c);
+    }
+
     force_inline
     static void approximation(const simd_type& xv, const simd_type& xe, simd_type& ret_cos, 
                              simd_type& ret_sin)
@@ -42,19 +42,32 @@ struct simd_sincos_table_float
 {
     using simd_type         = ms::simd<float, Bits, Tag>;
 
+    // polynomials are evaluated simultaneously in order to hide latency
     force_inline
     static void eval(const simd_type& x, simd_type& p_sin, simd_type& p_cos)
     {
-        p_sin               = estrin<3>(x, simd_sincos_table_float_data::poly_sin);
-        p_cos               = estrin<3>(x, simd_sincos_table_float_data::poly_cos);
+        const float* poly[2]    = {simd_sincos_table_float_data::poly_sin, 
+                                   simd_sincos_table_float_data::poly_cos};
+        simd_type res[2];
+
+        estrin_multi_poly<3, 2>(x, poly, res);
+
+        p_sin               = res[0];
+        p_cos               = res[1];
     };
 
     template<class Simd_double>
     force_inline
     static void eval_double(const Simd_double& x, Simd_double& p_sin, Simd_double& p_cos)
     {
-        p_sin               = estrin<3>(x, simd_sincos_table_float_data::poly_sin_double);
-        p_cos               = estrin<3>(x, simd_sincos_table_float_data::poly_cos_double);
+        const double* poly[2]   = {simd_sincos_table_float_data::poly_sin_double, 
+                                   simd_sincos_table_float_data::poly_cos_double};
+        Simd_double res[2];
+
+        estrin_multi_poly<3, 2>(x, poly, res);
+
+        p_sin               = res[0];
+        p_cos               = res[1];
     };
 };
 
@@ -109,6 +122,17 @@ struct simd_sincos_float
         return ret;
     }
 
+    static void process_overflow_both(const simd_type& x, simd_type& ret_s, simd_type& ret_c)
+    {
+        const simd_type nan_v   = simd_type(std::numeric_limits<float>::quiet_NaN());
+
+        simd_type fin   = ms::is_finite(x);
+        eval_with_full_reduction_both(x, ret_s, ret_c);
+
+        ret_s           = ms::if_then_else(fin, ret_s, nan_v);
+        ret_c           = ms::if_then_else(fin, ret_c, nan_v);
+    }
+
     template<int Version>
     force_inline
     static simd_type eval_with_full_reduction(const simd_type& x)
@@ -137,6 +161,32 @@ struct simd_sincos_float
         return ret;
     }
 
+    force_inline
+    static void eval_with_full_reduction_both(const simd_type& x, simd_type& ret_s, 
+                    simd_type& ret_c)
+    {
+        // max_q * pi/2
+        const simd_type max_x   = simd_type(421657428.26631f);
+
+        simd_type in_range      = gt(max_x, abs(x));
+        bool in_range_all       = all(in_range);
+        bool in_range_any       = any(in_range);
+
+        simd_type xv, xe;
+        simd_int q_lo;
+
+        if (in_range_any == true)
+            xv  = pi2_reduction<float, Bits, Tag>::reduction_CW_double(x, xe, q_lo); 
+
+        if (in_range_all == false)
+            pi2_reduction<float, Bits, Tag>::reduction_full(x, in_range, xv, xe, q_lo);
+
+        simd_type pc, ps;
+        approximation(xv, xe, pc, ps);
+
+        simd_sincos_reconstruction<float, Bits,Tag>::eval_both(q_lo, pc, ps, ret_s, ret_c);
+    }
+
     force_inline
     static void approximation(const simd_type& xv, const simd_type& xe, simd_type& ret_cos, 
                              simd_type& ret_sin)
@@ -215,6 +265,29 @@ struct simd_sincos_float
         return ret;
     };
 
+    force_inline
+    static void eval_sincos_both(const simd_type& x, simd_type& ret_s, simd_type& ret_c)
+    {        
+        // max_q * pi/2
+        const simd_type max_x   = simd_type(252.898f);
+
+        simd_type in_range  = gt(max_x, abs(x));
+        bool in_range_all   = all(in_range);
+
+        if (in_range_all == false)
+            return process_overflow_both(x, ret_s, ret_c);
+
+        simd_type xe;
+        simd_int qi;
+
+        simd_type xv        = pi2_reduction<float, Bits, Tag>::reduction_CW3(x, xe, qi);
+
+        simd_type pc, ps;
+        approximation(xv, xe, pc, ps);
+
+        simd_sincos_reconstruction<float, Bits, Tag>::eval_both(qi, pc, ps, ret_s, ret_c);
+    };
+
     force_inline
     static simd_type eval_sin(const simd_type& x)
     {
@@ -248,6 +321,21 @@ struct simd_sincos_float<Bits, Tag, true>
         return ret.convert_to_float();
     }
 
+    static void process_overflow_both(const simd_double& x, simd_type& ret_s, simd_type& ret_c)
+    {
+        const simd_double nan_v   = simd_double(std::numeric_limits<double>::quiet_NaN());
+
+        simd_double fin = ms::is_finite(x);
+        simd_double rs, rc;
+        eval_with_full_reduction_both(x, rs, rc);
+
+        rs              = ms::if_then_else(fin, rs, nan_v);
+        rc              = ms::if_then_else(fin, rc, nan_v);
+
+        ret_s           = rs.convert_to_float();
+        ret_c           = rc.convert_to_float();
+    }
+
     template<int Version>
     force_inline
     static simd_double eval_with_full_reduction(const simd_double& x)
@@ -265,6 +353,21 @@ struct simd_sincos_float<Bits, Tag, true>
         return ret;
     }
 
+    force_inline
+    static void eval_with_full_reduction_both(const simd_double& x, simd_double& ret_s,
+                    simd_double& ret_c)
+    {
+        simd_double xv;
+        simd_int q_lo;
+
+        pi2_reduction_scalar<float, Bits, Tag>::reduction_full(x, xv, q_lo);
+
+        simd_double pc, ps;
+        approximation(xv, pc, ps);
+
+        simd_sincos_reconstruction<double, Bits, Tag>::eval_both(q_lo, pc, ps, ret_s, ret_c);
+    }
+
     force_inline
     static void approximation(const simd_double& xv, simd_double& ret_cos, simd_double& ret_sin)
     {
@@ -324,6 +427,33 @@ struct simd_sincos_float<Bits, Tag, true>
         return ret.convert_to_float();
     };
 
+    force_inline
+    static void eval_sincos_both(const simd_type& x, simd_type& ret_s, simd_type& ret_c)
+    {        
+        // max_q * pi/2
+        const simd_double max_x = simd_double(421657428.26631);
+
+        simd_double xd          = x.convert_to_double();
+
+        simd_double in_range    = gt(max_x, abs(xd));
+        bool in_range_all       = all(in_range);
+
+        if (in_range_all == false)
+            return process_overflow_both(xd, ret_s, ret_c);
+
+        simd_int qi;
+        simd_double xv      = pi2_reduction_scalar<float, Bits, Tag>::reduction_CW3(xd, qi);
+
+        simd_double pc, ps;
+        approximation(xv, pc, ps);
+
+        simd_double rs, rc;
+        simd_sincos_reconstruction<double, Bits, Tag>::eval_both(qi, pc, ps, rs, rc);
+
+        ret_s               = rs.convert_to_float();
+        ret_c               = rc.convert_to_float();
+    };
+
     force_inline
     static simd_type eval_sin(const simd_type& x)
     {
@@ -361,6 +491,22 @@ struct simd_sincos_float<Bits, Tag, true>
             return ret.convert_to_float();
         }
 
+        static void process_overflow_both(const simd_double& x, const simd_double& in_range,
+                        simd_type& ret_s, simd_type& ret_c)
+        {
+            const simd_double nan_v   = simd_double(std::numeric_limits<double>::quiet_NaN());
+
+            simd_double fin = ms::is_finite(x);
+            simd_double rs, rc;
+            eval_with_full_reduction_both(x, in_range, rs, rc);
+
+            rs              = ms::if_then_else(fin, rs, nan_v);
+            rc              = ms::if_then_else(fin, rc, nan_v);
+
+            ret_s           = rs.convert_to_float();
+            ret_c           = rc.convert_to_float();
+        }
+
         template<int Version>
         force_inline
         static simd_double eval_with_full_reduction(const simd_double& x, const simd_double& in_range)
@@ -383,6 +529,27 @@ struct simd_sincos_float<Bits, Tag, true>
             return ret;
         }
 
+        force_inline
+        static void eval_with_full_reduction_both(const simd_double& x, const simd_double& in_range,
+                        simd_double& ret_s, simd_double& ret_c)
+        {
+            bool in_range_any       = any(in_range);
+
+            simd_double xv;
+            simd_int q_lo;
+
+            if (in_range_any == true)
+                xv  = pi2_reduction<float, Bits, Tag>::reduction_CW3(x, q_lo); 
+
+            pi2_reduction<float, Bits, Tag>::reduction_full(x, in_range, xv, q_lo);
+
+            simd_double pc, ps;
+            approximation(xv, pc, ps);
+
+            simd_sincos_reconstruction<double, 256, avx_tag>
+                ::eval_both(q_lo, pc, ps, ret_s, ret_c);
+        }
+
         force_inline
         static void approximation(const simd_double& xv, simd_double& ret_cos, simd_double& ret_sin)
         {
@@ -442,6 +609,33 @@ struct simd_sincos_float<Bits, Tag, true>
             return ret.convert_to_float();
         };
 
+        force_inline
+        static void eval_sincos_both(const simd_type& x, simd_type& ret_s, simd_type& ret_c)
+        {        
+            // max_q * pi/2
+            const simd_double max_x = simd_double(421657428.26631);
+
+            simd_double xd          = x.convert_to_double();
+
+            simd_double in_range    = gt(max_x, abs(xd));
+            bool in_range_all       = all(in_range);
+
+            if (in_range_all == false)
+                return process_overflow_both(xd, in_range, ret_s, ret_c);
+
+            simd_int qi;
+            simd_double xv      = pi2_reduction<float, Bits, Tag>::reduction_CW3(xd, qi);
+
+            simd_double pc, ps;
+            approximation(xv, pc, ps);
+
+            simd_double rs, rc;
+            simd_sincos_reconstruction<double, 256, avx_tag>::eval_both(qi, pc, ps, rs, rc);
+
+            ret_s               = rs.convert_to_float();
+            ret_c               = rc.convert_to_float();
+        };
+
         force_inline
         static simd_type eval_sin(const simd_type& x)
         {
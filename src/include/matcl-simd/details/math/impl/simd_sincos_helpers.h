@@ -94,6 +94,21 @@ struct convert_int32<simd<int32_t, 128, scalar_nosimd_tag>, simd<int64_t, 128, s
     };
 #endif
 
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    template<>
+    struct convert_int32<simd<int32_t, 256, avx_tag>, simd<int64_t, 512, avx512_tag>>
+    {
+        using simd32    = simd<int32_t, 256, avx_tag>;
+        using simd64    = simd<int64_t, 512, avx512_tag>;
+
+        force_inline
+        static simd64 eval(const simd32& x)
+        {
+            return _mm512_cvtepi32_epi64(x.data);
+        }
+    };
+#endif
+
 template<class T>
 struct get_mask_sign{};
 
@@ -235,6 +250,44 @@ struct simd_sincos_reconstruction<Val, Bits, Tag, true>
             return ret;
         };
     }
+
+    force_inline
+    static void eval_both(const simd_int& q, const simd_type& pc, const simd_type& ps,
+                    simd_type& res_s, simd_type& res_c)
+    {
+        const Val cos_table[]   = {1.0, 0.0, -1.0, 0.0};
+        const Val sin_table[]   = {0.0, 1.0, 0.0, -1.0};
+        
+        simd_type coef_cos      = simd_type(cos_table[q.first()]);
+        simd_type coef_sin      = simd_type(sin_table[q.first()]);
+
+        res_s                   = fma_f(coef_sin, pc, coef_cos * ps);
+        res_c                   = fnma_f(coef_sin, ps, coef_cos * pc);
+    }
+};
+
+//-----------------------------------------------------------------------
+//                              CIS
+//-----------------------------------------------------------------------
+template<class Val, int Bits, class Tag>
+struct simd_cis
+{
+    using simd_type         = ms::simd<Val, Bits, Tag>;
+    using compl_type        = ms::simd_compl<Val, Bits, Tag>;
+
+    force_inline
+    static compl_type eval(const simd_type& x)
+    {
+        simd_type s, c;
+        simd_sincos<Val, Bits, Tag>::eval_sincos_both(x, s, c);
+
+        // sub_add(0, 1) = [-1, 1, -1, 1, ...]; select cosine on even positions
+        // (real parts) and sine on odd positions (imaginary parts)
+        const simd_type zero    = simd_type::zero();
+        simd_type odd           = gt(sub_add(zero, simd_type::one()), zero);
+
+        return compl_type(if_then_else(odd, s, c));
+    };
 };
 
 }}}
@@ -74,6 +74,27 @@ ms::exp(const simd<Val, Bits, Simd_tag>& x)
     return details::simd_exp<Val, Bits, Simd_tag>::eval(x);
 };
 
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::exp2(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_exp2<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::exp10(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_exp10<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::expm1(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_expm1<Val, Bits, Simd_tag>::eval(x);
+};
+
 template<class Val, int Bits, class Simd_tag>
 force_inline simd<Val, Bits, Simd_tag> 
 ms::log(const simd<Val, Bits, Simd_tag>& x)
@@ -81,6 +102,55 @@ ms::log(const simd<Val, Bits, Simd_tag>& x)
     return details::simd_log<Val, Bits, Simd_tag>::eval(x);
 };
 
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::log2(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_log2<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::log10(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_log10<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::log1p(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_log1p<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::pow(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_pow<Val, Bits, Simd_tag>::eval(x, y);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::pow(const simd<Val, Bits, Simd_tag>& x, const Val& y)
+{
+    return details::simd_pow<Val, Bits, Simd_tag>::eval(x, simd<Val, Bits, Simd_tag>(y));
+};
+
+template<int Bits, class Simd_tag>
+force_inline simd<double, Bits, Simd_tag> 
+ms::powi(const simd<double, Bits, Simd_tag>& x, const simd<int64_t, Bits, Simd_tag>& n)
+{
+    return details::simd_powi<double, Bits, Simd_tag>::eval(x, n);
+};
+
+template<int Bits, class Simd_tag>
+force_inline simd<float, Bits, Simd_tag> 
+ms::powi(const simd<float, Bits, Simd_tag>& x, const simd<int32_t, Bits, Simd_tag>& n)
+{
+    return details::simd_powi<float, Bits, Simd_tag>::eval(x, n);
+};
+
 template<class Val, int Bits, class Simd_tag>
 force_inline simd<Val, Bits, Simd_tag> 
 ms::sin(const simd<Val, Bits, Simd_tag>& x)
@@ -104,6 +174,22 @@ ms::sincos_simpl(const simd<Val, Bits, Simd_tag>& x,
                 ::eval_sincos_simpl(x, ret_sin, ret_cos);
 };
 
+template<class Val, int Bits, class Simd_tag>
+force_inline void
+ms::sincos(const simd<Val, Bits, Simd_tag>& x, 
+    simd<Val, Bits, Simd_tag>& ret_sin, simd<Val, Bits, Simd_tag>& ret_cos)
+{
+    return details::simd_sincos<Val, Bits, Simd_tag>
+                ::eval_sincos_both(x, ret_sin, ret_cos);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl<Val, Bits, Simd_tag>
+ms::cis(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_cis<Val, Bits, Simd_tag>::eval(x);
+};
+
 template<class Val, int Bits, class Simd_tag>
 force_inline simd<Val, Bits, Simd_tag> 
 ms::tan(const simd<Val, Bits, Simd_tag>& x)
@@ -118,4 +204,207 @@ ms::cot(const simd<Val, Bits, Simd_tag>& x)
     return details::simd_tancot<Val, Bits, Simd_tag>::eval_cot(x);
 };
 
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::atan(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_atan<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::atan2(const simd<Val, Bits, Simd_tag>& y, const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_atan2<Val, Bits, Simd_tag>::eval(y, x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::asin(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_asin<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::acos(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_acos<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::sinh(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_sinh<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::cosh(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_cosh<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::tanh(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_tanh<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::sigmoid(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_sigmoid<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::softplus(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_softplus<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::erf(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_erf<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::erfc(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_erfc<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::normcdf(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_normcdf<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::norminv(const simd<Val, Bits, Simd_tag>& p)
+{
+    return details::simd_norminv<Val, Bits, Simd_tag>::eval(p);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::rcp_approx(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_rcp_approx<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::rcp(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_rcp<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::rsqrt_approx(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_rsqrt_approx<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::rsqrt(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_rsqrt<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::cbrt(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_cbrt<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::lgamma(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_lgamma<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::tgamma(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_tgamma<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::digamma(const simd<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_digamma<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::hypot(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_hypot<Val, Bits, Simd_tag>::eval(x, y);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl<Val, Bits, Simd_tag> 
+ms::exp(const simd_compl<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_compl_exp<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl<Val, Bits, Simd_tag> 
+ms::log(const simd_compl<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_compl_log<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl<Val, Bits, Simd_tag> 
+ms::sqrt(const simd_compl<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_compl_sqrt<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::abs(const simd_compl<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_compl_abs<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd<Val, Bits, Simd_tag> 
+ms::arg(const simd_compl<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_compl_arg<Val, Bits, Simd_tag>::eval(x);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl<Val, Bits, Simd_tag> 
+ms::pow(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y)
+{
+    return details::simd_compl_pow<Val, Bits, Simd_tag>::eval(x, y);
+};
+
+template<class Val, int Bits, class Simd_tag>
+force_inline simd_compl<Val, Bits, Simd_tag> 
+ms::cis(const simd_compl<Val, Bits, Simd_tag>& x)
+{
+    return details::simd_compl_cis<Val, Bits, Simd_tag>::eval(x);
+};
+
 }}
@@ -39,6 +39,72 @@ ms::exp(float x)
     return res.first();
 };
 
+force_inline double
+ms::exp2(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::exp2(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::exp2(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::exp2(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::exp10(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::exp10(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::exp10(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::exp10(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::expm1(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::expm1(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::expm1(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::expm1(xs);
+
+    return res.first();
+};
+
 force_inline double
 ms::log(double x)
 {
@@ -61,6 +127,122 @@ ms::log(float x)
     return res.first();
 };
 
+force_inline double
+ms::log2(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::log2(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::log2(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::log2(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::log10(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::log10(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::log10(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::log10(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::log1p(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::log1p(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::log1p(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::log1p(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::pow(double x, double y)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type ys        = simd_type(y);
+    simd_type res       = ms::pow(xs, ys);
+
+    return res.first();
+};
+
+force_inline float
+ms::pow(float x, float y)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type ys        = simd_type(y);
+    simd_type res       = ms::pow(xs, ys);
+
+    return res.first();
+};
+
+force_inline double
+ms::powi(double x, int n)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+    using simd_int      = default_scalar_simd_type<int64_t>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_int ns         = simd_int(int64_t(n));
+    simd_type res       = ms::powi(xs, ns);
+
+    return res.first();
+};
+
+force_inline float
+ms::powi(float x, int n)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+    using simd_int      = default_scalar_simd_type<int32_t>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_int ns         = simd_int(int32_t(n));
+    simd_type res       = ms::powi(xs, ns);
+
+    return res.first();
+};
+
 force_inline double ms::pow2k(double x)
 {
     // do not use SIMD-based scalars
@@ -199,6 +381,32 @@ ms::cos(float x)
     return res.first();
 };
 
+force_inline void
+ms::sincos(double x, double& ret_sin, double& ret_cos)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res_s, res_c;
+    ms::sincos(xs, res_s, res_c);
+
+    ret_sin             = res_s.first();
+    ret_cos             = res_c.first();
+};
+
+force_inline void
+ms::sincos(float x, float& ret_sin, float& ret_cos)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res_s, res_c;
+    ms::sincos(xs, res_s, res_c);
+
+    ret_sin             = res_s.first();
+    ret_cos             = res_c.first();
+};
+
 force_inline double
 ms::tan(double x)
 {
@@ -243,4 +451,492 @@ ms::cot(float x)
     return res.first();
 };
 
+force_inline double
+ms::atan(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::atan(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::atan(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::atan(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::atan2(double y, double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type ys        = simd_type(y);
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::atan2(ys, xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::atan2(float y, float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type ys        = simd_type(y);
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::atan2(ys, xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::asin(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::asin(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::asin(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::asin(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::acos(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::acos(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::acos(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::acos(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::sinh(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::sinh(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::sinh(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::sinh(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::cosh(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::cosh(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::cosh(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::cosh(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::tanh(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::tanh(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::tanh(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::tanh(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::sigmoid(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::sigmoid(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::sigmoid(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::sigmoid(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::softplus(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::softplus(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::softplus(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::softplus(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::erf(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::erf(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::erf(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::erf(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::erfc(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::erfc(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::erfc(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::erfc(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::normcdf(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::normcdf(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::normcdf(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::normcdf(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::norminv(double p)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type ps        = simd_type(p);
+    simd_type res       = ms::norminv(ps);
+
+    return res.first();
+};
+
+force_inline float
+ms::norminv(float p)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type ps        = simd_type(p);
+    simd_type res       = ms::norminv(ps);
+
+    return res.first();
+};
+
+force_inline double
+ms::rcp_approx(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rcp_approx(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::rcp_approx(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rcp_approx(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::rcp(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rcp(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::rcp(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rcp(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::rsqrt_approx(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rsqrt_approx(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::rsqrt_approx(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rsqrt_approx(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::rsqrt(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rsqrt(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::rsqrt(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::rsqrt(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::cbrt(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::cbrt(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::cbrt(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::cbrt(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::hypot(double x, double y)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type ys        = simd_type(y);
+    simd_type res       = ms::hypot(xs, ys);
+
+    return res.first();
+};
+
+force_inline float
+ms::hypot(float x, float y)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type ys        = simd_type(y);
+    simd_type res       = ms::hypot(xs, ys);
+
+    return res.first();
+};
+
+force_inline double
+ms::lgamma(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::lgamma(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::lgamma(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::lgamma(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::tgamma(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::tgamma(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::tgamma(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::tgamma(xs);
+
+    return res.first();
+};
+
+force_inline double
+ms::digamma(double x)
+{
+    using simd_type     = default_scalar_simd_type<double>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::digamma(xs);
+
+    return res.first();
+};
+
+force_inline float
+ms::digamma(float x)
+{
+    using simd_type     = default_scalar_simd_type<float>::type;
+
+    simd_type xs        = simd_type(x);
+    simd_type res       = ms::digamma(xs);
+
+    return res.first();
+};
+
 }}
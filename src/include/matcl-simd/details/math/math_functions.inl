@@ -22,3 +22,7 @@
 #if MATCL_ARCHITECTURE_HAS_AVX
     #include "matcl-simd/details/arch/avx/math/math_impl.h"
 #endif
+
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    #include "matcl-simd/details/arch/avx512/math/math_impl.h"
+#endif
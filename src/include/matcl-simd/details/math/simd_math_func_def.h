@@ -22,6 +22,27 @@ struct simd_exp
                 "function exp not defined for for given arguments");
 };
 
+template<class Val, int Bits, class Simd_tag>
+struct simd_exp2
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function exp2 not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_exp10
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function exp10 not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_expm1
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function expm1 not defined for for given arguments");
+};
+
 template<class Val, int Bits, class Simd_tag>
 struct simd_log
 {
@@ -29,6 +50,41 @@ struct simd_log
                 "function log not defined for for given arguments");
 };
 
+template<class Val, int Bits, class Simd_tag>
+struct simd_log2
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function log2 not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_log10
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function log10 not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_log1p
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function log1p not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_pow
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function pow not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_powi
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function powi not defined for for given arguments");
+};
+
 template<class Val, int Bits, class Simd_tag>
 struct simd_sincos
 {
@@ -43,6 +99,209 @@ struct simd_tancot
                 "function tan/cot not defined for for given arguments");
 };
 
+template<class Val, int Bits, class Simd_tag>
+struct simd_atan
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function atan not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_atan2
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function atan2 not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_asin
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function asin not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_acos
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function acos not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_sinh
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function sinh not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_cosh
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function cosh not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_tanh
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function tanh not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_sigmoid
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function sigmoid not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_softplus
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function softplus not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_erf
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function erf not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_erfc
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function erfc not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_normcdf
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function normcdf not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_norminv
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function norminv not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_rcp_approx
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function rcp_approx not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_rcp
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function rcp not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_rsqrt_approx
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function rsqrt_approx not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_rsqrt
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function rsqrt not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_cbrt
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function cbrt not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_hypot
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function hypot not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_lgamma
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function lgamma not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_tgamma
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function tgamma not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_digamma
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function digamma not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_exp
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function exp not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_log
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function log not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_sqrt
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function sqrt not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_abs
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function abs not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_arg
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function arg not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_pow
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function pow not defined for for given arguments");
+};
+
+template<class Val, int Bits, class Simd_tag>
+struct simd_compl_cis
+{
+    static_assert(md::dependent_false<Simd_tag>::value, 
+                "function cis not defined for for given arguments");
+};
+
 template<class Val, int Bits, class Simd_tag>
 struct simd_pow2k
 {
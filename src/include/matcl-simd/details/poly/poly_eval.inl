@@ -10,3 +10,7 @@
 
 #include "matcl-simd/details/poly/poly_eval_estrin.inl"
 #include "matcl-simd/details/poly/poly_eval_horner.inl"
+#include "matcl-simd/details/poly/poly_eval_chebyshev.inl"
+#include "matcl-simd/details/poly/poly_eval_rational.inl"
+#include "matcl-simd/details/poly/poly_eval_multi.inl"
+#include "matcl-simd/details/poly/poly_eval_const.inl"
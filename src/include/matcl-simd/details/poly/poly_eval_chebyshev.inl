@@ -0,0 +1,468 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/details/poly/utils.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                   CLENSHAW
+//-----------------------------------------------------------------------
+// Clenshaw's recurrence with Poly_size coefficients; eval_step processes
+// the coefficient Poly_size and all coefficients with lower index except c_0
+template<int Poly_size, class Arg>
+struct eval_clenshaw
+{
+    template<class Coefs>
+    force_inline
+    static void eval_step(const Arg& x2, const Coefs& coef, Arg& b1, Arg& b2)
+    {
+        Arg b0  = fma(x2, b1, coef(Poly_size) - b2);
+        b2      = b1;
+        b1      = b0;
+
+        eval_clenshaw<Poly_size - 1, Arg>::eval_step(x2, coef, b1, b2);
+    };
+
+    template<class Coefs>
+    force_inline
+    static Arg eval(const Arg& x, const Coefs& coef)
+    {
+        Arg x2  = x + x;
+        Arg b1  = coef(Poly_size - 1);
+        Arg b2  = Arg(0.0);
+
+        eval_clenshaw<Poly_size - 2, Arg>::eval_step(x2, coef, b1, b2);
+
+        return fma(x, b1, coef(0) - b2);
+    };
+};
+
+template<class Arg>
+struct eval_clenshaw<1, Arg>
+{
+    template<class Coefs>
+    force_inline
+    static void eval_step(const Arg& x2, const Coefs& coef, Arg& b1, Arg& b2)
+    {
+        Arg b0  = fma(x2, b1, coef(1) - b2);
+        b2      = b1;
+        b1      = b0;
+    };
+
+    template<class Coefs>
+    force_inline
+    static Arg eval(const Arg& x, const Coefs& coef)
+    {
+        (void)x;
+        return coef(0);
+    };
+};
+
+template<class Arg>
+struct eval_clenshaw<0, Arg>
+{
+    template<class Coefs>
+    force_inline
+    static void eval_step(const Arg& x2, const Coefs& coef, Arg& b1, Arg& b2)
+    {
+        (void)x2;
+        (void)coef;
+        (void)b1;
+        (void)b2;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CLENSHAW DYNAMIC
+//-----------------------------------------------------------------------
+template<class Arg>
+struct eval_clenshaw2
+{
+    template<class Coefs>
+    force_inline
+    static Arg eval(const Arg& x, int size, const Coefs& coef)
+    {
+        if (size == 1)
+            return coef(0);
+
+        Arg x2  = x + x;
+        Arg b1  = coef(size - 1);
+        Arg b2  = Arg(0.0);
+
+        for (int i = size - 2; i >= 1; --i)
+        {
+            Arg b0  = fma(x2, b1, coef(i) - b2);
+            b2      = b1;
+            b1      = b0;
+        };
+
+        return fma(x, b1, coef(0) - b2);
+    };
+
+    // rounding error introduced at step k is propagated to the result with
+    // factor T_k(x), |T_k(x)| <= 1 for |x| <= 1; rounding errors of c_k - b_{k+2}
+    // and of the fma operation are bounded by u * |t_k| and u * |b_k|; on exit
+    // mu = sum_k (|t_k| + |b_k|)
+    template<class Coefs>
+    force_inline
+    static Arg eval_error(const Arg& x, int size, const Coefs& coef, Arg& mu)
+    {
+        if (size == 1)
+        {
+            mu      = Arg(0.0);
+            return coef(0);
+        };
+
+        Arg x2  = x + x;
+        Arg b1  = coef(size - 1);
+        Arg b2  = Arg(0.0);
+        mu      = Arg(0.0);
+
+        for (int i = size - 2; i >= 1; --i)
+        {
+            Arg t   = coef(i) - b2;
+            Arg b0  = fma(x2, b1, t);
+
+            mu      = mu + (eval_abs<Arg>::eval(t) + eval_abs<Arg>::eval(b0));
+            b2      = b1;
+            b1      = b0;
+        };
+
+        Arg t       = coef(0) - b2;
+        Arg res     = fma(x, b1, t);
+        mu          = mu + (eval_abs<Arg>::eval(t) + eval_abs<Arg>::eval(res));
+
+        return res;
+    };
+};
+
+template<class Arg_type, class Coef_type>
+struct eval_clenshaw_post_cond
+{
+    using coefs_type    = poly_coef_broadcast<Arg_type, Coef_type>;
+
+    force_inline
+    static Arg_type eval(const Arg_type& x, int size, const Coef_type* coef, Arg_type& error)
+    {
+        Arg_type mu;
+        Arg_type res    = eval_clenshaw2<Arg_type>::eval_error(x, size, coefs_type(coef), mu);
+
+        const Arg_type eps  = eval_eps<Arg_type>::eval();
+        const Arg_type u    = Arg_type(0.5) * eps;
+        const Arg_type one  = Arg_type(1.0);
+        Arg_type N1         = Arg_type(float(size + 1));
+
+        error           = (mu * u) / (one - N1 * eps);
+        return res;
+    };
+
+    force_inline
+    static Arg_type eval_cond(const Arg_type& x, int size, const Coef_type* coef,
+                              Arg_type& val, Arg_type& error)
+    {
+        val             = eval(x, size, coef, error);
+
+        const Arg_type u    = Arg_type(0.5) * eval_eps<Arg_type>::eval();
+        Arg_type abs_val    = eval_abs<Arg_type>::eval(val);
+
+        // take lower bound for |f(x)| based on |f_ap(x)| and error
+        Arg_type cond   = (error / u) / (abs_val - error);
+        return cond;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CHEBYSHEV ESTRIN
+//-----------------------------------------------------------------------
+// the largest power of 2 less than size, size > 1
+constexpr int eval_chebyshev_split(int size)
+{
+    return (size <= 2) ? 1 : 2 * eval_chebyshev_split((size + 1) / 2);
+};
+
+// coefficients of L in f = L + 2 * T_m * H; from T_{m+j} = 2 * T_m * T_j - T_{m-j}
+// we obtain l_i = c_i - c_{2m-i}, 0 < i < m; size of L is m
+template<class Arg, class Coefs>
+struct chebyshev_coef_low
+{
+    Coefs   m_coef;
+    int     m_split;
+    int     m_size;
+
+    force_inline
+    chebyshev_coef_low(const Coefs& coef, int split, int size)
+        :m_coef(coef), m_split(split), m_size(size)
+    {};
+
+    force_inline
+    Arg operator()(int i) const
+    {
+        int j   = 2 * m_split - i;
+        Arg c   = m_coef(i);
+
+        if (j < m_size)
+            c   = c - m_coef(j);
+
+        return c;
+    };
+};
+
+// coefficients of H in f = L + 2 * T_m * H; h_0 = c_m / 2, h_j = c_{m+j}; size
+// of H is size - m
+template<class Arg, class Coefs>
+struct chebyshev_coef_high
+{
+    Coefs   m_coef;
+    int     m_split;
+
+    force_inline
+    chebyshev_coef_high(const Coefs& coef, int split)
+        :m_coef(coef), m_split(split)
+    {};
+
+    force_inline
+    Arg operator()(int i) const
+    {
+        Arg c   = m_coef(m_split + i);
+
+        if (i == 0)
+            c   = c * Arg(0.5);
+
+        return c;
+    };
+};
+
+// evaluate 2 * T_{2^k}(x) for k = 0, ..., num - 1
+template<class Arg>
+force_inline
+void eval_chebyshev_pow2(const Arg& x, int num, Arg* tpow2)
+{
+    const Arg one   = Arg(1.0);
+    Arg t           = x;
+    tpow2[0]        = t + t;
+
+    for (int k = 1; k < num; ++k)
+    {
+        // T_2k = 2 * T_k^2 - 1
+        t           = fma(tpow2[k - 1], t, -one);
+        tpow2[k]    = t + t;
+    };
+};
+
+template<int Poly_size, int Depth, class Arg,
+        bool Split = (Depth > 0 && Poly_size > 4)>
+struct eval_chebyshev_estrin
+{
+    template<class Coefs>
+    force_inline
+    static Arg eval(const Arg& x, const Arg* tpow2, const Coefs& coef)
+    {
+        (void)tpow2;
+        return eval_clenshaw<Poly_size, Arg>::eval(x, coef);
+    };
+};
+
+template<int Poly_size, int Depth, class Arg>
+struct eval_chebyshev_estrin<Poly_size, Depth, Arg, true>
+{
+    static const int split      = eval_chebyshev_split(Poly_size);
+    static const int level      = eval_log2(split);
+    static const int size_low   = split;
+    static const int size_high  = Poly_size - split;
+
+    template<class Coefs>
+    force_inline
+    static Arg eval(const Arg& x, const Arg* tpow2, const Coefs& coef)
+    {
+        using coef_low  = chebyshev_coef_low<Arg, Coefs>;
+        using coef_high = chebyshev_coef_high<Arg, Coefs>;
+
+        Arg L   = eval_chebyshev_estrin<size_low, Depth - 1, Arg>
+                    ::eval(x, tpow2, coef_low(coef, split, Poly_size));
+        Arg H   = eval_chebyshev_estrin<size_high, Depth - 1, Arg>
+                    ::eval(x, tpow2, coef_high(coef, split));
+
+        return fma(H, tpow2[level], L);
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   CHEBYSHEV ESTRIN DYNAMIC
+//-----------------------------------------------------------------------
+template<int Depth, class Arg>
+struct eval_chebyshev_estrin2
+{
+    template<class Coefs>
+    static Arg eval(const Arg& x, const Arg* tpow2, int size, const Coefs& coef)
+    {
+        using coef_low  = chebyshev_coef_low<Arg, Coefs>;
+        using coef_high = chebyshev_coef_high<Arg, Coefs>;
+
+        if (size <= 4)
+            return eval_clenshaw2<Arg>::eval(x, size, coef);
+
+        int split   = 1;
+        int level   = 0;
+
+        while (2 * split < size)
+        {
+            split   = 2 * split;
+            level   += 1;
+        };
+
+        Arg L   = eval_chebyshev_estrin2<Depth - 1, Arg>
+                    ::eval(x, tpow2, split, coef_low(coef, split, size));
+        Arg H   = eval_chebyshev_estrin2<Depth - 1, Arg>
+                    ::eval(x, tpow2, size - split, coef_high(coef, split));
+
+        return fma(H, tpow2[level], L);
+    };
+};
+
+template<class Arg>
+struct eval_chebyshev_estrin2<0, Arg>
+{
+    template<class Coefs>
+    force_inline
+    static Arg eval(const Arg& x, const Arg* tpow2, int size, const Coefs& coef)
+    {
+        (void)tpow2;
+        return eval_clenshaw2<Arg>::eval(x, size, coef);
+    };
+};
+
+template<class Arg, class Coef>
+struct eval_chebyshev_estrin_dyn
+{
+    // maximum number of recursive splits
+    static const int max_depth          = 3;
+
+    // clenshaw is used for smaller series
+    static const int clenshaw_threshold = 10;
+
+    static const int max_pow            = 32;
+
+    static Arg eval(const Arg& x, int size, const Coef* poly)
+    {
+        using coefs_type    = poly_coef_broadcast<Arg, Coef>;
+
+        if (size < clenshaw_threshold)
+            return eval_clenshaw2<Arg>::eval(x, size, coefs_type(poly));
+
+        int num     = 1;
+        int split   = 1;
+
+        while (2 * split < size)
+        {
+            split   = 2 * split;
+            num     += 1;
+        };
+
+        Arg tpow2[max_pow];
+        eval_chebyshev_pow2(x, num, tpow2);
+
+        return eval_chebyshev_estrin2<max_depth, Arg>::eval(x, tpow2, size, coefs_type(poly));
+    };
+};
+
+}}}
+
+namespace matcl
+{
+
+template<int N, class Arg_type, class Coef_type>
+force_inline
+Arg_type simd::clenshaw(const Arg_type& x, const Coef_type* coef)
+{
+    using coefs_type    = details::poly_coef_broadcast<Arg_type, Coef_type>;
+    return details::eval_clenshaw<N, Arg_type>::eval(x, coefs_type(coef));
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::clenshaw(const Arg_type& x, int N, const Coef_type* coef)
+{
+    using coefs_type    = details::poly_coef_broadcast<Arg_type, Coef_type>;
+    return details::eval_clenshaw2<Arg_type>::eval(x, N, coefs_type(coef));
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::clenshaw_and_error(const Arg_type& x, int N, const Coef_type* coef,
+                Arg_type& error)
+{
+    return details::eval_clenshaw_post_cond<Arg_type, Coef_type>::eval(x, N, coef, error);
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::clenshaw_apriori_cond(const Arg_type& x, int N, const Coef_type* coef)
+{
+    Arg_type val;
+    Arg_type abs_val;
+
+    return clenshaw_apriori_cond(x, N, coef, val, abs_val);
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::clenshaw_apriori_cond(const Arg_type& x, int N, const Coef_type* coef,
+                Arg_type& val, Arg_type& abs_val)
+{
+    abs_val         = Arg_type(0.0);
+
+    for (int i = 0; i < N; ++i)
+        abs_val     = abs_val + details::eval_abs<Arg_type>::eval(
+                                    details::broadcast<Arg_type>::eval(coef[i]));
+
+    val             = clenshaw(x, N, coef);
+    Arg_type aval   = details::eval_abs<Arg_type>::eval(val);
+
+    return abs_val / aval;
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::clenshaw_aposteriori_cond(const Arg_type& x, int N, const Coef_type* coef)
+{
+    Arg_type val, err;
+    return clenshaw_aposteriori_cond(x, N, coef, val, err);
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::clenshaw_aposteriori_cond(const Arg_type& x, int N, const Coef_type* coef,
+                Arg_type& val, Arg_type& err)
+{
+    return details::eval_clenshaw_post_cond<Arg_type, Coef_type>
+                ::eval_cond(x, N, coef, val, err);
+};
+
+template<int N, class Arg_type, class Coef_type>
+force_inline
+Arg_type simd::chebyshev_estrin(const Arg_type& x, const Coef_type* coef)
+{
+    using coefs_type    = details::poly_coef_broadcast<Arg_type, Coef_type>;
+
+    static const int depth  = 3;
+    static const int num    = (N > 1) ? details::eval_log2(details::eval_chebyshev_split(N)) + 1
+                                      : 1;
+
+    Arg_type tpow2[num];
+    details::eval_chebyshev_pow2(x, num, tpow2);
+
+    return details::eval_chebyshev_estrin<N, depth, Arg_type>
+                ::eval(x, tpow2, coefs_type(coef));
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::chebyshev_estrin(const Arg_type& x, int N, const Coef_type* coef)
+{
+    return details::eval_chebyshev_estrin_dyn<Arg_type, Coef_type>::eval(x, N, coef);
+};
+
+}
@@ -0,0 +1,189 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/details/poly/utils.h"
+#include "matcl-simd/details/poly/poly_eval_estrin.inl"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                   COEFFICIENT LIST
+//-----------------------------------------------------------------------
+template<double ... Coef>
+struct poly_coef_list
+{
+    static const int size   = sizeof...(Coef);
+
+    static constexpr double
+    value[sizeof...(Coef)]  = {Coef...};
+};
+
+// coefficient Pos of the list List converted to Arg; the coefficient is
+// a constant expression, therefore no load from a coefficient table is
+// required
+template<class Arg, class List, int Pos>
+struct poly_coef_const
+{
+    static constexpr double
+    value                   = List::value[Pos];
+
+    force_inline
+    static Arg eval()
+    {
+        return broadcast<Arg>::eval(value);
+    }
+};
+
+//-----------------------------------------------------------------------
+//                   HORNER CONST
+//-----------------------------------------------------------------------
+// evaluate the polynomial with coefficients List[First, First + Size)
+template<class List, int First, int Size, class Arg>
+struct eval_horner_const
+{
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        Arg res = eval_horner_const<List, First + 1, Size - 1, Arg>::eval(x);
+        return fma(res, x, poly_coef_const<Arg, List, First>::eval());
+    }
+};
+
+template<class List, int First, class Arg>
+struct eval_horner_const<List, First, 1, Arg>
+{
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        (void)x;
+        return poly_coef_const<Arg, List, First>::eval();
+    }
+};
+
+//-----------------------------------------------------------------------
+//                   ESTRIN CONST
+//-----------------------------------------------------------------------
+// evaluate the polynomial with coefficients List[First, First + Size);
+// splitting is the same as in eval_estrin
+template<class List, int First, int Size, class Arg>
+struct eval_estrin_const
+{
+    static const int log2       = eval_log2(Size);
+    static const int max_pow    = get_estrin_max_size<Size, log2>::max_pow;
+    static const int size1      = get_estrin_max_size<Size, log2>::size;
+    static const int size2      = Size - size1;
+
+    static_assert(size2 > 0, "invalid size");
+
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        Arg xpow[max_pow];
+        xpow[0] = x;
+
+        for (int i = 1; i < max_pow; ++i)
+            xpow[i] = xpow[i-1] * xpow[i-1];
+
+        return eval_rec(xpow);
+    }
+
+    // xpow[k] = x^(2^k)
+    force_inline
+    static Arg eval_rec(const Arg* xpow)
+    {
+        Arg lo  = eval_estrin_const<List, First, size1, Arg>::eval_rec(xpow);
+        Arg hi  = eval_estrin_const<List, First + size1, size2, Arg>::eval_rec(xpow);
+
+        return fma(hi, xpow[max_pow-1], lo);
+    }
+};
+
+template<class List, int First, class Arg>
+struct eval_estrin_const<List, First, 1, Arg>
+{
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        (void)x;
+        return poly_coef_const<Arg, List, First>::eval();
+    }
+
+    force_inline
+    static Arg eval_rec(const Arg* xpow)
+    {
+        (void)xpow;
+        return poly_coef_const<Arg, List, First>::eval();
+    }
+};
+
+//-----------------------------------------------------------------------
+//                   POLY CONST
+//-----------------------------------------------------------------------
+// the Horner's scheme requires N - 1 dependent FMA, the Estrin's scheme
+// ceil(log2(N)) dependent FMA and squares computed in parallel; for N <= 5
+// the latency is not reduced, but more instructions are executed
+template<class List, class Arg, bool Use_estrin = (List::size > 5)>
+struct eval_poly_const
+{
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        return eval_estrin_const<List, 0, List::size, Arg>::eval(x);
+    }
+};
+
+template<class List, class Arg>
+struct eval_poly_const<List, Arg, false>
+{
+    force_inline
+    static Arg eval(const Arg& x)
+    {
+        return eval_horner_const<List, 0, List::size, Arg>::eval(x);
+    }
+};
+
+}}}
+
+namespace matcl
+{
+
+template<double ... Coef, class Arg_type>
+force_inline
+Arg_type simd::horner_c(const Arg_type& x)
+{
+    static_assert(sizeof...(Coef) > 0, "invalid size");
+
+    using list  = details::poly_coef_list<Coef...>;
+    return details::eval_horner_const<list, 0, list::size, Arg_type>::eval(x);
+};
+
+template<double ... Coef, class Arg_type>
+force_inline
+Arg_type simd::estrin_c(const Arg_type& x)
+{
+    static_assert(sizeof...(Coef) > 0, "invalid size");
+
+    using list  = details::poly_coef_list<Coef...>;
+    return details::eval_estrin_const<list, 0, list::size, Arg_type>::eval(x);
+};
+
+template<double ... Coef, class Arg_type>
+force_inline
+Arg_type simd::poly_c(const Arg_type& x)
+{
+    static_assert(sizeof...(Coef) > 0, "invalid size");
+
+    using list  = details::poly_coef_list<Coef...>;
+    return details::eval_poly_const<list, Arg_type>::eval(x);
+};
+
+}
@@ -0,0 +1,229 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/details/poly/utils.h"
+#include "matcl-simd/details/poly/poly_eval_estrin.inl"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                   COEFFICIENT ACCESS
+//-----------------------------------------------------------------------
+// access to the coefficient i of the polynomial k; K different polynomials
+template<class Coef>
+struct poly_multi_access
+{
+    const Coef* const*  m_poly;
+
+    force_inline
+    poly_multi_access(const Coef* const* poly)
+        :m_poly(poly)
+    {};
+
+    force_inline
+    const Coef& operator()(int k, int i) const
+    {
+        return m_poly[k][i];
+    };
+};
+
+// access to the coefficient i of the polynomial k; the same polynomial
+// for all k
+template<class Coef>
+struct poly_single_access
+{
+    const Coef*         m_poly;
+
+    force_inline
+    poly_single_access(const Coef* poly)
+        :m_poly(poly)
+    {};
+
+    force_inline
+    const Coef& operator()(int k, int i) const
+    {
+        (void)k;
+        return m_poly[i];
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   HORNER MULTI
+//-----------------------------------------------------------------------
+// evaluate K polynomials at points x[k]; in each step of the Horner's scheme
+// all K dependency chains are updated
+template<int Pos, int K, class Arg, class Access>
+struct eval_horner_multi
+{
+    force_inline
+    static void eval_step(const Arg* x, const Access& poly, Arg* res)
+    {
+        for (int k = 0; k < K; ++k)
+            res[k]  = fma(res[k], x[k], broadcast<Arg>::eval(poly(k, Pos)));
+
+        eval_horner_multi<Pos - 1, K, Arg, Access>::eval_step(x, poly, res);
+    };
+};
+
+template<int K, class Arg, class Access>
+struct eval_horner_multi<-1, K, Arg, Access>
+{
+    force_inline
+    static void eval_step(const Arg* x, const Access& poly, Arg* res)
+    {
+        (void)x;
+        (void)poly;
+        (void)res;
+    };
+};
+
+template<int N, int K, class Arg, class Access>
+force_inline
+void eval_horner_multi_poly(const Arg* x, const Access& poly, Arg* res)
+{
+    for (int k = 0; k < K; ++k)
+        res[k]      = broadcast<Arg>::eval(poly(k, N - 1));
+
+    eval_horner_multi<N - 2, K, Arg, Access>::eval_step(x, poly, res);
+};
+
+//-----------------------------------------------------------------------
+//                   ESTRIN MULTI
+//-----------------------------------------------------------------------
+// evaluate K polynomials with coefficients [First, First + Size) at points
+// x[k]; splitting is the same as in eval_estrin for N <= 16, parts with at
+// most 3 coefficients are evaluated using the Horner's scheme; all parts at
+// given level are evaluated for all K polynomials before the next level
+template<int First, int Size, int K, class Arg, class Access, 
+        bool Is_leaf = (Size <= 3)>
+struct eval_estrin_multi
+{
+    // the last part should not be a single coefficient (as in eval_estrin
+    // for sizes 5 and 9)
+    static const int log2       = eval_log2(Size);
+    static const int size0      = get_estrin_max_size<Size, log2>::size;
+    static const int size1      = (Size - size0 == 1) ? size0 / 2 : size0;
+    static const int size2      = Size - size1;
+    static const int max_pow    = eval_log2(size1) + 1;
+
+    static_assert(size2 > 0, "invalid size");
+
+    force_inline
+    static void eval(const Arg* x, const Access& poly, Arg* res)
+    {
+        // xpow[i * K + k] = x[k]^(2^i)
+        Arg xpow[max_pow * K];
+
+        for (int k = 0; k < K; ++k)
+            xpow[k] = x[k];
+
+        for (int i = 1; i < max_pow; ++i)
+        {
+            for (int k = 0; k < K; ++k)
+                xpow[i * K + k] = xpow[(i - 1) * K + k] * xpow[(i - 1) * K + k];
+        };
+
+        eval_rec(xpow, poly, res);
+    };
+
+    force_inline
+    static void eval_rec(const Arg* xpow, const Access& poly, Arg* res)
+    {
+        Arg hi[K];
+
+        eval_estrin_multi<First, size1, K, Arg, Access>::eval_rec(xpow, poly, res);
+        eval_estrin_multi<First + size1, size2, K, Arg, Access>::eval_rec(xpow, poly, hi);
+
+        for (int k = 0; k < K; ++k)
+            res[k]  = fma(hi[k], xpow[(max_pow - 1) * K + k], res[k]);
+    };
+};
+
+template<int First, int Size, int K, class Arg, class Access>
+struct eval_estrin_multi<First, Size, K, Arg, Access, true>
+{
+    force_inline
+    static void eval(const Arg* x, const Access& poly, Arg* res)
+    {
+        eval_rec(x, poly, res);
+    };
+
+    force_inline
+    static void eval_rec(const Arg* xpow, const Access& poly, Arg* res)
+    {
+        for (int k = 0; k < K; ++k)
+            res[k]  = broadcast<Arg>::eval(poly(k, First + Size - 1));
+
+        for (int i = Size - 2; i >= 0; --i)
+        {
+            for (int k = 0; k < K; ++k)
+                res[k]  = fma(res[k], xpow[k], broadcast<Arg>::eval(poly(k, First + i)));
+        };
+    };
+};
+
+}}}
+
+namespace matcl
+{
+
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void simd::horner_multi_poly(const Arg_type& x, const Coef_type* const* poly, Arg_type* res)
+{
+    static_assert(N > 0 && K > 0, "invalid size");
+
+    using access    = details::poly_multi_access<Coef_type>;
+
+    Arg_type xk[K];
+    for (int k = 0; k < K; ++k)
+        xk[k]       = x;
+
+    details::eval_horner_multi_poly<N, K, Arg_type, access>(xk, access(poly), res);
+};
+
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void simd::horner_multi_arg(const Arg_type* x, const Coef_type* poly, Arg_type* res)
+{
+    static_assert(N > 0 && K > 0, "invalid size");
+
+    using access    = details::poly_single_access<Coef_type>;
+    details::eval_horner_multi_poly<N, K, Arg_type, access>(x, access(poly), res);
+};
+
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void simd::estrin_multi_poly(const Arg_type& x, const Coef_type* const* poly, Arg_type* res)
+{
+    static_assert(N > 0 && K > 0, "invalid size");
+
+    using access    = details::poly_multi_access<Coef_type>;
+
+    Arg_type xk[K];
+    for (int k = 0; k < K; ++k)
+        xk[k]       = x;
+
+    details::eval_estrin_multi<0, N, K, Arg_type, access>::eval(xk, access(poly), res);
+};
+
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void simd::estrin_multi_arg(const Arg_type* x, const Coef_type* poly, Arg_type* res)
+{
+    static_assert(N > 0 && K > 0, "invalid size");
+
+    using access    = details::poly_single_access<Coef_type>;
+    details::eval_estrin_multi<0, N, K, Arg_type, access>::eval(x, access(poly), res);
+};
+
+}
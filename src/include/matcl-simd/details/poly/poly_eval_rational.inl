@@ -0,0 +1,164 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/details/poly/utils.h"
+#include "matcl-simd/details/poly/poly_eval_horner.inl"
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-----------------------------------------------------------------------
+//                   RATIONAL
+//-----------------------------------------------------------------------
+template<bool Active>
+struct eval_horner_update
+{
+    template<class Arg, class Coef>
+    force_inline
+    static void eval(const Arg& x, const Coef& c, Arg& res)
+    {
+        res = fma(res, x, broadcast<Arg>::eval(c));
+    };
+};
+
+template<>
+struct eval_horner_update<false>
+{
+    template<class Arg, class Coef>
+    force_inline
+    static void eval(const Arg& x, const Coef& c, Arg& res)
+    {
+        (void)x;
+        (void)c;
+        (void)res;
+    };
+};
+
+// one step of Horner's scheme for numerator and denominator; the step Pos
+// adds the coefficient a_Pos (if Pos < N - 1) and the coefficient b_Pos
+// (if Pos < M - 1); polynomials are aligned at the lowest coefficient
+template<int Pos, int N, int M, class Arg, class Coef>
+struct eval_rational
+{
+    force_inline
+    static void eval_step(const Arg& x, const Coef* p, const Coef* q, Arg& P, Arg& Q)
+    {
+        eval_horner_update<(Pos < N - 1)>::eval(x, p[Pos < N - 1 ? Pos : 0], P);
+        eval_horner_update<(Pos < M - 1)>::eval(x, q[Pos < M - 1 ? Pos : 0], Q);
+
+        eval_rational<Pos - 1, N, M, Arg, Coef>::eval_step(x, p, q, P, Q);
+    };
+};
+
+template<int N, int M, class Arg, class Coef>
+struct eval_rational<-1, N, M, Arg, Coef>
+{
+    force_inline
+    static void eval_step(const Arg& x, const Coef* p, const Coef* q, Arg& P, Arg& Q)
+    {
+        (void)x;
+        (void)p;
+        (void)q;
+        (void)P;
+        (void)Q;
+    };
+};
+
+//-----------------------------------------------------------------------
+//                   RATIONAL DYNAMIC
+//-----------------------------------------------------------------------
+template<class Arg, class Coef>
+struct eval_rational2
+{
+    force_inline
+    static Arg eval(const Arg& x, int N, const Coef* p, int M, const Coef* q)
+    {
+        Arg P   = broadcast<Arg>::eval(p[N - 1]);
+        Arg Q   = broadcast<Arg>::eval(q[M - 1]);
+
+        int i   = (N > M ? N : M) - 2;
+
+        // leading part of the longer polynomial
+        for (; i >= N - 1 && i >= 0; --i)
+            Q   = fma(Q, x, broadcast<Arg>::eval(q[i]));
+
+        for (; i >= M - 1 && i >= 0; --i)
+            P   = fma(P, x, broadcast<Arg>::eval(p[i]));
+
+        // common part; independent dependency chains
+        for (; i >= 0; --i)
+        {
+            P   = fma(P, x, broadcast<Arg>::eval(p[i]));
+            Q   = fma(Q, x, broadcast<Arg>::eval(q[i]));
+        };
+
+        return P / Q;
+    };
+
+    force_inline
+    static Arg eval_error(const Arg& x, int N, const Coef* p, int M, const Coef* q,
+                          Arg& error)
+    {
+        Arg err_p, err_q;
+
+        Arg P   = horner_and_error(x, N, p, err_p);
+        Arg Q   = horner_and_error(x, M, q, err_q);
+        Arg res = P / Q;
+
+        const Arg u     = Arg(0.5) * eval_eps<Arg>::eval();
+        Arg abs_res     = eval_abs<Arg>::eval(res);
+        Arg abs_Q       = eval_abs<Arg>::eval(Q);
+
+        // |R - P_ap/Q_ap| <= (err_p + |P_ap/Q_ap| * err_q) / |Q|, |Q| >= |Q_ap| - err_q
+        // and res = fl(P_ap/Q_ap)
+        error           = fma(abs_res, err_q, err_p) / (abs_Q - err_q);
+        error           = fma(u, abs_res, error);
+
+        return res;
+    };
+};
+
+}}}
+
+namespace matcl
+{
+
+template<int N, int M, class Arg_type, class Coef_type>
+force_inline
+Arg_type simd::rational(const Arg_type& x, const Coef_type* p, const Coef_type* q)
+{
+    static_assert(N > 0 && M > 0, "invalid size");
+
+    static const int size   = (N > M) ? N : M;
+
+    Arg_type P  = details::broadcast<Arg_type>::eval(p[N - 1]);
+    Arg_type Q  = details::broadcast<Arg_type>::eval(q[M - 1]);
+
+    details::eval_rational<size - 2, N, M, Arg_type, Coef_type>::eval_step(x, p, q, P, Q);
+
+    return P / Q;
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::rational(const Arg_type& x, int N, const Coef_type* p, int M,
+                const Coef_type* q)
+{
+    return details::eval_rational2<Arg_type, Coef_type>::eval(x, N, p, M, q);
+};
+
+template<class Arg_type, class Coef_type>
+Arg_type simd::rational_and_error(const Arg_type& x, int N, const Coef_type* p, int M,
+                const Coef_type* q, Arg_type& error)
+{
+    return details::eval_rational2<Arg_type, Coef_type>::eval_error(x, N, p, M, q, error);
+};
+
+}
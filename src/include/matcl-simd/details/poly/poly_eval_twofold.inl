@@ -194,6 +194,340 @@ struct eval_horner2_compensated_error
     };
 };
 
+//-----------------------------------------------------------------------
+//                      COEFFICIENT ACCESS
+//-----------------------------------------------------------------------
+// polynomials stored in the SoA layout; i-th coefficient of consecutive 
+// polynomials is stored in poly[i * K]; if Partial is true, then only 
+// first m_size polynomials are loaded
+template<class Simd_type, bool Partial>
+struct poly_coef_soa
+{
+    using value_type    = typename Simd_type::value_type;
+
+    const value_type*   m_poly;
+    size_t              m_K;
+    int                 m_size;
+
+    force_inline
+    poly_coef_soa(const value_type* poly, int K, int size)
+        :m_poly(poly), m_K(K), m_size(size)
+    {};
+
+    force_inline
+    Simd_type operator()(int i) const
+    {
+        if (Partial == true)
+            return Simd_type::load_partial(m_poly + i * m_K, m_size);
+        else
+            return Simd_type::load(m_poly + i * m_K, std::false_type());
+    };
+};
+
+//-----------------------------------------------------------------------
+//                      COMPENSATED SCHEMES
+//-----------------------------------------------------------------------
+template<class Arg_type>
+struct eval_poly_compensated
+{
+    using twofold_type  = twofold<Arg_type>;
+
+    // compensated Horner is used for polynomials with at most this number
+    // of coefficients, and compensated Estrin otherwise
+    static const int
+    max_horner_size     = 9;
+
+    template<class Coefs>
+    force_inline
+    static twofold_type eval_horner(const Arg_type& x, int size, const Coefs& poly)
+    {
+        Arg_type comp   = Arg_type(0.0);
+        Arg_type res    = poly(size - 1);
+
+        for (int i = size - 2; i >= 0; --i)
+        {
+            twofold_type prod   = twofold_mult(res, x);
+            twofold_type sum    = twofold_sum(prod.value, poly(i));
+
+            Arg_type err        = prod.error + sum.error;
+            comp                = eval_fma<Arg_type, Arg_type>::eval(comp, x, err);
+            res                 = sum.value;
+        }
+
+        return twofold_sum(res, comp);
+    };
+
+    // compensated Horner with aposteriori error bound a of |p(x) - (r + e)|;
+    // see eval_horner2_compensated_error
+    template<class Coefs>
+    force_inline
+    static twofold_type eval_horner_error(const Arg_type& x, int size, const Coefs& poly,
+                                          Arg_type& a)
+    {
+        Arg_type abs_x      = eval_abs<Arg_type>::eval(x);
+        Arg_type comp_b     = Arg_type(0.0);
+        Arg_type comp_c     = Arg_type(0.0);
+        Arg_type res        = poly(size - 1);
+
+        for (int i = size - 2; i >= 0; --i)
+        {
+            twofold_type prod   = twofold_mult(res, x);
+            twofold_type sum    = twofold_sum(prod.value, poly(i));
+            res                 = sum.value;
+
+            Arg_type err        = prod.error + sum.error;
+            Arg_type abs_err    = eval_abs<Arg_type>::eval(prod.error)
+                                + eval_abs<Arg_type>::eval(sum.error);
+
+            comp_c              = eval_fma<Arg_type, Arg_type>::eval(comp_c, x, err);
+            comp_b              = eval_fma<Arg_type, Arg_type>::eval(comp_b, abs_x, abs_err);
+        }
+
+        const Arg_type eps  = eval_eps<Arg_type>::eval();
+        const Arg_type one  = Arg_type(1);
+        const Arg_type u    = eps * Arg_type(0.5);
+
+        Arg_type g          = eval_gamma(2 * size - 3, u);
+        Arg_type N1         = Arg_type(float(size));
+
+        a                   = (g * comp_b) / (one - N1 * eps);
+
+        return twofold_sum(res, comp_c);
+    };
+
+    // p(x) = P_0(y) + x * (P_1(y) + x * (P_2(y) + x * P_3(y))), y = x^4; 
+    // P_k are evaluated in twofold arithmetic in four independent chains
+    template<class Coefs>
+    force_inline
+    static twofold_type eval_estrin(const Arg_type& x, int size, const Coefs& poly)
+    {
+        const Arg_type zero = Arg_type(0.0);
+
+        twofold_type x2     = twofold_mult(x, x);
+        twofold_type y      = x2 * x2;
+
+        int M               = (size + 3) / 4;
+        int top             = 4 * (M - 1);
+
+        twofold_type p0     = twofold_type(poly(top), zero);
+        twofold_type p1     = twofold_type(top + 1 < size ? poly(top + 1) : zero, zero);
+        twofold_type p2     = twofold_type(top + 2 < size ? poly(top + 2) : zero, zero);
+        twofold_type p3     = twofold_type(top + 3 < size ? poly(top + 3) : zero, zero);
+
+        // each step: 7 u^2 relative error of multiplication and 2 u^2 of
+        // addition
+        for (int i = top - 4; i >= 0; i -= 4)
+        {
+            p0              = p0 * y + poly(i + 0);
+            p1              = p1 * y + poly(i + 1);
+            p2              = p2 * y + poly(i + 2);
+            p3              = p3 * y + poly(i + 3);
+        };
+
+        // 6 u^2 relative error in each step
+        twofold_type res    = p3 * x + p2;
+        res                 = res * x + p1;
+        res                 = res * x + p0;
+
+        // error of y = x^4 is at most 7 u^2, therefore powers y^m computed
+        // implicitly have relative error at most 7m u^2; summing errors
+        // we obtain |p(x) - p_app(x)| <= gam(16M + 4) * |p|(|x|) * u^2
+        return res;
+    };
+
+    // compensated Estrin with apriori error bound a of |p(x) - (r + e)|
+    template<class Coefs>
+    force_inline
+    static twofold_type eval_estrin_error(const Arg_type& x, int size, const Coefs& poly,
+                                          Arg_type& a)
+    {
+        const Arg_type eps  = eval_eps<Arg_type>::eval();
+        const Arg_type one  = Arg_type(1);
+        const Arg_type u    = eps * Arg_type(0.5);
+
+        Arg_type abs_x      = eval_abs<Arg_type>::eval(x);
+        Arg_type abs_p      = eval_abs<Arg_type>::eval(poly(size - 1));
+
+        // |p|(|x|); relative error is bounded by gam(2N - 2)
+        for (int i = size - 2; i >= 0; --i)
+            abs_p           = eval_fma<Arg_type, Arg_type>::eval(abs_p, abs_x, 
+                                eval_abs<Arg_type>::eval(poly(i)));
+
+        int M               = (size + 3) / 4;
+        Arg_type g          = eval_gamma(16 * M + 4, u * u);
+        Arg_type N1         = Arg_type(float(size));
+
+        a                   = (g * abs_p) / (one - N1 * eps);
+
+        return eval_estrin(x, size, poly);
+    };
+
+    template<class Coefs>
+    force_inline
+    static twofold_type eval(const Arg_type& x, int size, const Coefs& poly)
+    {
+        if (size <= max_horner_size)
+            return eval_horner(x, size, poly);
+        else
+            return eval_estrin(x, size, poly);
+    };
+
+    template<class Coefs>
+    force_inline
+    static twofold_type eval_error(const Arg_type& x, int size, const Coefs& poly, Arg_type& a)
+    {
+        if (size <= max_horner_size)
+            return eval_horner_error(x, size, poly, a);
+        else
+            return eval_estrin_error(x, size, poly, a);
+    };
+
+    // return estimator of |p(x) - r|, where r + e is twofold result and
+    // a is a bound on |p(x) - (r + e)|
+    force_inline
+    static Arg_type eval_abs_error(const twofold_type& res, const Arg_type& a)
+    {
+        const Arg_type eps  = eval_eps<Arg_type>::eval();
+        const Arg_type one  = Arg_type(1);
+
+        Arg_type res_err    = a + eval_abs<Arg_type>::eval(res.error);
+        return res_err / (one - eps);
+    };
+
+    // return max a such that r + e is faithfully rounded
+    force_inline
+    static Arg_type eval_faithful_bound(const twofold_type& res)
+    {
+        const Arg_type eps  = eval_eps<Arg_type>::eval();
+        const Arg_type u    = eps * Arg_type(0.5);
+        return u * Arg_type(0.5) * eval_abs<Arg_type>::eval(res.value);
+    };
+
+    force_inline
+    static Arg_type eval_gamma(int k, const Arg_type& u)
+    {
+        Arg_type ku = Arg_type(float(k)) * u;
+        Arg_type r  = ku / (Arg_type(1) - ku);
+        return r;
+    };
+};
+
+template<class Simd_type>
+struct eval_poly_compensated_batch
+{
+    using value_type    = typename Simd_type::value_type;
+    using mask_type     = simd_mask<value_type, Simd_type::number_bits, typename Simd_type::simd_tag>;
+    using impl_type     = eval_poly_compensated<Simd_type>;
+
+    static const int
+    vector_size         = Simd_type::vector_size;
+
+    template<bool Partial>
+    static void eval_block(const value_type* x, size_t n, int N, int K, const value_type* poly,
+                           int size, value_type* res)
+    {
+        using coefs_type    = poly_coef_soa<Simd_type, Partial>;
+        coefs_type coefs    = coefs_type(poly, K, size);
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            Simd_type xv    = Simd_type(x[j]);
+            Simd_type rv    = impl_type::eval(xv, N, coefs).value;
+
+            if (Partial == true)
+                rv.store_partial(res + j * K, size);
+            else
+                rv.store(res + j * K, std::false_type());
+        };
+    };
+
+    template<bool Partial>
+    static bool eval_block_error(const value_type* x, size_t n, int N, int K, 
+                                 const value_type* poly, int size, value_type* res,
+                                 value_type* error, bool* is_faithful)
+    {
+        using coefs_type    = poly_coef_soa<Simd_type, Partial>;
+        coefs_type coefs    = coefs_type(poly, K, size);
+
+        bool all_faithful   = true;
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            Simd_type xv    = Simd_type(x[j]);
+            Simd_type a;
+
+            twofold<Simd_type> rv   = impl_type::eval_error(xv, N, coefs, a);
+            Simd_type ev            = impl_type::eval_abs_error(rv, a);
+            mask_type faithful      = lt_mask(a, impl_type::eval_faithful_bound(rv));
+
+            // the last elements are not used for partial blocks
+            if (Partial == true)
+            {
+                for (int i = 0; i < size; ++i)
+                    all_faithful = all_faithful && faithful.get(i);
+            }
+            else
+            {
+                all_faithful = all_faithful && all(faithful);
+            };
+
+            if (Partial == true)
+            {
+                rv.value.store_partial(res + j * K, size);
+                ev.store_partial(error + j * K, size);
+            }
+            else
+            {
+                rv.value.store(res + j * K, std::false_type());
+                ev.store(error + j * K, std::false_type());
+            };
+
+            if (is_faithful != nullptr)
+            {
+                for (int i = 0; i < size; ++i)
+                    is_faithful[j * K + i] = faithful.get(i);
+            };
+        };
+
+        return all_faithful;
+    };
+
+    static void eval(const value_type* x, size_t n, int N, int K, const value_type* poly,
+                     value_type* res)
+    {
+        int k           = 0;
+
+        for (; k + vector_size <= K; k += vector_size)
+            eval_block<false>(x, n, N, K, poly + k, vector_size, res + k);
+
+        if (k < K)
+            eval_block<true>(x, n, N, K, poly + k, K - k, res + k);
+    };
+
+    static bool eval_error(const value_type* x, size_t n, int N, int K, const value_type* poly,
+                           value_type* res, value_type* error, bool* is_faithful)
+    {
+        int k           = 0;
+        bool all_ok     = true;
+
+        for (; k + vector_size <= K; k += vector_size)
+        {
+            bool* is_faithful_k = (is_faithful != nullptr) ? is_faithful + k : nullptr;
+            all_ok      = eval_block_error<false>(x, n, N, K, poly + k, vector_size, res + k,
+                                                  error + k, is_faithful_k) && all_ok;
+        };
+
+        if (k < K)
+        {
+            bool* is_faithful_k = (is_faithful != nullptr) ? is_faithful + k : nullptr;
+            all_ok      = eval_block_error<true>(x, n, N, K, poly + k, K - k, res + k,
+                                                 error + k, is_faithful_k) && all_ok;
+        };
+
+        return all_ok;
+    };
+};
+
 template<class Trans, class Arg_type, class Coef_type>
 struct eval_horner2;
 
@@ -247,4 +581,66 @@ Arg_type simd::compensated_horner_and_error(const Arg_type& x, int N, const Coef
     return res;
 };
 
+template<class Val, int Bits, class Simd_tag, class Coef_type>
+simd::simd<Val, Bits, Simd_tag>
+simd::compensated_horner_and_error(const simd<Val, Bits, Simd_tag>& x, int N,
+                const Coef_type* poly, simd<Val, Bits, Simd_tag>& error, 
+                simd_mask<Val, Bits, Simd_tag>& is_faithfully_rounded)
+{
+    using simd_type     = simd<Val, Bits, Simd_tag>;
+    using impl_type     = details::eval_poly_compensated<simd_type>;
+    using coefs_type    = details::poly_coef_broadcast<simd_type, Coef_type>;
+
+    simd_type a;
+    twofold<simd_type> res  = impl_type::eval_horner_error(x, N, coefs_type(poly), a);
+
+    error                   = impl_type::eval_abs_error(res, a);
+    is_faithfully_rounded   = lt_mask(a, impl_type::eval_faithful_bound(res));
+
+    return res.value;
+};
+
+template<class Arg_type, class Coef_type>
+twofold<Arg_type>
+simd::compensated_estrin(const Arg_type& x, int N, const Coef_type* poly)
+{
+    using coefs_type    = details::poly_coef_broadcast<Arg_type, Coef_type>;
+    return details::eval_poly_compensated<Arg_type>::eval_estrin(x, N, coefs_type(poly));
+};
+
+template<class Val>
+void simd::compensated_horner_batch(const Val* x, size_t n, int N, int K, const Val* poly, 
+                Val* res)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    details::eval_poly_compensated_batch<simd_type>::eval(x, n, N, K, poly, res);
+};
+
+template<class Simd_type>
+void simd::compensated_horner_batch(const typename Simd_type::value_type* x, size_t n,
+                int N, int K, const typename Simd_type::value_type* poly, 
+                typename Simd_type::value_type* res)
+{
+    details::eval_poly_compensated_batch<Simd_type>::eval(x, n, N, K, poly, res);
+};
+
+template<class Val>
+bool simd::compensated_horner_batch_and_error(const Val* x, size_t n, int N, int K, 
+                const Val* poly, Val* res, Val* error, bool* is_faithfully_rounded)
+{
+    using simd_type = typename default_simd_type<Val>::type;
+    return details::eval_poly_compensated_batch<simd_type>
+                ::eval_error(x, n, N, K, poly, res, error, is_faithfully_rounded);
+};
+
+template<class Simd_type>
+bool simd::compensated_horner_batch_and_error(const typename Simd_type::value_type* x,
+                size_t n, int N, int K, const typename Simd_type::value_type* poly,
+                typename Simd_type::value_type* res, typename Simd_type::value_type* error,
+                bool* is_faithfully_rounded)
+{
+    return details::eval_poly_compensated_batch<Simd_type>
+                ::eval_error(x, n, N, K, poly, res, error, is_faithfully_rounded);
+};
+
 }
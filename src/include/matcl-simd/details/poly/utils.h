@@ -258,5 +258,27 @@ struct broadcast<float>
     }
 };
 
+//-----------------------------------------------------------------------
+//                      COEFFICIENT ACCESS
+//-----------------------------------------------------------------------
+// access to coefficients of a polynomial stored in an array; coefficients
+// are common to all elements (or are stored as vectors)
+template<class Arg_type, class Coef_type>
+struct poly_coef_broadcast
+{
+    const Coef_type*    m_poly;
+
+    force_inline
+    poly_coef_broadcast(const Coef_type* poly)
+        :m_poly(poly)
+    {};
+
+    force_inline
+    Arg_type operator()(int i) const
+    {
+        return broadcast<Arg_type>::eval(m_poly[i]);
+    };
+};
+
 }}}
 
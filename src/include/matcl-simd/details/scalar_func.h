@@ -11,6 +11,7 @@
 
 #include "matcl-simd/details/float/fma_dekker.h"
 #include "matcl-simd/details/utils.h"
+#include "matcl-simd/other_functions.h"
 #include <cmath>
 
 namespace matcl { namespace simd { namespace details
@@ -396,6 +397,17 @@ T shift_right_arithmetic(const T& x, unsigned int y)
     return *reinterpret_cast<const T*>(&res);
 };
 
+//-------------------------------------------------------------------
+//                         multiply high
+//-------------------------------------------------------------------
+force_inline int32_t mulh(int32_t x, int32_t y)     { return matcl::simd::mulh(x, y); };
+force_inline int64_t mulh(int64_t x, int64_t y)     { return matcl::simd::mulh(x, y); };
+
+force_inline int32_t mulhu(int32_t x, int32_t y)    
+                        { return int32_t(matcl::simd::mulh(uint32_t(x), uint32_t(y))); };
+force_inline int64_t mulhu(int64_t x, int64_t y)    
+                        { return int64_t(matcl::simd::mulh(uint64_t(x), uint64_t(y))); };
+
 //-------------------------------------------------------------------
 //                         conditional
 //-------------------------------------------------------------------
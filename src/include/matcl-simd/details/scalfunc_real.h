@@ -114,6 +114,10 @@ namespace scal_func
         return std::copysign(x,y);
     }
 
+    // FMA instruction is used if MATCL_ARCHITECTURE_HAS_FMA is set
+    inline namespace MATCL_SIMD_ISA_NAMESPACE
+    {
+
     //--------------------------------------------------------------------
     force_inline double fma_f(double x, double y, double z)
     {
@@ -277,6 +281,8 @@ namespace scal_func
             return -fma_dekker(x, y, z);
         #endif
     };
+
+    }
 }
 
 }}}
@@ -59,6 +59,27 @@
     #define MATCL_ARCHITECTURE_HAS_FMA 1
 #endif
 
+// set value of this macro to 1 if AVX-512 Foundation instruction set (AVX512F)
+// is available and 0 otherwise
+#ifndef MATCL_ARCHITECTURE_HAS_AVX512F
+    #define MATCL_ARCHITECTURE_HAS_AVX512F 0
+#endif
+
+// set value of this macro to 1 if AVX-512 Doubleword and Quadword instruction
+// set (AVX512DQ) is available and 0 otherwise; this macro is used only if
+// MATCL_ARCHITECTURE_HAS_AVX512F is set
+#ifndef MATCL_ARCHITECTURE_HAS_AVX512DQ
+    #define MATCL_ARCHITECTURE_HAS_AVX512DQ 0
+#endif
+
+// set value of this macro to 1 if AVX-512 Vector Length extensions (AVX512VL)
+// are available and 0 otherwise; this macro is used only if
+// MATCL_ARCHITECTURE_HAS_AVX512F is set; if also MATCL_ARCHITECTURE_HAS_AVX512DQ
+// is set, then 128-bit and 256-bit int64 multiplication uses vpmullq
+#ifndef MATCL_ARCHITECTURE_HAS_AVX512VL
+    #define MATCL_ARCHITECTURE_HAS_AVX512VL 0
+#endif
+
 // set value of this macro to 1 if POPCNT instruction is available and 0
 // otherwise
 #ifndef MATCL_ARCHITECTURE_HAS_POPCNT
@@ -87,7 +108,9 @@
 // value may have negative impact on performance
 #ifndef MATCL_SIMD_ALIGNMENT
 
-    #if MATCL_ARCHITECTURE_HAS_AVX
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        #define MATCL_SIMD_ALIGNMENT    64
+    #elif MATCL_ARCHITECTURE_HAS_AVX
         #define MATCL_SIMD_ALIGNMENT    32
     #elif MATCL_ARCHITECTURE_HAS_SSE2
         #define MATCL_SIMD_ALIGNMENT    16
@@ -100,7 +123,9 @@
 // set value of this macro to 1 if SIMD registers are available
 #ifndef MATCL_ARCHITECTURE_HAS_SIMD
 
-    #if MATCL_ARCHITECTURE_HAS_AVX
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        #define MATCL_ARCHITECTURE_HAS_SIMD 1
+    #elif MATCL_ARCHITECTURE_HAS_AVX
         #define MATCL_ARCHITECTURE_HAS_SIMD 1
     #elif MATCL_ARCHITECTURE_HAS_SSE2
         #define MATCL_ARCHITECTURE_HAS_SIMD 1
@@ -92,11 +92,63 @@ template<class Val, int Bits, class Simd_tag>
 simd<Val, Bits, Simd_tag> 
 exp(const simd<Val, Bits, Simd_tag>& x);
 
+// return 2 raised to the given power x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+exp2(const simd<Val, Bits, Simd_tag>& x);
+
+// return 10 raised to the given power x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+exp10(const simd<Val, Bits, Simd_tag>& x);
+
+// return exp(x) - 1; result is accurate also for x close to zero
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+expm1(const simd<Val, Bits, Simd_tag>& x);
+
 // computes the natural (base e, Euler's number, 2.7182818) logarithm of x
 template<class Val, int Bits, class Simd_tag>
 simd<Val, Bits, Simd_tag> 
 log(const simd<Val, Bits, Simd_tag>& x);
 
+// return the base 2 logarithm of x; result is exact for powers of 2
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+log2(const simd<Val, Bits, Simd_tag>& x);
+
+// return the base 10 logarithm of x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+log10(const simd<Val, Bits, Simd_tag>& x);
+
+// return log(1 + x); result is accurate also for x close to zero
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+log1p(const simd<Val, Bits, Simd_tag>& x);
+
+// return x raised to the power y; special cases are handled according to
+// the IEEE 754 standard; relative error is close to the error of exp
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+pow(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y);
+
+// return x raised to the power y
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+pow(const simd<Val, Bits, Simd_tag>& x, const Val& y);
+
+// return x raised to the integer power n using binary powering; relative
+// error grows linearly with log2(|n|); powi(x, 0) = 1 for all x
+template<int Bits, class Simd_tag>
+simd<double, Bits, Simd_tag> 
+powi(const simd<double, Bits, Simd_tag>& x, const simd<int64_t, Bits, Simd_tag>& n);
+
+// return x raised to the integer power n; see powi for double values
+template<int Bits, class Simd_tag>
+simd<float, Bits, Simd_tag> 
+powi(const simd<float, Bits, Simd_tag>& x, const simd<int32_t, Bits, Simd_tag>& n);
+
 // return the sine function of x in radians
 template<class Val, int Bits, class Simd_tag>
 simd<Val, Bits, Simd_tag> 
@@ -113,6 +165,22 @@ void
 sincos_simpl(const simd<Val, Bits, Simd_tag>& x, simd<Val, Bits, Simd_tag>& ret_sin,
     simd<Val, Bits, Simd_tag>& ret_cos);
 
+// return the sine and cosine function of x in radians; results are the same
+// as results returned by sin(x) and cos(x), but the argument reduction is
+// performed only once
+template<class Val, int Bits, class Simd_tag>
+void
+sincos(const simd<Val, Bits, Simd_tag>& x, simd<Val, Bits, Simd_tag>& ret_sin,
+    simd<Val, Bits, Simd_tag>& ret_cos);
+
+// return the vector [cos(x[0]), sin(x[1]), cos(x[2]), sin(x[3]), ...]; if
+// each argument t_i is stored twice, i.e. x = [t_1, t_1, t_2, t_2, ...], then
+// the i-th element of the result is complex(cos(t_i), sin(t_i)) = exp(i*t_i);
+// defined only for simd types, for which simd_compl type is available
+template<class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag>
+cis(const simd<Val, Bits, Simd_tag>& x);
+
 // return the tangent function of x in radians
 template<class Val, int Bits, class Simd_tag>
 simd<Val, Bits, Simd_tag> 
@@ -123,4 +191,184 @@ template<class Val, int Bits, class Simd_tag>
 simd<Val, Bits, Simd_tag> 
 cot(const simd<Val, Bits, Simd_tag>& x);
 
+// return the arc tangent of x in radians, in the range [-pi/2, pi/2]
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+atan(const simd<Val, Bits, Simd_tag>& x);
+
+// return the arc tangent of y/x in radians, in the range [-pi, pi]; the
+// quadrant is determined by signs of x and y; special cases are handled
+// according to the IEEE 754 standard
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+atan2(const simd<Val, Bits, Simd_tag>& y, const simd<Val, Bits, Simd_tag>& x);
+
+// return the arc sine of x in radians, in the range [-pi/2, pi/2]; NaN is
+// returned if |x| > 1
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+asin(const simd<Val, Bits, Simd_tag>& x);
+
+// return the arc cosine of x in radians, in the range [0, pi]; NaN is
+// returned if |x| > 1
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+acos(const simd<Val, Bits, Simd_tag>& x);
+
+// return the hyperbolic sine of x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+sinh(const simd<Val, Bits, Simd_tag>& x);
+
+// return the hyperbolic cosine of x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+cosh(const simd<Val, Bits, Simd_tag>& x);
+
+// return the hyperbolic tangent of x; result is saturated to +-1 for large |x|
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+tanh(const simd<Val, Bits, Simd_tag>& x);
+
+// return the logistic sigmoid function 1 / (1 + exp(-x)); result is
+// saturated to 0 or 1 for large |x|
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+sigmoid(const simd<Val, Bits, Simd_tag>& x);
+
+// return the softplus function log(1 + exp(x)); no overflow occurs for
+// large x, for which softplus(x) = x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+softplus(const simd<Val, Bits, Simd_tag>& x);
+
+// return the error function of x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+erf(const simd<Val, Bits, Simd_tag>& x);
+
+// return the complementary error function 1 - erf(x); result is accurate
+// also for large x
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+erfc(const simd<Val, Bits, Simd_tag>& x);
+
+// return the cumulative distribution function of the standard normal
+// distribution; result is accurate also in tails
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+normcdf(const simd<Val, Bits, Simd_tag>& x);
+
+// return the inverse of the standard normal cdf; NaN is returned for p
+// outside [0, 1], norminv(0) = -inf and norminv(1) = inf
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+norminv(const simd<Val, Bits, Simd_tag>& p);
+
+// return an approximation of 1/x; hardware approximation with relative error
+// below 1.5 * 2^-12 (2^-14 on AVX-512) is used if available, otherwise 1/x
+// is computed exactly
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+rcp_approx(const simd<Val, Bits, Simd_tag>& x);
+
+// return 1/x computed from rcp_approx refined by Newton iterations if
+// hardware approximation is available, otherwise by division; relative
+// error is below 3 ulp and denormal results may be flushed to zero
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+rcp(const simd<Val, Bits, Simd_tag>& x);
+
+// return an approximation of 1/sqrt(x); hardware approximation with relative
+// error below 1.5 * 2^-12 (2^-14 on AVX-512) is used if available, otherwise
+// 1/sqrt(x) is computed
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+rsqrt_approx(const simd<Val, Bits, Simd_tag>& x);
+
+// return 1/sqrt(x) computed from rsqrt_approx refined by Newton iterations
+// if hardware approximation is available; relative error is below 3 ulp and
+// denormal arguments may be treated as zero
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+rsqrt(const simd<Val, Bits, Simd_tag>& x);
+
+// return the cube root of x; relative error is below 1 ulp
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+cbrt(const simd<Val, Bits, Simd_tag>& x);
+
+// return the natural logarithm of the absolute value of the gamma function;
+// lgamma(x) = inf for nonpositive integers
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+lgamma(const simd<Val, Bits, Simd_tag>& x);
+
+// return the gamma function of x; NaN is returned for negative integers and
+// -inf, tgamma(+-0) = +-inf
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+tgamma(const simd<Val, Bits, Simd_tag>& x);
+
+// return the digamma function of x, i.e. the logarithmic derivative of the
+// gamma function; NaN is returned for negative integers
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+digamma(const simd<Val, Bits, Simd_tag>& x);
+
+// return sqrt(x^2 + y^2) without undue overflow or underflow; hypot(+-inf, y)
+// = inf also for NaN y; relative error is below 2 ulp
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+hypot(const simd<Val, Bits, Simd_tag>& x, const simd<Val, Bits, Simd_tag>& y);
+
+//-----------------------------------------------------------------------
+//                   COMPLEX FUNCTIONS
+//-----------------------------------------------------------------------
+// complex functions are evaluated using real functions on vectors storing
+// duplicated real and imaginary parts; elements, for which the result is
+// not finite, are recomputed by scalar functions from the standard library
+// in order to handle special values according to C99 Annex G; defined only
+// if simd_compl type is available
+
+// return the complex exponential function of x
+template<class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag> 
+exp(const simd_compl<Val, Bits, Simd_tag>& x);
+
+// return the principal value of the complex natural logarithm of x; the
+// imaginary part is in the interval [-pi, pi]
+template<class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag> 
+log(const simd_compl<Val, Bits, Simd_tag>& x);
+
+// return the principal value of the complex square root of x; the real
+// part of the result is nonnegative
+template<class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag> 
+sqrt(const simd_compl<Val, Bits, Simd_tag>& x);
+
+// return the vector [|x_0|, |x_0|, |x_1|, |x_1|, ...] of absolute values of
+// complex elements x_i of x stored twice; |x_i| = hypot(real(x_i), imag(x_i))
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+abs(const simd_compl<Val, Bits, Simd_tag>& x);
+
+// return the vector [a_0, a_0, a_1, a_1, ...] of arguments of complex 
+// elements x_i of x stored twice, a_i = atan2(imag(x_i), real(x_i))
+template<class Val, int Bits, class Simd_tag>
+simd<Val, Bits, Simd_tag> 
+arg(const simd_compl<Val, Bits, Simd_tag>& x);
+
+// return x^y = exp(y * log(x)); pow(x, 0) = 1 and pow(0, y) = 0 if
+// real(y) > 0
+template<class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag> 
+pow(const simd_compl<Val, Bits, Simd_tag>& x, const simd_compl<Val, Bits, Simd_tag>& y);
+
+// return exp(i * x) for a complex vector x; see also cis for real vectors
+template<class Val, int Bits, class Simd_tag>
+simd_compl<Val, Bits, Simd_tag> 
+cis(const simd_compl<Val, Bits, Simd_tag>& x);
+
 }}
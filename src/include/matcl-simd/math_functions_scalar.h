@@ -14,6 +14,11 @@
 namespace matcl { namespace simd
 {
 
+// implemented using default scalar simd types, which depend on available
+// instruction sets
+inline namespace MATCL_SIMD_ISA_NAMESPACE
+{
+
 //-----------------------------------------------------------------------
 //              MATHEMATICAL FUNCTIONS FOR SCALAR ARGUMENTS
 //-----------------------------------------------------------------------
@@ -79,10 +84,42 @@ double  copysign(double x, double y);
 double  exp(double x);
 float   exp(float x);
 
+// return 2 raised to the given power x
+double  exp2(double x);
+float   exp2(float x);
+
+// return 10 raised to the given power x
+double  exp10(double x);
+float   exp10(float x);
+
+// return exp(x) - 1; result is accurate also for x close to zero
+double  expm1(double x);
+float   expm1(float x);
+
 // computes the natural (base e, Euler's number, 2.7182818) logarithm of x
 double  log(double x);
 float   log(float x);
 
+// return the base 2 logarithm of x; result is exact for powers of 2
+double  log2(double x);
+float   log2(float x);
+
+// return the base 10 logarithm of x
+double  log10(double x);
+float   log10(float x);
+
+// return log(1 + x); result is accurate also for x close to zero
+double  log1p(double x);
+float   log1p(float x);
+
+// return x raised to the power y
+double  pow(double x, double y);
+float   pow(float x, float y);
+
+// return x raised to the integer power n
+double  powi(double x, int n);
+float   powi(float x, int n);
+
 // return the sine function of x in radians
 double  sin(double x);
 float   sin(float x);
@@ -91,6 +128,10 @@ float   sin(float x);
 double  cos(double x);
 float   cos(float x);
 
+// return the sine and cosine function of x in radians
+void    sincos(double x, double& ret_sin, double& ret_cos);
+void    sincos(float x, float& ret_sin, float& ret_cos);
+
 // return the tangent function of x in radians
 double  tan(double x);
 float   tan(float x);
@@ -99,4 +140,96 @@ float   tan(float x);
 double  cot(double x);
 float   cot(float x);
 
+// return the arc tangent of x in radians
+double  atan(double x);
+float   atan(float x);
+
+// return the arc tangent of y/x in radians using signs of x and y to
+// determine the quadrant
+double  atan2(double y, double x);
+float   atan2(float y, float x);
+
+// return the arc sine of x in radians
+double  asin(double x);
+float   asin(float x);
+
+// return the arc cosine of x in radians
+double  acos(double x);
+float   acos(float x);
+
+// return the hyperbolic sine of x
+double  sinh(double x);
+float   sinh(float x);
+
+// return the hyperbolic cosine of x
+double  cosh(double x);
+float   cosh(float x);
+
+// return the hyperbolic tangent of x
+double  tanh(double x);
+float   tanh(float x);
+
+// return the logistic sigmoid function 1 / (1 + exp(-x))
+double  sigmoid(double x);
+float   sigmoid(float x);
+
+// return the softplus function log(1 + exp(x))
+double  softplus(double x);
+float   softplus(float x);
+
+// return the error function of x
+double  erf(double x);
+float   erf(float x);
+
+// return the complementary error function of x
+double  erfc(double x);
+float   erfc(float x);
+
+// return the cumulative distribution function of the standard normal
+// distribution
+double  normcdf(double x);
+float   normcdf(float x);
+
+// return the inverse of the standard normal cdf
+double  norminv(double p);
+float   norminv(float p);
+
+// return an approximation of 1/x; see rcp_approx for simd types
+double  rcp_approx(double x);
+float   rcp_approx(float x);
+
+// return 1/x; see rcp for simd types
+double  rcp(double x);
+float   rcp(float x);
+
+// return an approximation of 1/sqrt(x); see rsqrt_approx for simd types
+double  rsqrt_approx(double x);
+float   rsqrt_approx(float x);
+
+// return 1/sqrt(x); see rsqrt for simd types
+double  rsqrt(double x);
+float   rsqrt(float x);
+
+// return the cube root of x
+double  cbrt(double x);
+float   cbrt(float x);
+
+// return the natural logarithm of the absolute value of the gamma function
+double  lgamma(double x);
+float   lgamma(float x);
+
+// return the gamma function of x
+double  tgamma(double x);
+float   tgamma(float x);
+
+// return the digamma function of x
+double  digamma(double x);
+float   digamma(float x);
+
+// return sqrt(x^2 + y^2) without undue overflow or underflow
+double  hypot(double x, double y);
+float   hypot(float x, float y);
+
+}
+
 }}
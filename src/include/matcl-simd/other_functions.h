@@ -13,6 +13,10 @@
 namespace matcl { namespace simd
 {
 
+// LZCNT, BMI1 and POPCNT instructions are used if available (see machine.h)
+inline namespace MATCL_SIMD_ISA_NAMESPACE
+{
+
 //-----------------------------------------------------------------------
 //                   BIT MANIPULATION
 //-----------------------------------------------------------------------
@@ -42,4 +46,17 @@ uint64_t least_significant_bit(uint64_t x);
 // return the high 64 bits of the 128-bit result of the multiplication
 uint64_t mulh(uint64_t x, uint64_t y);
 
+// return the high 32 bits of the 64-bit result of the multiplication
+uint32_t mulh(uint32_t x, uint32_t y);
+
+// return the high 64 bits of the 128-bit result of the multiplication of
+// signed integers
+int64_t  mulh(int64_t x, int64_t y);
+
+// return the high 32 bits of the 64-bit result of the multiplication of
+// signed integers
+int32_t  mulh(int32_t x, int32_t y);
+
+}
+
 }}
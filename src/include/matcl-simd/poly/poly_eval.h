@@ -141,6 +141,194 @@ Arg_type    estrin(const Arg_type& x, const Coef_type* poly);
 template<class Arg_type, class Coef_type>
 Arg_type    estrin(const Arg_type& x, int N, const Coef_type* poly);
 
+//-----------------------------------------------------------------------
+//                      MULTIPLE POLYNOMIALS
+//-----------------------------------------------------------------------
+// evaluation of K independent polynomials with N coefficients, or one
+// polynomial at K points, in one call; each step of the evaluation scheme
+// is performed for all K polynomials before the next step, therefore K
+// independent dependency chains are interleaved and latency of FMA
+// instructions is hidden; K should be small (2 - 4), since all intermediate
+// values should be kept in registers; all loops are unrolled
+
+// evaluate K polynomials at point x using the Horner's scheme, where
+// poly[k] = {a_0, a_1, ..., a_{N-1}} is the k-th polynomial; results are
+// stored in the array res of size K; res[k] is equal to horner<N>(x, poly[k])
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void        horner_multi_poly(const Arg_type& x, const Coef_type* const* poly,
+                Arg_type* res);
+
+// evaluate a polynomial poly = {a_0, a_1, ..., a_{N-1}} at points x[k],
+// 0 <= k < K, using the Horner's scheme; results are stored in the array res
+// of size K; res[k] is equal to horner<N>(x[k], poly)
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void        horner_multi_arg(const Arg_type* x, const Coef_type* poly, Arg_type* res);
+
+// evaluate K polynomials at point x using the Estrin's scheme, where
+// poly[k] is the k-th polynomial; results are stored in the array res of
+// size K; parts of polynomials with at most 3 coefficients are evaluated
+// using the Horner's scheme; for N <= 16 results are equal to estrin<N>
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void        estrin_multi_poly(const Arg_type& x, const Coef_type* const* poly,
+                Arg_type* res);
+
+// evaluate a polynomial poly at points x[k], 0 <= k < K, using the Estrin's
+// scheme; results are stored in the array res of size K; see also
+// estrin_multi_poly
+template<int N, int K, class Arg_type, class Coef_type>
+force_inline
+void        estrin_multi_arg(const Arg_type* x, const Coef_type* poly, Arg_type* res);
+
+//-----------------------------------------------------------------------
+//                      COMPILE-TIME COEFFICIENTS
+//-----------------------------------------------------------------------
+// polynomial P(x) = sum_{i = 0}^{N - 1} a_i * x^i is given by the list of
+// coefficients passed as template arguments:
+//      res = horner_c<a_0, a_1, ..., a_{N-1}>(x)
+// coefficients are compile-time constants, therefore they need not be loaded
+// and broadcasted from a coefficient table on every call, and can be
+// materialized as constants or folded into FMA instructions; coefficients
+// are converted to the value type of Arg_type
+
+// evaluate a polynomial at point x using the Horner's scheme; operations
+// are the same as in horner<N>
+template<double ... Coef, class Arg_type>
+force_inline
+Arg_type    horner_c(const Arg_type& x);
+
+// evaluate a polynomial at point x using the Estrin's scheme; the polynomial
+// is split recursively at the largest power of 2 less than N, see also estrin
+template<double ... Coef, class Arg_type>
+force_inline
+Arg_type    estrin_c(const Arg_type& x);
+
+// evaluate a polynomial at point x using the Horner's scheme if N <= 5 and
+// the Estrin's scheme otherwise; for N <= 5 the Estrin's scheme does not
+// reduce the length of the dependency chain
+template<double ... Coef, class Arg_type>
+force_inline
+Arg_type    poly_c(const Arg_type& x);
+
+//-----------------------------------------------------------------------
+//                      CLENSHAW SCHEME
+//-----------------------------------------------------------------------
+// evaluation of a Chebyshev series f(x) = sum_{i = 0}^{N - 1} c_i * T_i(x),
+// where T_i is the Chebyshev polynomial of the first kind of degree i;
+// the series is represented as an array of size N:
+//      coef = {c_0, c_1, ..., c_{N-1}}
+// note that the first coefficient is not halved
+
+// evaluate a Chebyshev series at point x using the Clenshaw's recurrence
+//      b_k = c_k + 2x * b_{k+1} - b_{k+2},     f(x) = c_0 + x * b_1 - b_2
+// all loops are unrolled
+template<int N, class Arg_type, class Coef_type>
+force_inline
+Arg_type    clenshaw(const Arg_type& x, const Coef_type* coef);
+
+// evaluate a Chebyshev series at point x using the Clenshaw's recurrence
+template<class Arg_type, class Coef_type>
+Arg_type    clenshaw(const Arg_type& x, int N, const Coef_type* coef);
+
+// evaluate a Chebyshev series at point x using the Clenshaw's recurrence;
+// this function also returns aposteriori absolute forward error estimator
+// 'error', such that:
+//      |res - f(x) | <= 'error'
+// where res is the computed value, f(x) is true value; the estimator is valid
+// for |x| <= 1
+template<class Arg_type, class Coef_type>
+Arg_type    clenshaw_and_error(const Arg_type& x, int N, const Coef_type* coef,
+                Arg_type& error);
+
+// return a priori condition number of a Chebyshev series at point x evaluated
+// using the Clenshaw's recurrence; for |x| <= 1 the relative accuracy of
+// computed value f_ap(x) is given by
+//      |f(x) - f_ap(x)| / |f(x)| <= (N + 1)^2 * cond(f, x) * u + O(u^2)
+// where the condition number cond(f, x) is given by:
+//      cond(f, x) = (sum_{i = 0}^{N - 1} |c_i|) / |f(x)|
+//
+// optionally, the function returns value of the series f(x) returned in 'val'
+// argument, and sum_i |c_i| returned in 'abs_val' argument
+template<class Arg_type, class Coef_type>
+Arg_type    clenshaw_apriori_cond(const Arg_type& x, int N, const Coef_type* coef);
+
+template<class Arg_type, class Coef_type>
+Arg_type    clenshaw_apriori_cond(const Arg_type& x, int N, const Coef_type* coef,
+                Arg_type& val, Arg_type& abs_val);
+
+// return aposteriori condition number of a Chebyshev series at point x, 
+// |x| <= 1, evaluated using the Clenshaw's recurrence defined as 
+//      |f(x) - f_ap(x)| / |f(x)| <= post_cond(f, x) * u
+// where f(x) is the true value, post_cond(f, x) is returned condition number;
+// the condition number is calculated using the clenshaw_and_error function.
+//
+// optionally, the function returns computed value f_ap(x) in 'val' argument
+// and estimated error, such that |f(x) - f_ap(x)| <= error in 'err' argument.
+//
+// Note:
+//  The function may return negative condition number if computed value f_ap
+//  is very inaccurate, i.e. when |f_ap(x)| < err.
+template<class Arg_type, class Coef_type>
+Arg_type    clenshaw_aposteriori_cond(const Arg_type& x, int N, const Coef_type* coef);
+
+template<class Arg_type, class Coef_type>
+Arg_type    clenshaw_aposteriori_cond(const Arg_type& x, int N, const Coef_type* coef,
+                Arg_type& val, Arg_type& err);
+
+//-----------------------------------------------------------------------
+//                      CHEBYSHEV ESTRIN SCHEME
+//-----------------------------------------------------------------------
+
+// evaluate a Chebyshev series at point x using the Estrin-like scheme;
+// the series is split as f(x) = L(x) + 2 * T_m(x) * H(x), where m is a power
+// of 2, using the identity T_{m+j} = 2 * T_m * T_j - T_{m-j}; T_m is computed
+// by repeated doubling T_2k = 2 * T_k^2 - 1; parts are split recursively (up 
+// to 3 levels) and evaluated using the Clenshaw's recurrence
+//
+// Note:
+//  this function is generally faster than clenshaw function for 
+//  sufficiently large series (N > 10) due to shorter dependency chains, 
+//  but is less accurate
+template<int N, class Arg_type, class Coef_type>
+force_inline
+Arg_type    chebyshev_estrin(const Arg_type& x, const Coef_type* coef);
+
+template<class Arg_type, class Coef_type>
+Arg_type    chebyshev_estrin(const Arg_type& x, int N, const Coef_type* coef);
+
+//-----------------------------------------------------------------------
+//                      RATIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+// evaluation of a rational function R(x) = P(x) / Q(x), where polynomials
+// P and Q are represented as arrays of size N and M:
+//      p = {a_0, a_1, ..., a_{N-1}},   q = {b_0, b_1, ..., b_{M-1}}
+
+// evaluate a rational function at point x; numerator and denominator are
+// evaluated using the Horner's scheme in one interleaved loop, therefore 
+// latencies of both dependency chains overlap; all loops are unrolled
+template<int N, int M, class Arg_type, class Coef_type>
+force_inline
+Arg_type    rational(const Arg_type& x, const Coef_type* p, const Coef_type* q);
+
+// evaluate a rational function at point x; numerator and denominator are
+// evaluated using the Horner's scheme in one interleaved loop
+template<class Arg_type, class Coef_type>
+Arg_type    rational(const Arg_type& x, int N, const Coef_type* p, int M,
+                const Coef_type* q);
+
+// evaluate a rational function at point x; this function also returns
+// aposteriori absolute forward error estimator 'error', such that:
+//      |res - R(x) | <= 'error'
+// where res is the computed value, R(x) is true value; error is derived from
+// error estimators err_p and err_q returned by horner_and_error:
+//      error = (err_p + |res| * err_q) / (|Q_ap(x)| - err_q) + u * |res|
+// returned error is INF or NAN if |Q_ap(x)| <= err_q
+template<class Arg_type, class Coef_type>
+Arg_type    rational_and_error(const Arg_type& x, int N, const Coef_type* p, int M,
+                const Coef_type* q, Arg_type& error);
+
 }};
 
 #include "matcl-simd/details/poly/poly_eval.inl"
@@ -11,6 +11,8 @@
 #include "matcl-simd/poly/poly_eval.h"
 #include "matcl-simd/details/float/twofold.h"
 
+#include <cstddef>
+
 namespace matcl { namespace simd
 {
 
@@ -86,6 +88,78 @@ template<class Arg_type, class Coef_type>
 Arg_type    compensated_horner_and_error(const Arg_type& x, int N, const Coef_type* poly,
                 Arg_type& error, bool& is_faithfully_rounded);
 
+// version of compensated_horner_and_error for simd arguments; faithful
+// rounding is tested for each element separately: the i-th element of 
+// 'is_faithfully_rounded' is selected if the i-th element of the result
+// is proven to be faithfully rounded; the polynomial can be represented as
+// an array of scalars or as an array of vectors (i.e. different polynomials
+// in different elements)
+template<class Val, int Bits, class Simd_tag, class Coef_type>
+simd<Val, Bits, Simd_tag>
+            compensated_horner_and_error(const simd<Val, Bits, Simd_tag>& x, int N,
+                const Coef_type* poly, simd<Val, Bits, Simd_tag>& error, 
+                simd_mask<Val, Bits, Simd_tag>& is_faithfully_rounded);
+
+//-----------------------------------------------------------------------
+//                      COMPENSATED ESTRIN
+//-----------------------------------------------------------------------
+
+// evaluate a polynomial at point x using a compensated scheme with four 
+// independent chains; polynomial is represented as an array of size N:
+//      poly = {a_0, a_1, ..., a_{N-1}}
+// polynomial is split as p(x) = P_0(y) + x * (P_1(y) + x * (P_2(y) 
+// + x * P_3(y))), y = x^4, where P_k(y) are evaluated using the Horner's 
+// scheme in twofold arithmetic; return twofold number r + e = p(x)
+//
+// Note:
+//  the absolute error satisfies:
+//      |p(x) - (r + e)| <= a(16M + 4) * |p|(|x|) * u^2,     M = ceil(N/4)
+//  where |p|(|x|) = sum_{i = 0}^{N - 1} |a_i| * |x|^i and a(k) = k/(1-ku^2);
+//  the bound is slightly weaker than the bound for compensated_horner, but 
+//  dependency chains are four times shorter; for large polynomials (N > 9)
+//  this function is faster than compensated_horner (by a factor 1.5-2)
+template<class Arg_type, class Coef_type>
+twofold<Arg_type>
+            compensated_estrin(const Arg_type& x, int N, const Coef_type* poly);
+
+//-----------------------------------------------------------------------
+//                      BATCHED COMPENSATED EVALUATION
+//-----------------------------------------------------------------------
+
+// evaluate K polynomials with N coefficients at n points using compensated
+// schemes; coefficients are stored in the SoA layout:
+//      poly[i * K + k] = a_i of the k-th polynomial, 0 <= i < N, 0 <= k < K
+// on exit res[j * K + k] is the value of the k-th polynomial at x[j] (i.e.
+// the computed twofold number r + e rounded to the working precision);
+// polynomials are processed in vectors of type Simd_type, i.e. each element
+// of a vector evaluates different polynomial; compensated_horner is used for
+// N <= 9 and compensated_estrin otherwise; versions without the Simd_type
+// template argument use the default simd type for given value type
+template<class Val>
+void        compensated_horner_batch(const Val* x, size_t n, int N, int K, 
+                const Val* poly, Val* res);
+
+template<class Simd_type>
+void        compensated_horner_batch(const typename Simd_type::value_type* x, size_t n,
+                int N, int K, const typename Simd_type::value_type* poly, 
+                typename Simd_type::value_type* res);
+
+// evaluate K polynomials at n points as compensated_horner_batch; this 
+// function also returns aposteriori (N <= 9) or apriori (N > 9) absolute 
+// forward error estimators error[j * K + k], and is_faithfully_rounded[j * K + k]
+// set to true if res[j * K + k] is proven to be faithfully rounded (see
+// compensated_horner_and_error); return true if all results are faithfully
+// rounded; array is_faithfully_rounded can be a null pointer
+template<class Val>
+bool        compensated_horner_batch_and_error(const Val* x, size_t n, int N, int K, 
+                const Val* poly, Val* res, Val* error, bool* is_faithfully_rounded);
+
+template<class Simd_type>
+bool        compensated_horner_batch_and_error(const typename Simd_type::value_type* x,
+                size_t n, int N, int K, const typename Simd_type::value_type* poly,
+                typename Simd_type::value_type* res, typename Simd_type::value_type* error,
+                bool* is_faithfully_rounded);
+
 }};
 
 #include "matcl-simd/details/poly/poly_eval_twofold.inl"
@@ -12,9 +12,11 @@
 #include "matcl-simd/simd_fwd.h"
 #include "matcl-simd/simd_general.h"
 #include "matcl-simd/basic_functions.h"
+#include "matcl-simd/simd_mask.h"
 #include "matcl-simd/other_functions.h"
 #include "matcl-simd/details/arch/simd_impl.inl"
 #include "matcl-simd/details/func/simd_func.inl"
+#include "matcl-simd/details/func/simd_mask.inl"
 #include "matcl-simd/details/func/other_functions.inl"
 #include "matcl-simd/default_simd.h"
 #include "matcl-simd/simd_utils.h"
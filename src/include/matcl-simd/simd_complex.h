@@ -13,5 +13,6 @@
 #include "matcl-simd/basic_complex_functions.h"
 #include "matcl-simd/details/complex/simd_complex_impl.h"
 #include "matcl-simd/details/func/simd_func_complex.inl"
+#include "matcl-simd/details/func/simd_func_complex_split.inl"
 #include "matcl-simd/details/complex/default_simd_complex.h"
 
@@ -0,0 +1,144 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/config.h"
+
+#include <cstddef>
+
+namespace matcl { namespace simd
+{
+
+//-----------------------------------------------------------------------
+//                   RUNTIME DISPATCH
+//-----------------------------------------------------------------------
+// instruction sets, for which bulk functions defined below are compiled
+// in the shared library; functions in this header do not depend on the
+// MATCL_ARCHITECTURE_HAS_XXX macros and select the implementation at runtime;
+// SSE2 is always available on x64 processors and is the lowest supported
+// instruction set
+enum class instruction_set
+{
+    sse2,           // SSE2
+    sse41,          // SSE2 - SSE4.2
+    avx,            // AVX without AVX2 and FMA; SSE4.1 kernels are used
+    avx2,           // AVX2 and FMA
+    avx512          // AVX512F and AVX512DQ together with AVX2 and FMA
+};
+
+// return the widest instruction set supported by the host processor and
+// the operating system; detection is performed once using cpuid instruction
+MATCL_SIMD_EXPORT
+instruction_set     detected_instruction_set();
+
+// return the instruction set used by bulk functions; by default this is
+// detected_instruction_set()
+MATCL_SIMD_EXPORT
+instruction_set     dispatch_instruction_set();
+
+// force bulk functions to use the instruction set is; if is is not supported
+// by the host, then the widest supported instruction set narrower than is
+// is selected; return the instruction set previously used; this function is
+// not thread safe and should be called only for testing purposes
+MATCL_SIMD_EXPORT
+instruction_set     set_dispatch_instruction_set(instruction_set is);
+
+//-----------------------------------------------------------------------
+//                   BULK FUNCTIONS
+//-----------------------------------------------------------------------
+// evaluate out[i] = f(in[i]) for 0 <= i < n, where f is given function;
+// input and output arrays need not be aligned; in and out can be equal,
+// otherwise arrays cannot overlap; results are the same as results returned
+// by simd versions of these functions; elements before the first aligned
+// element of out and remaining elements at the end are processed by simd
+// instructions using partial loads and stores
+
+// exponential function, see exp(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  exp(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  exp(const float* in, float* out, size_t n);
+
+// natural logarithm, see log(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  log(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  log(const float* in, float* out, size_t n);
+
+// sine function, see sin(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  sin(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  sin(const float* in, float* out, size_t n);
+
+// cosine function, see cos(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  cos(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  cos(const float* in, float* out, size_t n);
+
+// sine and cosine function, see sincos(const simd<Val, Bits, Simd_tag>&, ...);
+// evaluate out_sin[i] = sin(in[i]) and out_cos[i] = cos(in[i]); in can be
+// equal to out_sin or out_cos, out_sin and out_cos cannot overlap
+MATCL_SIMD_EXPORT void  sincos(const double* in, double* out_sin, double* out_cos, size_t n);
+MATCL_SIMD_EXPORT void  sincos(const float* in, float* out_sin, float* out_cos, size_t n);
+
+// tangent function, see tan(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  tan(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  tan(const float* in, float* out, size_t n);
+
+// cotangent function, see cot(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  cot(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  cot(const float* in, float* out, size_t n);
+
+// hyperbolic sine, see sinh(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  sinh(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  sinh(const float* in, float* out, size_t n);
+
+// hyperbolic cosine, see cosh(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  cosh(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  cosh(const float* in, float* out, size_t n);
+
+// hyperbolic tangent, see tanh(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  tanh(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  tanh(const float* in, float* out, size_t n);
+
+// logistic sigmoid function, see sigmoid(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  sigmoid(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  sigmoid(const float* in, float* out, size_t n);
+
+// softplus function, see softplus(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  softplus(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  softplus(const float* in, float* out, size_t n);
+
+// square root, see sqrt(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  sqrt(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  sqrt(const float* in, float* out, size_t n);
+
+// absolute value, see abs(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  abs(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  abs(const float* in, float* out, size_t n);
+
+// rounding to nearest, see round(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  round(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  round(const float* in, float* out, size_t n);
+
+// rounding towards -inf, see floor(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  floor(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  floor(const float* in, float* out, size_t n);
+
+// rounding towards +inf, see ceil(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  ceil(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  ceil(const float* in, float* out, size_t n);
+
+// rounding towards zero, see trunc(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  trunc(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  trunc(const float* in, float* out, size_t n);
+
+// fraction part, see fraction(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  fraction(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  fraction(const float* in, float* out, size_t n);
+
+// exponent part, see exponent(const simd<Val, Bits, Simd_tag>&)
+MATCL_SIMD_EXPORT void  exponent(const double* in, double* out, size_t n);
+MATCL_SIMD_EXPORT void  exponent(const float* in, float* out, size_t n);
+
+}}
@@ -0,0 +1,81 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd.h"
+
+#include <type_traits>
+
+namespace matcl { namespace simd
+{
+
+//-----------------------------------------------------------------------
+//                      DIVISION BY INVARIANT INTEGERS
+//-----------------------------------------------------------------------
+// division of integers of type Val (int32_t or int64_t) by a divisor d,
+// which is known only at runtime, but is the same for many divisions;
+// the quotient is computed using a precomputed magic number M and a shift
+// s [1, 2]:
+//      q = trunc(n / d) = mulh(M, n) +/- n >> s, corrected by 1 if negative
+// i.e. one multiply-high, few additions and shifts instead of integer
+// division, which is not available for simd types and is slow for scalars;
+// results are the same as for the C++ operators / and %, i.e. the quotient
+// is rounded toward zero and the remainder has the sign of the dividend;
+// for n = MIN and d = -1 the quotient is MIN (wraparound), where MIN is the
+// minimum value of Val.
+//
+// References:
+//  [1]. Division by Invariant Integers using Multiplication, T. Granlund,
+//      P.L. Montgomery, 1994
+//  [2]. Hacker's Delight, H.S. Warren, 2nd ed., 2012, chapter 10
+template<class Val>
+class simd_divider
+{
+    static_assert(std::is_same<Val, int32_t>::value || std::is_same<Val, int64_t>::value,
+                  "simd_divider is defined only for int32_t and int64_t");
+
+    public:
+        // type of dividends
+        using value_type    = Val;
+
+    private:
+        Val             m_divisor;
+        Val             m_magic;
+        Val             m_add_mask;
+        Val             m_sign;
+        unsigned int    m_shift;
+        bool            m_is_one;
+
+    public:
+        // precompute magic number for the divisor d; d must be nonzero
+        explicit simd_divider(Val d);
+
+        // return the divisor
+        Val             divisor() const;
+
+    public:
+        // return trunc(x / d), where d is the divisor
+        Val             divide(Val x) const;
+
+        // return x - trunc(x / d) * d, where d is the divisor
+        Val             remainder(Val x) const;
+
+        // division and remainder for all elements of the vector x
+        template<int Bits, class Simd_tag>
+        simd<Val, Bits, Simd_tag>
+                        divide(const simd<Val, Bits, Simd_tag>& x) const;
+
+        template<int Bits, class Simd_tag>
+        simd<Val, Bits, Simd_tag>
+                        remainder(const simd<Val, Bits, Simd_tag>& x) const;
+};
+
+}}
+
+#include "matcl-simd/details/func/simd_divider.inl"
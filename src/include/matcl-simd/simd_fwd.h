@@ -14,6 +14,9 @@
 namespace matcl { namespace simd
 {
 
+inline namespace MATCL_SIMD_ISA_NAMESPACE
+{
+
 // no simd instructions tag
 struct nosimd_tag;
 
@@ -23,6 +26,11 @@ struct sse_tag;
 // avx instructions tag
 struct avx_tag;
 
+// avx-512 instructions tag
+struct avx512_tag;
+
+}
+
 // simd type storing elements of type Val of total size Bits in bits
 // using instruction set determined by Simd_tag
 template<class Val, int Bits, class Simd_tag>
@@ -33,6 +41,16 @@ class simd;
 template<class Val, int Bits, class Simd_tag>
 class simd_compl;
 
+// simd type storing elements of complex type with real type Val in planar form;
+// real and imaginary parts are stored in separate vectors of type 
+// simd<Val, Bits, Simd_tag>
+template<class Val, int Bits, class Simd_tag>
+class simd_compl_split;
+
+// predicate mask for vectors of type simd<Val, Bits, Simd_tag>
+template<class Val, int Bits, class Simd_tag>
+class simd_mask;
+
 // number of elements stored in given simd type
 template<class Simd_type>
 struct vector_size;
@@ -42,12 +60,12 @@ template<class V>
 struct default_simd_type;
 
 // simd type for storing values of given type with given register size
-// (allowed values for Bits are 128 and 256)
+// (allowed values for Bits are 128, 256, and 512 if AVX-512 is available)
 template<class V, int Bits>
 struct default_simd_bit_size;
 
 // simd type for storing N values of given type
-// (allowed values for N are 1, 2, 4, 8)
+// (allowed values for N are 1, 2, 4, 8, and 16 if AVX-512 is available)
 template<class V, int N>
 struct default_simd_vector_size;
 
@@ -16,6 +16,9 @@ namespace matcl { namespace simd
 
 namespace md = matcl::details;
 
+inline namespace MATCL_SIMD_ISA_NAMESPACE
+{
+
 // no simd instructions tag
 struct nosimd_tag{};
 
@@ -25,12 +28,17 @@ struct sse_tag{};
 // avx instructions tag
 struct avx_tag{};
 
+// avx-512 instructions tag
+struct avx512_tag{};
+
 // sse instructions tag for vectors containing one value
 struct scalar_sse_tag{};
 
 // no simd instructions tag for vectors containing one value
 struct scalar_nosimd_tag{};
 
+}
+
 // simd type storing elements of type Val of total size Bits in bits
 // using instruction set determined by Simd_tag
 template<class Val, int Bits, class Simd_tag>
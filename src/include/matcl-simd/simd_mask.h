@@ -0,0 +1,173 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/simd_general.h"
+#include "matcl-simd/details/func/simd_mask_def.h"
+
+namespace matcl { namespace simd
+{
+
+// predicate mask for vectors of type simd<Val, Bits, Simd_tag>; element i of
+// a vector is selected if the i-th bit of the mask is set; on AVX-512 the mask
+// is stored in an opmask register (__mmask8 or __mmask16), otherwise as a bit
+// field returned by movemask instructions
+template<class Val, int Bits, class Simd_tag>
+class simd_mask
+{
+    public:
+        // simd type associated with this mask
+        using simd_type     = simd<Val, Bits, Simd_tag>;
+
+        // implementation type
+        using impl_type     = typename details::simd_mask_impl_type<Val, Bits, Simd_tag>::type;
+
+        // type of elements of associated simd type
+        using value_type    = Val;
+
+        // simd tag
+        using simd_tag      = Simd_tag;
+
+    public:
+        // number of elements in the associated vector
+        static const int
+        vector_size         = simd_type::vector_size;
+
+    public:
+        // internal representation; bits above vector_size are always zero
+        impl_type           data;
+
+    public:
+        // construct uninitialized mask
+        simd_mask() = default;
+
+        // construct mask from a bit field; bits above vector_size must be zero
+        simd_mask(const impl_type& bits);
+
+        // construct mask from a vector containing true_value or false_value;
+        // an element is selected if its sign bit is set
+        explicit simd_mask(const simd_type& test);
+
+        // return true if i-th element is selected
+        bool                get(int pos) const;
+
+        // convert to a vector containing true_value (for selected elements) and
+        // false_value (otherwise)
+        simd_type           as_vector() const;
+
+    public:
+        // mask with no selected elements
+        static simd_mask    zero();
+
+        // mask with all elements selected
+        static simd_mask    full();
+};
+
+//-----------------------------------------------------------------------
+//                   LOGICAL FUNCTIONS
+//-----------------------------------------------------------------------
+// perform logical and operation on masks x and y
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+operator &&(const simd_mask<Val, Bits, Tag>& x, const simd_mask<Val, Bits, Tag>& y);
+
+// perform logical or operation on masks x and y
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+operator ||(const simd_mask<Val, Bits, Tag>& x, const simd_mask<Val, Bits, Tag>& y);
+
+// perform logical negation of a mask x
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+operator !(const simd_mask<Val, Bits, Tag>& x);
+
+//-----------------------------------------------------------------------
+//                   REDUCE FUNCTIONS
+//-----------------------------------------------------------------------
+// return number of selected elements
+template<class Val, int Bits, class Tag>
+int popcount(const simd_mask<Val, Bits, Tag>& x);
+
+// return true if at least one element is selected
+template<class Val, int Bits, class Tag>
+bool any(const simd_mask<Val, Bits, Tag>& x);
+
+// return true if all elements are selected
+template<class Val, int Bits, class Tag>
+bool all(const simd_mask<Val, Bits, Tag>& x);
+
+// return index of the first selected element or -1 if no element is selected
+template<class Val, int Bits, class Tag>
+int first_set(const simd_mask<Val, Bits, Tag>& x);
+
+//-----------------------------------------------------------------------
+//                   COMPARISON FUNCTIONS
+//-----------------------------------------------------------------------
+// test x == y; select elements for which the test is true
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+eeq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y);
+
+// test x != y; select elements for which the test is true
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+neq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y);
+
+// test x < y; select elements for which the test is true
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+lt_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y);
+
+// test x > y; select elements for which the test is true
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+gt_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y);
+
+// test x <= y; select elements for which the test is true
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+leq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y);
+
+// test x >= y; select elements for which the test is true
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+geq_mask(const simd<Val, Bits, Tag>& x, const simd<Val, Bits, Tag>& y);
+
+// select NaN elements of x
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+is_nan_mask(const simd<Val, Bits, Tag>& x);
+
+// select finite elements of x (i.e. neither INF nor NAN)
+template<class Val, int Bits, class Tag>
+simd_mask<Val, Bits, Tag>
+is_finite_mask(const simd<Val, Bits, Tag>& x);
+
+//-----------------------------------------------------------------------
+//                   CONDITIONAL FUNCTIONS
+//-----------------------------------------------------------------------
+// evaluate test ? val_true : val_false;
+template<class Val, int Bits, class Tag>
+simd<Val, Bits, Tag>
+if_then_else(const simd_mask<Val, Bits, Tag>& test, const simd<Val, Bits, Tag>& val_true,
+             const simd<Val, Bits, Tag>& val_false);
+
+// evaluate test ? x + y : x;
+template<class Val, int Bits, class Tag>
+simd<Val, Bits, Tag>
+if_add(const simd_mask<Val, Bits, Tag>& test, const simd<Val, Bits, Tag>& x,
+       const simd<Val, Bits, Tag>& y);
+
+// evaluate test ? x - y : x;
+template<class Val, int Bits, class Tag>
+simd<Val, Bits, Tag>
+if_sub(const simd_mask<Val, Bits, Tag>& test, const simd<Val, Bits, Tag>& x,
+       const simd<Val, Bits, Tag>& y);
+
+}}
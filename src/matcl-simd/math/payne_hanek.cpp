@@ -6,6 +6,24 @@
  *  This file is distributed under the BSD License. See LICENSE.txt for details.
  */
 
+// Payne-Hanek reduction is called by bulk functions for all instruction sets;
+// this file is compiled with /arch:SSE2 and must not use instructions from
+// later instruction sets
+
+#define MATCL_ARCHITECTURE_HAS_SSE2     1
+#define MATCL_ARCHITECTURE_HAS_SSE3     0
+#define MATCL_ARCHITECTURE_HAS_SSE41    0
+#define MATCL_ARCHITECTURE_HAS_SSE42    0
+#define MATCL_ARCHITECTURE_HAS_POPCNT   0
+#define MATCL_ARCHITECTURE_HAS_AVX      0
+#define MATCL_ARCHITECTURE_HAS_AVX2     0
+#define MATCL_ARCHITECTURE_HAS_FMA      0
+#define MATCL_ARCHITECTURE_HAS_LZCNT    0
+#define MATCL_ARCHITECTURE_HAS_BMI1     0
+#define MATCL_ARCHITECTURE_HAS_BMI2     0
+#define MATCL_ARCHITECTURE_HAS_AVX512F  0
+#define MATCL_ARCHITECTURE_HAS_AVX512DQ 0
+
 #include "matcl-simd/details/math/impl/payne_hanek.inl"
 
 namespace matcl { namespace simd { namespace details
@@ -22,6 +40,19 @@ const uint32_t two_by_pi_table::table[] =
     0xa9e39161, 0x5ee61b08, 0x6599855f, 
 };
 
+// 1368 bits of 2/pi stored in 24-bit blocks, preceded by 4 zero blocks
+const double two_by_pi_table::table_24[] = 
+{
+    0x000000, 0x000000, 0x000000, 0x000000, 0xa2f983, 0x6e4e44, 0x1529fc, 0x2757d1,
+    0xf534dd, 0xc0db62, 0x95993c, 0x439041, 0xfe5163, 0xabdebb, 0xc561b7, 0x246e3a,
+    0x424dd2, 0xe00649, 0x2eea09, 0xd1921c, 0xfe1deb, 0x1cb129, 0xa73ee8, 0x8235f5,
+    0x2ebb44, 0x84e99c, 0x7026b4, 0x5f7e41, 0x3991d6, 0x398353, 0x39f49c, 0x845f8b,
+    0xbdf928, 0x3b1ff8, 0x97ffde, 0x05980f, 0xef2f11, 0x8b5a0a, 0x6d1f6d, 0x367ecf,
+    0x27cb09, 0xb74f46, 0x3f669e, 0x5fea2d, 0x7527ba, 0xc7ebe5, 0xf17b3d, 0x0739f7,
+    0x8a5292, 0xea6bfb, 0x5fb11f, 0x8d5d08, 0x560330, 0x46fc7b, 0x6babf0, 0xcfbc20,
+    0x9af436, 0x1da9e3, 0x91615e, 0xe61b08, 0x659985, 
+};
+
 static const int max_blocks         = 10;
 static const int max_blocks_float   = 5;
 
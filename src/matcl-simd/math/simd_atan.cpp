@@ -0,0 +1,74 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/math/impl/simd_atan.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// polynomials interpolating P at Chebyshev nodes
+
+//-----------------------------------------------------------------------
+//                              DOUBLE
+//-----------------------------------------------------------------------
+const double atan_data<double>::poly_atan[] = 
+{
+    -3.3333333333333331e-01,
+    1.9999999999995521e-01,
+    -1.4285714284666456e-01,
+    1.1111111015249429e-01,
+    -9.0909045778422251e-02,
+    7.6921831842823835e-02,
+    -6.6645113552076196e-02,
+    5.8581481120851847e-02,
+    -5.0854455478168435e-02,
+    3.9231537245164469e-02,
+    -1.9176738872388188e-02,
+};
+
+const double atan_data<double>::poly_asin[] = 
+{
+    1.6666666666666669e-01,
+    7.4999999999984329e-02,
+    4.4642857146355429e-02,
+    3.0381944138531104e-02,
+    2.2372172942155863e-02,
+    1.7352392720724738e-02,
+    1.3971212975782122e-02,
+    1.1479177392743867e-02,
+    1.0322814500399046e-02,
+    5.4575060564513193e-03,
+    1.7400881289062885e-02,
+    -1.4851890021697409e-02,
+    2.8757853425713454e-02,
+};
+
+//-----------------------------------------------------------------------
+//                              FLOAT
+//-----------------------------------------------------------------------
+const float atan_data<float>::poly_atan[] = 
+{
+    -3.333328664e-01f,
+    1.999123693e-01f,
+    -1.402413845e-01f,
+    8.520470560e-02f,
+};
+
+const float atan_data<float>::poly_asin[] = 
+{
+    1.666666567e-01f,
+    7.500094175e-02f,
+    4.459940270e-02f,
+    3.110066243e-02f,
+    1.714923792e-02f,
+    3.369084746e-02f,
+};
+
+}}}
@@ -0,0 +1,290 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#include "matcl-simd/simd_dispatch.h"
+#include "matcl-simd/details/math/dispatch/bulk_kernels.h"
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#else
+    #include <cpuid.h>
+#endif
+
+#include <cstdint>
+
+namespace matcl { namespace simd { namespace details
+{
+
+//-------------------------------------------------------------------
+//                          cpu_features
+//-------------------------------------------------------------------
+class cpu_features
+{
+    private:
+        uint32_t    m_ecx_1;
+        uint32_t    m_ebx_7;
+        uint64_t    m_xcr0;
+
+    public:
+        cpu_features();
+
+        // widest instruction set supported by the processor and the operating
+        // system
+        instruction_set get_instruction_set() const;
+
+    private:
+        static void     cpuid(uint32_t leaf, uint32_t regs[4]);
+        static uint32_t max_leaf();
+        static uint64_t xgetbv();
+
+        static bool     test(uint32_t reg, int bit)     { return ((reg >> bit) & 1) != 0; };
+};
+
+cpu_features::cpu_features()
+    :m_ecx_1(0), m_ebx_7(0), m_xcr0(0)
+{
+    uint32_t regs[4];
+    uint32_t max    = max_leaf();
+
+    if (max >= 1)
+    {
+        cpuid(1, regs);
+        m_ecx_1     = regs[2];
+    };
+
+    if (max >= 7)
+    {
+        cpuid(7, regs);
+        m_ebx_7     = regs[1];
+    };
+
+    // OSXSAVE; the operating system saves extended registers
+    if (test(m_ecx_1, 27) == true)
+        m_xcr0      = xgetbv();
+};
+
+instruction_set cpu_features::get_instruction_set() const
+{
+    bool has_sse3       = test(m_ecx_1, 0);
+    bool has_ssse3      = test(m_ecx_1, 9);
+    bool has_sse41      = test(m_ecx_1, 19);
+    bool has_sse42      = test(m_ecx_1, 20);
+    bool has_popcnt     = test(m_ecx_1, 23);
+    bool has_fma        = test(m_ecx_1, 12);
+    bool has_avx        = test(m_ecx_1, 28);
+    bool has_bmi1       = test(m_ebx_7, 3);
+    bool has_avx2       = test(m_ebx_7, 5);
+    bool has_bmi2       = test(m_ebx_7, 8);
+    bool has_avx512f    = test(m_ebx_7, 16);
+    bool has_avx512dq   = test(m_ebx_7, 17);
+
+    // XMM and YMM state, and additionally opmask and ZMM state must be
+    // enabled by the operating system
+    bool os_ymm         = (m_xcr0 & 0x06) == 0x06;
+    bool os_zmm         = (m_xcr0 & 0xE6) == 0xE6;
+
+    // LZCNT is reported in extended leaf 0x80000001; all processors supporting
+    // AVX2 and BMI2 support LZCNT
+    bool level_sse41    = has_sse3 && has_ssse3 && has_sse41 && has_sse42
+                        && has_popcnt;
+    bool level_avx      = level_sse41 && has_avx && os_ymm;
+    bool level_avx2     = level_avx && has_avx2 && has_fma && has_bmi1 && has_bmi2;
+    bool level_avx512   = level_avx2 && has_avx512f && has_avx512dq && os_zmm;
+
+    if (level_avx512)
+        return instruction_set::avx512;
+    if (level_avx2)
+        return instruction_set::avx2;
+    if (level_avx)
+        return instruction_set::avx;
+    if (level_sse41)
+        return instruction_set::sse41;
+
+    // SSE2 is required on x64
+    return instruction_set::sse2;
+};
+
+#ifdef _MSC_VER
+
+void cpu_features::cpuid(uint32_t leaf, uint32_t regs[4])
+{
+    int info[4];
+    __cpuidex(info, (int)leaf, 0);
+
+    for (int i = 0; i < 4; ++i)
+        regs[i]     = (uint32_t)info[i];
+};
+
+uint32_t cpu_features::max_leaf()
+{
+    int info[4];
+    __cpuid(info, 0);
+    return (uint32_t)info[0];
+};
+
+uint64_t cpu_features::xgetbv()
+{
+    return _xgetbv(0);
+};
+
+#else
+
+void cpu_features::cpuid(uint32_t leaf, uint32_t regs[4])
+{
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+};
+
+uint32_t cpu_features::max_leaf()
+{
+    return __get_cpuid_max(0, nullptr);
+};
+
+uint64_t cpu_features::xgetbv()
+{
+    // xgetbv cannot be called through intrinsic without -mxsave flag
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+};
+
+#endif
+
+//-------------------------------------------------------------------
+//                          bulk_dispatcher
+//-------------------------------------------------------------------
+// dispatch table for all supported instruction sets and currently
+// selected instruction set
+class bulk_dispatcher
+{
+    private:
+        static const int
+        num_sets            = (int)instruction_set::avx512 + 1;
+
+    private:
+        instruction_set     m_detected;
+        instruction_set     m_selected;
+        bulk_function_table m_tables[num_sets];
+
+    public:
+        bulk_dispatcher();
+
+        static bulk_dispatcher& get();
+
+        instruction_set     detected() const    { return m_detected; };
+        instruction_set     selected() const    { return m_selected; };
+        instruction_set     select(instruction_set is);
+
+        const bulk_function_table&  table() const   { return m_tables[(int)m_selected]; };
+};
+
+bulk_dispatcher::bulk_dispatcher()
+{
+    m_detected      = cpu_features().get_instruction_set();
+    m_selected      = m_detected;
+
+    init_bulk_table_sse2(m_tables[(int)instruction_set::sse2]);
+    init_bulk_table_sse41(m_tables[(int)instruction_set::sse41]);
+
+    // integer simd instructions on 256-bit vectors require AVX2, therefore
+    // AVX without AVX2 uses SSE4.1 kernels
+    init_bulk_table_sse41(m_tables[(int)instruction_set::avx]);
+
+    init_bulk_table_avx2(m_tables[(int)instruction_set::avx2]);
+    init_bulk_table_avx512(m_tables[(int)instruction_set::avx512]);
+};
+
+bulk_dispatcher& bulk_dispatcher::get()
+{
+    static bulk_dispatcher g_instance;
+    return g_instance;
+};
+
+instruction_set bulk_dispatcher::select(instruction_set is)
+{
+    instruction_set old = m_selected;
+
+    if ((int)is > (int)m_detected)
+        is          = m_detected;
+
+    m_selected      = is;
+    return old;
+};
+
+force_inline
+const bulk_function_table& get_bulk_table()
+{
+    return bulk_dispatcher::get().table();
+};
+
+}}}
+
+namespace matcl { namespace simd
+{
+
+namespace ms = matcl::simd;
+namespace md = matcl::simd::details;
+
+instruction_set ms::detected_instruction_set()
+{
+    return md::bulk_dispatcher::get().detected();
+};
+
+instruction_set ms::dispatch_instruction_set()
+{
+    return md::bulk_dispatcher::get().selected();
+};
+
+instruction_set ms::set_dispatch_instruction_set(instruction_set is)
+{
+    return md::bulk_dispatcher::get().select(is);
+};
+
+#define MATCL_SIMD_DEFINE_BULK_FUNCTION(name)                                   \
+void ms::name(const double* in, double* out, size_t n)                          \
+{                                                                               \
+    md::get_bulk_table().func_double[(int)md::bulk_function::name](in, out, n); \
+};                                                                              \
+                                                                                \
+void ms::name(const float* in, float* out, size_t n)                            \
+{                                                                               \
+    md::get_bulk_table().func_float[(int)md::bulk_function::name](in, out, n);  \
+};
+
+MATCL_SIMD_DEFINE_BULK_FUNCTION(exp)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(log)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(sin)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(cos)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(tan)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(cot)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(sinh)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(cosh)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(tanh)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(sigmoid)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(softplus)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(sqrt)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(abs)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(round)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(floor)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(ceil)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(trunc)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(fraction)
+MATCL_SIMD_DEFINE_BULK_FUNCTION(exponent)
+
+#undef MATCL_SIMD_DEFINE_BULK_FUNCTION
+
+void ms::sincos(const double* in, double* out_sin, double* out_cos, size_t n)
+{
+    md::get_bulk_table().sincos_double(in, out_sin, out_cos, n);
+};
+
+void ms::sincos(const float* in, float* out_sin, float* out_cos, size_t n)
+{
+    md::get_bulk_table().sincos_float(in, out_sin, out_cos, n);
+};
+
+}}
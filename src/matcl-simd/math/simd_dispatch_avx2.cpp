@@ -0,0 +1,38 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+// bulk functions for AVX2 and FMA instruction sets; this file must be
+// compiled with /arch:AVX2
+
+#define MATCL_ARCHITECTURE_HAS_SSE2     1
+#define MATCL_ARCHITECTURE_HAS_SSE3     1
+#define MATCL_ARCHITECTURE_HAS_SSE41    1
+#define MATCL_ARCHITECTURE_HAS_SSE42    1
+#define MATCL_ARCHITECTURE_HAS_POPCNT   1
+#define MATCL_ARCHITECTURE_HAS_AVX      1
+#define MATCL_ARCHITECTURE_HAS_AVX2     1
+#define MATCL_ARCHITECTURE_HAS_FMA      1
+#define MATCL_ARCHITECTURE_HAS_LZCNT    1
+#define MATCL_ARCHITECTURE_HAS_BMI1     1
+#define MATCL_ARCHITECTURE_HAS_BMI2     1
+#define MATCL_ARCHITECTURE_HAS_AVX512F  0
+#define MATCL_ARCHITECTURE_HAS_AVX512DQ 0
+
+#define MATCL_SIMD_ISA_NAMESPACE        isa_avx2
+
+#include "matcl-simd/details/math/dispatch/bulk_kernels.inl"
+
+namespace matcl { namespace simd { namespace details
+{
+
+void init_bulk_table_avx2(bulk_function_table& table)
+{
+    init_bulk_table(table);
+};
+
+}}}
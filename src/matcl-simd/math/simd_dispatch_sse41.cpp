@@ -0,0 +1,39 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+// bulk functions for SSE2 - SSE4.2 instruction sets; this file must be
+// compiled with /arch:SSE2 (SSE4.1 intrinsics do not require
+// additional compiler flags)
+
+#define MATCL_ARCHITECTURE_HAS_SSE2     1
+#define MATCL_ARCHITECTURE_HAS_SSE3     1
+#define MATCL_ARCHITECTURE_HAS_SSE41    1
+#define MATCL_ARCHITECTURE_HAS_SSE42    1
+#define MATCL_ARCHITECTURE_HAS_POPCNT   1
+#define MATCL_ARCHITECTURE_HAS_AVX      0
+#define MATCL_ARCHITECTURE_HAS_AVX2     0
+#define MATCL_ARCHITECTURE_HAS_FMA      0
+#define MATCL_ARCHITECTURE_HAS_LZCNT    0
+#define MATCL_ARCHITECTURE_HAS_BMI1     0
+#define MATCL_ARCHITECTURE_HAS_BMI2     0
+#define MATCL_ARCHITECTURE_HAS_AVX512F  0
+#define MATCL_ARCHITECTURE_HAS_AVX512DQ 0
+
+#define MATCL_SIMD_ISA_NAMESPACE        isa_sse41
+
+#include "matcl-simd/details/math/dispatch/bulk_kernels.inl"
+
+namespace matcl { namespace simd { namespace details
+{
+
+void init_bulk_table_sse41(bulk_function_table& table)
+{
+    init_bulk_table(table);
+};
+
+}}}
@@ -0,0 +1,170 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/math/impl/simd_erf.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// poly_erf and poly_erfc interpolate at Chebyshev nodes; coefficients of
+// inverse normal cdf approximations are given in increasing order
+
+//-----------------------------------------------------------------------
+//                              DOUBLE
+//-----------------------------------------------------------------------
+const double erf_data<double>::poly_erf[] = 
+{
+    1.1283791670955126e+00,
+    -3.7612638903183476e-01,
+    1.1283791670925353e-01,
+    -2.6866170632887928e-02,
+    5.2239773730214699e-03,
+    -8.5482977536749665e-04,
+    1.2053335124353741e-04,
+    -1.4845849259707869e-05,
+    1.4725865480556744e-06,
+};
+
+const double erf_data<double>::poly_erfc[] = 
+{
+    1.2530080582697296e+00,
+    -1.3562110612458117e-01,
+    -4.7562294353450871e-02,
+    1.2964515870276061e-01,
+    -1.1927366341530699e-01,
+    6.8308027343978478e-02,
+    -2.3770514918645888e-02,
+    2.5293918160662391e-03,
+    1.8886903591561553e-03,
+    -7.7983227210839912e-04,
+    -1.0515979981501177e-04,
+    1.2509935235563107e-04,
+    4.9494849925705948e-06,
+    -2.0100567931289227e-05,
+    -7.3151051641590624e-07,
+    3.4724146028756862e-06,
+    3.5683839153992204e-07,
+    -6.1664960776043527e-07,
+    -1.4160064940265987e-07,
+    1.0187000600072885e-07,
+    4.1807846988455821e-08,
+    -1.3326364813003832e-08,
+    -8.5003979297726153e-09,
+    9.8857988311393651e-10,
+    8.8642190164270926e-10,
+};
+
+const double erf_data<double>::poly_inv_nom[] = 
+{
+    2.506628277459239e+00,
+    -3.066479806614716e+01,
+    1.383577518672690e+02,
+    -2.759285104469687e+02,
+    2.209460984245205e+02,
+    -3.969683028665376e+01,
+};
+
+const double erf_data<double>::poly_inv_den[] = 
+{
+    1.000000000000000e+00,
+    -1.328068155288572e+01,
+    6.680131188771972e+01,
+    -1.556989798598866e+02,
+    1.615858368580409e+02,
+    -5.447609879822406e+01,
+};
+
+const double erf_data<double>::poly_inv_tail_nom[] = 
+{
+    2.938163982698783e+00,
+    4.374664141464968e+00,
+    -2.549732539343734e+00,
+    -2.400758277161838e+00,
+    -3.223964580411365e-01,
+    -7.784894002430293e-03,
+};
+
+const double erf_data<double>::poly_inv_tail_den[] = 
+{
+    1.000000000000000e+00,
+    3.754408661907416e+00,
+    2.445134137142996e+00,
+    3.224671290700398e-01,
+    7.784695709041462e-03,
+};
+
+//-----------------------------------------------------------------------
+//                              FLOAT
+//-----------------------------------------------------------------------
+const float erf_data<float>::poly_erf[] = 
+{
+    1.128379107e+00f,
+    -3.761260808e-01f,
+    1.128283143e-01f,
+    -2.675773203e-02f,
+    4.719082732e-03f,
+};
+
+const float erf_data<float>::poly_erfc[] = 
+{
+    1.253008008e+00f,
+    -1.356211007e-01f,
+    -4.756215587e-02f,
+    1.296447217e-01f,
+    -1.192752793e-01f,
+    6.831319630e-02f,
+    -2.376355976e-02f,
+    2.506778575e-03f,
+    1.875060261e-03f,
+    -7.340820739e-04f,
+    -9.253768803e-05f,
+    8.007454744e-05f,
+};
+
+const float erf_data<float>::poly_inv_nom[] = 
+{
+    2.506628277e+00f,
+    -3.066479807e+01f,
+    1.383577519e+02f,
+    -2.759285104e+02f,
+    2.209460984e+02f,
+    -3.969683029e+01f,
+};
+
+const float erf_data<float>::poly_inv_den[] = 
+{
+    1.000000000e+00f,
+    -1.328068155e+01f,
+    6.680131189e+01f,
+    -1.556989799e+02f,
+    1.615858369e+02f,
+    -5.447609880e+01f,
+};
+
+const float erf_data<float>::poly_inv_tail_nom[] = 
+{
+    2.938163983e+00f,
+    4.374664141e+00f,
+    -2.549732539e+00f,
+    -2.400758277e+00f,
+    -3.223964580e-01f,
+    -7.784894002e-03f,
+};
+
+const float erf_data<float>::poly_inv_tail_den[] = 
+{
+    1.000000000e+00f,
+    3.754408662e+00f,
+    2.445134137e+00f,
+    3.224671291e-01f,
+    7.784695709e-03f,
+};
+
+}}}
@@ -148,4 +148,22 @@ const double exp_table_double::exp_poly[4] =
     4.166666666666664815314859891569042e-02,
 };
 
+const double exp_table_double::expm1_poly[14] =
+{
+    5.000000000000000000000000000000000e-01,
+    1.666666666666666666666666666666667e-01,
+    4.166666666666666666666666666666667e-02,
+    8.333333333333333333333333333333333e-03,
+    1.388888888888888888888888888888889e-03,
+    1.984126984126984126984126984126984e-04,
+    2.480158730158730158730158730158730e-05,
+    2.755731922398589065255731922398589e-06,
+    2.755731922398589065255731922398589e-07,
+    2.505210838544171877505210838544172e-08,
+    2.087675698786809897921009032120143e-09,
+    1.605904383682161459939237717015495e-10,
+    1.147074559772972471385169797868211e-11,
+    7.647163731819816475901131985788075e-13,
+};
+
 }}}
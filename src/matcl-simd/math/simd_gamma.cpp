@@ -0,0 +1,125 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/math/impl/simd_gamma.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// polynomials interpolating P at Chebyshev nodes
+
+//-----------------------------------------------------------------------
+//                              DOUBLE
+//-----------------------------------------------------------------------
+const double gamma_data<double>::poly_lgamma[] = 
+{
+    4.2278433509846713e-01,
+    3.2246703342411320e-01,
+    -6.7352301053195632e-02,
+    2.0580808427783381e-02,
+    -7.3855510289355447e-03,
+    2.8905103308659009e-03,
+    -1.1927539009983087e-03,
+    5.0966951965266728e-04,
+    -2.2315497746292723e-04,
+    9.9457616921571330e-05,
+    -4.4923727564247656e-05,
+    2.0506019701747618e-05,
+    -9.4562885151017197e-06,
+    4.3828545383846665e-06,
+    -1.9743106888421067e-06,
+    9.2428522251622768e-07,
+    -5.8112777689212464e-07,
+    2.7475390051909663e-07,
+};
+
+const double gamma_data<double>::poly_stirling[] = 
+{
+    8.3333333333333301e-02,
+    -2.7777777776062441e-03,
+    7.9365066494882519e-04,
+    -5.9520259518027125e-04,
+    8.3728345120713359e-04,
+    -1.6526004455595122e-03,
+};
+
+const double gamma_data<double>::poly_digamma[] = 
+{
+    1.4265838140477494e+00,
+    3.1561474410964213e-01,
+    -6.2813694920299784e-02,
+    1.7935099659918786e-02,
+    -5.9218363728970307e-03,
+    2.1055245446859176e-03,
+    -7.8088241680240086e-04,
+    2.9713869922032369e-04,
+    -1.1492336176934886e-04,
+    4.4925108689132856e-05,
+    -1.7694365857968033e-05,
+    7.0001151657727176e-06,
+    -2.7450207352098608e-06,
+    1.0920124980993670e-06,
+    -5.1758163215570996e-07,
+    2.0651639995273113e-07,
+};
+
+const double gamma_data<double>::poly_digamma_asym[] = 
+{
+    8.3333333333332871e-02,
+    -8.3333333311685579e-03,
+    3.9682523428416190e-03,
+    -4.1662176506968417e-03,
+    7.5190882307470952e-03,
+    -1.7711160415846534e-02,
+};
+
+//-----------------------------------------------------------------------
+//                              FLOAT
+//-----------------------------------------------------------------------
+const float gamma_data<float>::poly_lgamma[] = 
+{
+    4.227843285e-01f,
+    3.224670291e-01f,
+    -6.735229492e-02f,
+    2.058162540e-02f,
+    -7.385920733e-03f,
+    2.878868720e-03f,
+    -1.187484828e-03f,
+    5.702512572e-04f,
+    -2.505620359e-04f,
+};
+
+const float gamma_data<float>::poly_stirling[] = 
+{
+    8.333333582e-02f,
+    -2.777698450e-03f,
+    7.800346939e-04f,
+};
+
+const float gamma_data<float>::poly_digamma[] = 
+{
+    1.426583767e+00f,
+    3.156147301e-01f,
+    -6.281417608e-02f,
+    1.793528907e-02f,
+    -5.912202410e-03f,
+    2.101755468e-03f,
+    -8.415319026e-04f,
+    3.208627168e-04f,
+};
+
+const float gamma_data<float>::poly_digamma_asym[] = 
+{
+    8.333333582e-02f,
+    -8.332783356e-03f,
+    3.873588284e-03f,
+};
+
+}}}
@@ -0,0 +1,38 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/math/impl/simd_pow.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// polynomial interpolating Q at Chebyshev nodes; the absolute error is
+// dominated by rounding of the first coefficient
+const double pow_log_data<double>::poly[]   =  
+{
+    4.00000000000000022e-01,
+    2.85714285714293637e-01,
+    2.22222222216558851e-01,
+    1.81818183353928020e-01,
+    1.53845949625184303e-01,
+    1.33348046938473103e-01,
+    1.17062363394912064e-01,
+    1.17231786238765179e-01,
+};
+
+const float pow_log_data<float>::poly[] = 
+{
+    4.000000060e-01f,
+    2.857153118e-01f,
+    2.220476270e-01f,
+    1.912045479e-01f,
+};
+
+}}}
@@ -0,0 +1,42 @@
+/*
+ *  This file is a part of MATCL-SIMD Library
+ *
+ *  Copyright (c) Pawel Kowal 2017 - 2023
+ *
+ *  This file is distributed under the BSD License. See LICENSE.txt for details.
+ */
+
+#pragma once
+
+#include "matcl-simd/details/math/impl/simd_root.h"
+
+namespace matcl { namespace simd { namespace details
+{
+
+// polynomials interpolating cbrt at Chebyshev nodes
+
+//-----------------------------------------------------------------------
+//                              DOUBLE
+//-----------------------------------------------------------------------
+const double root_data<double>::poly_cbrt[] = 
+{
+    4.0419051145445400e-01,
+    1.1298206132233120e+00,
+    -9.3324615255646692e-01,
+    5.2751899326750640e-01,
+    -1.2829009991928064e-01,
+};
+
+//-----------------------------------------------------------------------
+//                              FLOAT
+//-----------------------------------------------------------------------
+const float root_data<float>::poly_cbrt[] = 
+{
+    4.041905105e-01f,
+    1.129820585e+00f,
+    -9.332461357e-01f,
+    5.275189877e-01f,
+    -1.282901019e-01f,
+};
+
+}}}
@@ -10,6 +10,11 @@
 
 #include "test_simd_config.h"
 #include "matcl-simd/math_functions.h"
+#include "matcl-simd/basic_complex_functions.h"
+#include "matcl-simd/simd_dispatch.h"
+
+#include <cstring>
+#include <vector>
 
 namespace test_functions
 {
@@ -84,6 +89,40 @@ struct make_zero<ms::simd<T,Bits, Tag>>
     }
 };
 
+// conversion between simd_compl and simd_compl_split types; simd_compl_split
+// vector stores twice as many elements as corresponding simd_compl vector
+template<class T>
+struct split_helper{};
+
+template<class Val, int Bits, class Tag>
+struct split_helper<ms::simd_compl<Val, Bits, Tag>>
+{
+    using simd_type     = ms::simd_compl<Val, Bits, Tag>;
+    using split_type    = ms::simd_compl_split<Val, Bits, Tag>;
+    using value_type    = typename simd_type::value_type;
+
+    static const int vec_size   = simd_type::vector_size;
+
+    // split vector storing [lo, hi]
+    static split_type make(const simd_type& lo, const simd_type& hi)
+    {
+        value_type arr[2 * vec_size];
+        lo.store(arr);
+        hi.store(arr + vec_size);
+
+        return split_type::load(arr);
+    }
+
+    // first vec_size elements of x
+    static simd_type extract_low(const split_type& x)
+    {
+        value_type arr[2 * vec_size];
+        x.store(arr);
+
+        return simd_type::load(arr);
+    }
+};
+
 // missing scalar functions
 template<class T>
 inline T reverse(const T& x)    { return x; };
@@ -267,6 +306,30 @@ struct test_cast<ms::simd<double, 256, Tag>>
     }
 };
 
+template<class Tag>
+struct test_cast<ms::simd<double, 512, Tag>>
+{
+    using simd_type = ms::simd<double, 512, Tag>;
+
+    static simd_type eval(const simd_type& x)
+    {
+        auto xf = x.convert_to_float();
+
+        return simd_type(xf.convert_low_to_double(), xf.convert_high_to_double());
+    };
+
+    static simd_type eval_int32(const simd_type& x)
+    {
+        auto xi = x.convert_to_int32();
+        return simd_type(xi.convert_low_to_double(), xi.convert_high_to_double());
+    }
+    static simd_type eval_int64(const simd_type& x)
+    {
+        auto xi = x.convert_to_int64();
+        return xi.convert_to_double();
+    }
+};
+
 template<int Bits, class Tag>
 struct test_cast<ms::simd_compl<float, Bits, Tag>>
 {
@@ -464,6 +527,31 @@ struct test_cast<ms::simd<int64_t, 256, Tag>>
     }
 };
 
+template<class Tag>
+struct test_cast<ms::simd<int64_t, 512, Tag>>
+{
+    using simd_type = ms::simd<int64_t, 512, Tag>;
+
+    static simd_type eval(const simd_type& x)
+    {
+        auto xf = x.convert_to_int32();
+
+        return simd_type(xf.convert_low_to_int64(), xf.convert_high_to_int64());
+    };
+
+    static simd_type eval_float(const simd_type& x)
+    {
+        auto xf = x.convert_to_float();
+        return simd_type(xf.convert_low_to_int64(), xf.convert_high_to_int64());
+    }
+
+    static simd_type eval_double(const simd_type& x)
+    {
+        auto xd = x.convert_to_double();
+        return xd.convert_to_int64();
+    }
+};
+
 struct Func_reverse
 {    
     template<class T>    
@@ -968,6 +1056,82 @@ struct Func_pow2ki_int64<float>
     };
 };
 
+template<class Val>
+struct Func_powi_int32
+{};
+
+template<>
+struct Func_powi_int32<float>
+{
+    template<int Bits, class Tag>    
+    force_inline matcl::simd::simd<float, Bits, Tag> 
+    eval(const matcl::simd::simd<int32_t, Bits, Tag>& x) const
+    { 
+        using simd_type = matcl::simd::simd<float, Bits, Tag>;
+        return powi(simd_type(1.25f), x); 
+    }
+
+    static std::string name()
+    { 
+        return "powi_int32"; 
+    };
+};
+
+template<>
+struct Func_powi_int32<double>
+{
+    template<int Bits, class Tag>    
+    force_inline matcl::simd::simd<double, Bits, Tag> 
+    eval(const matcl::simd::simd<int32_t, Bits, Tag>& x) const
+    { 
+        (void)x;
+        return matcl::simd::simd<double, Bits, Tag>::zero();
+    }
+
+    static std::string name()
+    { 
+        return "powi_int32"; 
+    };
+};
+
+template<class Val>
+struct Func_powi_int64
+{};
+
+template<>
+struct Func_powi_int64<double>
+{
+    template<int Bits, class Tag>    
+    force_inline matcl::simd::simd<double, Bits, Tag> 
+    eval(const matcl::simd::simd<int64_t, Bits, Tag>& x) const
+    { 
+        using simd_type = matcl::simd::simd<double, Bits, Tag>;
+        return powi(simd_type(1.25), x); 
+    }
+
+    static std::string name()
+    { 
+        return "powi_int64"; 
+    };
+};
+
+template<>
+struct Func_powi_int64<float>
+{
+    template<int Bits, class Tag>    
+    force_inline matcl::simd::simd<float, Bits, Tag> 
+    eval(const matcl::simd::simd<int64_t, Bits, Tag>& x) const
+    { 
+        (void)x;
+        return matcl::simd::simd<float, Bits, Tag>::zero();
+    }
+
+    static std::string name()
+    { 
+        return "powi_int64"; 
+    };
+};
+
 struct Func_pow2k
 {  
     template<class T>    
@@ -996,6 +1160,34 @@ struct Func_conj
     };
 };
 
+struct Func_arg
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return T(arg(x)); 
+    }
+
+    static std::string name()
+    { 
+        return "arg"; 
+    };
+};
+
+struct Func_cis
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return cis(x); 
+    }
+
+    static std::string name()
+    { 
+        return "cis"; 
+    };
+};
+
 struct Func_abs
 {
     template<class T>    
@@ -1004,6 +1196,12 @@ struct Func_abs
         return abs(x); 
     }
 
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::abs(in, out, n); 
+    }
+
     static std::string name()
     { 
         return "abs"; 
@@ -1074,6 +1272,12 @@ struct Func_sqrt
         return sqrt(x); 
     }
 
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::sqrt(in, out, n); 
+    }
+
     static std::string name()
     { 
         return "sqrt"; 
@@ -1094,146 +1298,821 @@ struct Func_exp
         return std::exp(x); 
     }
 
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::exp(in, out, n); 
+    }
+
     static std::string name()
     { 
         return "exp"; 
     };
 };
 
-struct Func_sin
+struct Func_exp2
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return sin(x); 
+        return exp2(x); 
     }
 
     template<class T>    
     force_inline static T eval_base(const T& x)
     { 
-        return std::sin(x); 
+        return std::exp2(x); 
     }
 
     static std::string name()
     { 
-        return "sin"; 
+        return "exp2"; 
     };
 };
 
-struct Func_cos
+struct Func_exp10
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return cos(x); 
+        return exp10(x); 
     }
 
     template<class T>    
     force_inline static T eval_base(const T& x)
     { 
-        return std::cos(x); 
+        return std::pow(T(10), x); 
     }
 
     static std::string name()
     { 
-        return "cos"; 
+        return "exp10"; 
     };
 };
 
-struct Func_tan
+struct Func_expm1
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return tan(x); 
+        return expm1(x); 
     }
 
     template<class T>    
     force_inline static T eval_base(const T& x)
     { 
-        return std::tan(x); 
+        return std::expm1(x); 
     }
 
     static std::string name()
     { 
-        return "tan"; 
+        return "expm1"; 
     };
 };
 
-struct Func_cot
+struct Func_sin
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return cot(x); 
+        return sin(x); 
     }
 
     template<class T>    
     force_inline static T eval_base(const T& x)
     { 
-        return T(1) / std::tan(x); 
+        return std::sin(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::sin(in, out, n); 
     }
 
     static std::string name()
     { 
-        return "cot"; 
+        return "sin"; 
     };
 };
 
-struct Func_log
+struct Func_cos
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return log(x); 
+        return cos(x); 
     }
 
     template<class T>    
     force_inline static T eval_base(const T& x)
     { 
-        return std::log(x); 
+        return std::cos(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::cos(in, out, n); 
     }
 
     static std::string name()
     { 
-        return "log"; 
+        return "cos"; 
     };
 };
 
-struct Func_fraction
+struct Func_sincos_sin
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return fraction(x); 
+        T s, c;
+        sincos(x, s, c);
+        return s; 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::sin(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        std::vector<T> out_cos(n);
+        ms::sincos(in, out, out_cos.data(), n); 
     }
 
     static std::string name()
     { 
-        return "fraction"; 
+        return "sincos_s"; 
     };
 };
 
-struct Func_iexponent
+struct Func_sincos_cos
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return cast<T>::eval(iexponent(x)); 
+        T s, c;
+        sincos(x, s, c);
+        return c; 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::cos(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        std::vector<T> out_sin(n);
+        ms::sincos(in, out_sin.data(), out, n); 
     }
 
     static std::string name()
     { 
-        return "iexponent"; 
+        return "sincos_c"; 
     };
 };
 
-struct Func_exponent
+struct Func_tan
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return tan(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::tan(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::tan(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "tan"; 
+    };
+};
+
+struct Func_cot
 {
     template<class T>    
     force_inline static T eval(const T& x)
     { 
-        return exponent(x); 
+        return cot(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return T(1) / std::tan(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::cot(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "cot"; 
+    };
+};
+
+struct Func_log
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return log(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::log(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::log(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "log"; 
+    };
+};
+
+struct Func_log2
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return log2(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::log2(x); 
+    }
+
+    static std::string name()
+    { 
+        return "log2"; 
+    };
+};
+
+struct Func_log10
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return log10(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::log10(x); 
+    }
+
+    static std::string name()
+    { 
+        return "log10"; 
+    };
+};
+
+struct Func_log1p
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return log1p(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::log1p(x); 
+    }
+
+    static std::string name()
+    { 
+        return "log1p"; 
+    };
+};
+
+struct Func_atan
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return atan(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::atan(x); 
+    }
+
+    static std::string name()
+    { 
+        return "atan"; 
+    };
+};
+
+struct Func_asin
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return asin(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::asin(x); 
+    }
+
+    static std::string name()
+    { 
+        return "asin"; 
+    };
+};
+
+struct Func_acos
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return acos(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::acos(x); 
+    }
+
+    static std::string name()
+    { 
+        return "acos"; 
+    };
+};
+
+struct Func_sinh
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return sinh(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::sinh(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::sinh(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "sinh"; 
+    };
+};
+
+struct Func_cosh
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return cosh(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::cosh(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::cosh(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "cosh"; 
+    };
+};
+
+struct Func_tanh
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return tanh(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::tanh(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::tanh(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "tanh"; 
+    };
+};
+
+struct Func_sigmoid
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return sigmoid(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return T(1) / (T(1) + std::exp(-x)); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::sigmoid(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "sigmoid"; 
+    };
+};
+
+struct Func_softplus
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return softplus(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::max(x, T(0)) + std::log1p(std::exp(-std::abs(x))); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::softplus(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "softplus"; 
+    };
+};
+
+struct Func_erf
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return erf(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::erf(x); 
+    }
+
+    static std::string name()
+    { 
+        return "erf"; 
+    };
+};
+
+struct Func_erfc
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return erfc(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::erfc(x); 
+    }
+
+    static std::string name()
+    { 
+        return "erfc"; 
+    };
+};
+
+struct Func_normcdf
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return normcdf(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return T(0.5) * std::erfc(-x / std::sqrt(T(2))); 
+    }
+
+    static std::string name()
+    { 
+        return "normcdf"; 
+    };
+};
+
+struct Func_norminv
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return norminv(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return norminv_base(x); 
+    }
+
+    // rational approximation by P. J. Acklam, relative error 1.15e-9
+    template<class T>    
+    static T norminv_base(const T& p)
+    {
+        static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02,
+                                   -2.759285104469687e+02, 1.383577518672690e+02,
+                                   -3.066479806614716e+01, 2.506628277459239e+00};
+        static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02,
+                                   -1.556989798598866e+02, 6.680131188771972e+01,
+                                   -1.328068155288572e+01};
+        static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01,
+                                   -2.400758277161838e+00, -2.549732539343734e+00,
+                                    4.374664141464968e+00,  2.938163982698783e+00};
+        static const double d[] = { 7.784695709041462e-03,  3.224671290700398e-01,
+                                    2.445134137142996e+00,  3.754408661907416e+00};
+
+        double q    = double(p) - 0.5;
+
+        if (std::abs(q) <= 0.47575)
+        {
+            double r    = q * q;
+            double nom  = (((((a[0]*r + a[1])*r + a[2])*r + a[3])*r + a[4])*r + a[5]) * q;
+            double den  = ((((b[0]*r + b[1])*r + b[2])*r + b[3])*r + b[4])*r + 1.0;
+            return T(nom / den);
+        };
+
+        double pm   = (q > 0) ? 1.0 - double(p) : double(p);
+        double s    = std::sqrt(-2.0 * std::log(pm));
+        double nom  = ((((c[0]*s + c[1])*s + c[2])*s + c[3])*s + c[4])*s + c[5];
+        double den  = (((d[0]*s + d[1])*s + d[2])*s + d[3])*s + 1.0;
+        double x    = nom / den;
+
+        return T((q > 0) ? -x : x);
+    };
+
+    static std::string name()
+    { 
+        return "norminv"; 
+    };
+};
+
+struct Func_rcp
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return rcp(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return T(1) / x; 
+    }
+
+    static std::string name()
+    { 
+        return "rcp"; 
+    };
+};
+
+struct Func_rsqrt
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return rsqrt(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return T(1) / std::sqrt(x); 
+    }
+
+    static std::string name()
+    { 
+        return "rsqrt"; 
+    };
+};
+
+struct Func_cbrt
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return cbrt(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::cbrt(x); 
+    }
+
+    static std::string name()
+    { 
+        return "cbrt"; 
+    };
+};
+
+struct Func_lgamma
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return lgamma(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::lgamma(x); 
+    }
+
+    static std::string name()
+    { 
+        return "lgamma"; 
+    };
+};
+
+struct Func_tgamma
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return tgamma(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return std::tgamma(x); 
+    }
+
+    static std::string name()
+    { 
+        return "tgamma"; 
+    };
+};
+
+struct Func_digamma
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return digamma(x); 
+    }
+
+    template<class T>    
+    force_inline static T eval_base(const T& x)
+    { 
+        return digamma_base(x); 
+    }
+
+    // recurrence and asymptotic expansion
+    template<class T>    
+    static T digamma_base(const T& x0)
+    {
+        double x    = double(x0);
+        double res  = 0.0;
+
+        if (x < 0.0)
+        {
+            const double pi = 3.14159265358979323846;
+            res     = -1.0 / x - pi / std::tan(pi * x);
+            x       = -x;
+        };
+
+        for (; x < 10.0; x += 1.0)
+            res     -= 1.0 / x;
+
+        double w    = 1.0 / (x * x);
+        double p    = w * (1.0/12.0 - w * (1.0/120.0 - w * (1.0/252.0 - w / 240.0)));
+        res         += std::log(x) - 0.5 / x - p;
+
+        return T(res);
+    };
+
+    static std::string name()
+    { 
+        return "digamma"; 
+    };
+};
+
+struct Func_fraction
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return fraction(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::fraction(in, out, n); 
+    }
+
+    static std::string name()
+    { 
+        return "fraction"; 
+    };
+};
+
+struct Func_iexponent
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return cast<T>::eval(iexponent(x)); 
+    }
+
+    static std::string name()
+    { 
+        return "iexponent"; 
+    };
+};
+
+struct Func_exponent
+{
+    template<class T>    
+    force_inline static T eval(const T& x)
+    { 
+        return exponent(x); 
+    }
+
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::exponent(in, out, n); 
     }
 
     static std::string name()
@@ -1250,6 +2129,12 @@ struct Func_round
         return round(x); 
     }
 
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::round(in, out, n); 
+    }
+
     static std::string name()
     { 
         return "round"; 
@@ -1264,6 +2149,12 @@ struct Func_floor
         return floor(x); 
     }
     
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::floor(in, out, n); 
+    }
+
     static std::string name()
     { 
         return "floor"; 
@@ -1278,6 +2169,12 @@ struct Func_ceil
         return ceil(x); 
     }
     
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::ceil(in, out, n); 
+    }
+
     static std::string name() 
     { 
         return "ceil"; 
@@ -1292,6 +2189,12 @@ struct Func_trunc
         return trunc(x); 
     }
     
+    template<class T>    
+    static void eval_bulk(const T* in, T* out, size_t n)
+    { 
+        ms::trunc(in, out, n); 
+    }
+
     static std::string name()
     { 
         return "trunc"; 
@@ -1382,6 +2285,64 @@ struct Func_div_CR
     };
 };
 
+struct Func_mult_fast
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        return ms::mult<ms::compl_fast>(x1, x2); 
+    }
+
+    static std::string name()
+    { 
+        return "mult fast"; 
+    };
+};
+
+struct Func_div_fast
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        return ms::div<ms::compl_fast>(x1, x2); 
+    }
+
+    static std::string name()
+    { 
+        return "div fast"; 
+    };
+};
+
+struct Func_split_mult
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        using helper    = split_helper<T>;
+        return helper::extract_low(helper::make(x1, x2) * helper::make(x2, x1));
+    }
+
+    static std::string name()
+    { 
+        return "mult split"; 
+    };
+};
+
+struct Func_split_div
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        using helper    = split_helper<T>;
+        return helper::extract_low(helper::make(x1, x2) / helper::make(x2, x1));
+    }
+
+    static std::string name()
+    { 
+        return "div split"; 
+    };
+};
+
 struct Func_plus
 {
     template<class T>    
@@ -1452,6 +2413,48 @@ struct Func_min
     };
 };
 
+struct Func_pow
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        return pow(x1, x2); 
+    }
+
+    static std::string name()
+    { 
+        return "pow"; 
+    };
+};
+
+struct Func_atan2
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        return atan2(x1, x2); 
+    }
+
+    static std::string name()
+    { 
+        return "atan2"; 
+    };
+};
+
+struct Func_hypot
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2)
+    { 
+        return hypot(x1, x2); 
+    }
+
+    static std::string name()
+    { 
+        return "hypot"; 
+    };
+};
+
 struct Func_eeq
 {
     template<class T>    
@@ -1579,6 +2582,36 @@ struct Func_if_then_else
     };
 };
 
+struct Func_if_then_else_mask
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2, const T& x3)
+    { 
+        auto cond   = gt_mask(x1, T::zero());
+        return if_then_else(cond, x2, x3); 
+    }
+
+    static std::string name()
+    { 
+        return "if_mask"; 
+    };
+};
+
+struct Func_if_add_mask
+{
+    template<class T>    
+    force_inline static T eval(const T& x1, const T& x2, const T& x3)
+    { 
+        auto cond   = gt_mask(x1, T::zero());
+        return if_sub(!cond, if_add(cond, x2, x3), x3); 
+    }
+
+    static std::string name()
+    { 
+        return "if_add_m"; 
+    };
+};
+
 struct Func_fnma_f
 {
     template<class T>    
@@ -1749,6 +2782,31 @@ struct Func_if_nan_else
     };
 };
 
+// indices of select functions for 512-bit vectors; index lists are
+// also used to compute reference results (see test_block_512)
+template<int ... I>
+struct test_select_index
+{
+    static int get(int k)
+    {
+        static const int index[] = {I...};
+        return index[k];
+    };
+
+    template<class Simd_type>
+    force_inline static Simd_type eval(const Simd_type& x)
+    {
+        return x.template select<I...>();
+    };
+};
+
+// select index list for 32-bit (Index_32) or 64-bit (Index_64) elements
+template<class Val, class Index_32, class Index_64>
+struct test_select_512
+{
+    using type  = typename std::conditional<sizeof(Val) == 4, Index_32, Index_64>::type;
+};
+
 struct Func_select_1
 {
     template<class Tag>    
@@ -1806,6 +2864,18 @@ struct Func_select_1
         return x.select<0,1,2,3>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15>;
+    using index_512_64  = test_select_index<0,1,2,3,4,5,6,7>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 1"; 
@@ -1870,6 +2940,18 @@ struct Func_select_2
         return x.select<3,2,1,0>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0>;
+    using index_512_64  = test_select_index<7,6,5,4,3,2,1,0>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 2"; 
@@ -1934,6 +3016,18 @@ struct Func_select_3
         return x.select<2,3,0,1>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<8,9,10,11,12,13,14,15,0,1,2,3,4,5,6,7>;
+    using index_512_64  = test_select_index<4,5,6,7,0,1,2,3>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 3"; 
@@ -1998,6 +3092,18 @@ struct Func_select_4
         return x.select<0,1,1,0>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<0,1,2,3,4,5,6,7,7,6,5,4,3,2,1,0>;
+    using index_512_64  = test_select_index<0,1,2,3,3,2,1,0>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 4"; 
@@ -2062,6 +3168,18 @@ struct Func_select_5
         return x.select<2,3,3,2>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<8,9,10,11,12,13,14,15,15,14,13,12,11,10,9,8>;
+    using index_512_64  = test_select_index<4,5,6,7,7,6,5,4>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 5"; 
@@ -2126,6 +3244,18 @@ struct Func_select_6
         return x.select<0,1,3,2>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<7,6,5,4,3,2,1,0,8,9,10,11,12,13,14,15>;
+    using index_512_64  = test_select_index<3,2,1,0,4,5,6,7>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 6"; 
@@ -2190,6 +3320,18 @@ struct Func_select_7
         return x.select<1,1,3,3>(); 
     }
 
+    // 512-bit vectors
+    using index_512_32  = test_select_index<2,2,3,3,6,6,7,7,10,10,11,11,14,14,15,15>;
+    using index_512_64  = test_select_index<1,1,3,3,5,5,7,7>;
+
+    template<class Val, class Tag>    
+    force_inline static 
+    ms::simd<Val, 512, Tag> eval(const ms::simd<Val, 512, Tag>& x)
+    { 
+        using index = typename test_select_512<Val, index_512_32, index_512_64>::type;
+        return index::eval(x); 
+    }
+
     static std::string name()
     { 
         return "select 7"; 
@@ -2636,4 +3778,248 @@ struct Func_combine_11
     };
 };
 
+//-----------------------------------------------------------------------
+//                      512-BIT REFERENCE
+//-----------------------------------------------------------------------
+// rules for assembling 512-bit results from results for the low and the
+// high part; by default Func is applied to both parts independently
+template<class Func>
+struct test_block_512_elem
+{
+    template<class Simd_type>
+    static void combine_512(const Simd_type& lo, const Simd_type& hi, Simd_type& res_lo,
+                            Simd_type& res_hi)
+    {
+        res_lo  = Func::eval(lo);
+        res_hi  = Func::eval(hi);
+    };
+};
+
+// horizontal reductions; results for both parts are reduced using Op
+template<class Func, class Op>
+struct test_block_512_reduce
+{
+    template<class Simd_type>
+    static void combine_512(const Simd_type& lo, const Simd_type& hi, Simd_type& res_lo,
+                            Simd_type& res_hi)
+    {
+        auto val    = Op::eval(Func::eval(lo).first(), Func::eval(hi).first());
+
+        res_lo      = Simd_type(val);
+        res_hi      = Simd_type(val);
+    };
+};
+
+struct test_op_plus
+{
+    template<class T>
+    static T eval(const T& x, const T& y)    { return x + y; };
+};
+
+struct test_op_min
+{
+    template<class T>
+    static T eval(const T& x, const T& y)    { return (x < y) ? x : y; };
+};
+
+struct test_op_max
+{
+    template<class T>
+    static T eval(const T& x, const T& y)    { return (x < y) ? y : x; };
+};
+
+// select functions; indices are given by Func::index_512_32 and 
+// Func::index_512_64
+template<class Func>
+struct test_block_512_select
+{
+    template<class Simd_type>
+    static void combine_512(const Simd_type& lo, const Simd_type& hi, Simd_type& res_lo,
+                            Simd_type& res_hi)
+    {
+        using value_type    = typename Simd_type::value_type;
+        using index         = typename test_select_512<value_type, typename Func::index_512_32,
+                                typename Func::index_512_64>::type;
+
+        static const int vec_size   = Simd_type::vector_size;
+
+        value_type x[2 * vec_size];
+        value_type res[2 * vec_size];
+
+        lo.store(x, std::false_type());
+        hi.store(x + vec_size, std::false_type());
+
+        for (int i = 0; i < 2 * vec_size; ++i)
+            res[i]  = x[index::get(i)];
+
+        res_lo      = Simd_type::load(res, std::false_type());
+        res_hi      = Simd_type::load(res + vec_size, std::false_type());
+    };
+};
+
+template<class Func>
+struct test_block_512_func : test_block_512_elem<Func>
+{};
+
+template<>
+struct test_block_512_func<Func_hor_sum> : test_block_512_reduce<Func_hor_sum, test_op_plus>
+{};
+
+template<>
+struct test_block_512_func<Func_hor_min> : test_block_512_reduce<Func_hor_min, test_op_min>
+{};
+
+template<>
+struct test_block_512_func<Func_hor_max> : test_block_512_reduce<Func_hor_max, test_op_max>
+{};
+
+// any and all return 1 or 0
+template<>
+struct test_block_512_func<Func_any> : test_block_512_reduce<Func_any, test_op_max>
+{};
+
+template<>
+struct test_block_512_func<Func_any_nan> : test_block_512_reduce<Func_any_nan, test_op_max>
+{};
+
+template<>
+struct test_block_512_func<Func_all> : test_block_512_reduce<Func_all, test_op_min>
+{};
+
+template<>
+struct test_block_512_func<Func_reverse>
+{
+    template<class Simd_type>
+    static void combine_512(const Simd_type& lo, const Simd_type& hi, Simd_type& res_lo,
+                            Simd_type& res_hi)
+    {
+        res_lo  = reverse(hi);
+        res_hi  = reverse(lo);
+    };
+};
+
+// the low or the high part is copied to both parts
+template<>
+struct test_block_512_func<Func_extract_low>
+{
+    template<class Simd_type>
+    static void combine_512(const Simd_type& lo, const Simd_type& hi, Simd_type& res_lo,
+                            Simd_type& res_hi)
+    {
+        (void)hi;
+        res_lo  = lo;
+        res_hi  = lo;
+    };
+};
+
+template<>
+struct test_block_512_func<Func_extract_high>
+{
+    template<class Simd_type>
+    static void combine_512(const Simd_type& lo, const Simd_type& hi, Simd_type& res_lo,
+                            Simd_type& res_hi)
+    {
+        (void)lo;
+        res_lo  = hi;
+        res_hi  = hi;
+    };
+};
+
+template<> struct test_block_512_func<Func_select_1> : test_block_512_select<Func_select_1>{};
+template<> struct test_block_512_func<Func_select_2> : test_block_512_select<Func_select_2>{};
+template<> struct test_block_512_func<Func_select_3> : test_block_512_select<Func_select_3>{};
+template<> struct test_block_512_func<Func_select_4> : test_block_512_select<Func_select_4>{};
+template<> struct test_block_512_func<Func_select_5> : test_block_512_select<Func_select_5>{};
+template<> struct test_block_512_func<Func_select_6> : test_block_512_select<Func_select_6>{};
+template<> struct test_block_512_func<Func_select_7> : test_block_512_select<Func_select_7>{};
+
+// reference results of block functions for 512-bit vectors; simd types
+// with 512 bits are not defined for nosimd_tag, therefore results are
+// assembled from results for 256-bit nosimd vectors storing the low and
+// the high part of a 512-bit vector; by default Func is applied to both
+// parts independently; size must be a multiple of the 512-bit vector size
+template<class Func>
+struct test_block_512
+{
+    template<class T>
+    static void eval(int size, const T* in, T* out)
+    {
+        using simd_256  = ms::simd<T, 256, ms::nosimd_tag>;
+
+        static const int vec_size   = simd_256::vector_size;
+
+        for (int i = 0; i < size; i += 2 * vec_size)
+        {
+            simd_256 lo     = simd_256::load(in + i, std::false_type());
+            simd_256 hi     = simd_256::load(in + i + vec_size, std::false_type());
+
+            simd_256 res_lo, res_hi;
+            test_block_512_func<Func>::combine_512(lo, hi, res_lo, res_hi);
+
+            res_lo.store(out + i, std::false_type());
+            res_hi.store(out + i + vec_size, std::false_type());
+        };
+    };
+};
+
+// test load_partial and store_partial for all n = 0, 1, ..., vector_size;
+// elements n, n+1, ... of a vector returned by load_partial must be zero
+// and store_partial must write the first n elements and must not modify
+// guard_size elements stored before and after them; elements of in must
+// be different than sentinel; returns number of values of n for which
+// the test fails
+template<class Simd_type>
+struct test_partial
+{
+    using value_type    = typename Simd_type::value_type;
+
+    static const int
+    vec_size            = Simd_type::vector_size;
+
+    static const int
+    guard_size          = 4;
+
+    static int eval(const value_type* in, const value_type& sentinel)
+    {
+        static const int buf_size   = vec_size + 2 * guard_size;
+
+        value_type zero     = Simd_type::zero().first();
+        value_type buf[buf_size];
+
+        Simd_type x         = Simd_type::load(in, std::false_type());
+        int num_fail        = 0;
+
+        for (int n = 0; n <= vec_size; ++n)
+        {
+            bool ok         = true;
+            Simd_type y     = Simd_type::load_partial(in, n);
+
+            for (int i = 0; i < vec_size; ++i)
+                ok          = ok && equal(y.get(i), (i < n) ? in[i] : zero);
+
+            for (int i = 0; i < buf_size; ++i)
+                buf[i]      = sentinel;
+
+            x.store_partial(buf + guard_size, n);
+
+            for (int i = 0; i < buf_size; ++i)
+            {
+                int pos     = i - guard_size;
+                ok          = ok && equal(buf[i], (pos >= 0 && pos < n) ? in[pos] : sentinel);
+            };
+
+            if (ok == false)
+                ++num_fail;
+        };
+
+        return num_fail;
+    };
+
+    // bitwise comparison; nan values can be compared
+    static bool equal(const value_type& x, const value_type& y)
+    {
+        return std::memcmp(&x, &y, sizeof(value_type)) == 0;
+    };
+};
+
 }
@@ -12,8 +12,17 @@
 
 #include "matcl-simd/simd.h"
 #include "matcl-simd/simd_math.h"
+#include "matcl-simd/accurate_sum.h"
+#include "matcl-simd/poly/poly_eval_twofold.h"
+#include "matcl-simd/poly/poly_eval.h"
+#include "matcl-simd/simd_divider.h"
+#include "matcl-simd/details/math/impl/payne_hanek_simd.h"
 #include "test_functions.h"
 #include <vector>
+#include <cmath>
+#include <random>
+#include <limits>
+#include <random>
 
 namespace matcl { namespace test
 {
@@ -29,6 +38,13 @@ void test::test_performance_real()
     test_simd(false).make_unary_int();
     test_simd(false).make_ternary();
     test_simd(false).make_binary();
+    test_simd(false).make_bulk();
+    test_simd(false).make_accurate_sum();
+    test_simd(false).make_poly_compensated();
+    test_simd(false).make_poly_series();
+    test_simd(false).make_poly_const();
+    test_simd(false).make_poly_multi();
+    test_simd(false).make_int_divide();
 };
 
 void test::test_values_real()
@@ -40,6 +56,16 @@ void test::test_values_real()
     test_simd(true).make_ternary();        
     test_simd(false).make_unary_int();
     test_simd(true).make_binary();        
+    test_simd(true).make_bulk();
+    test_simd(false).make_partial();
+    test_simd(false).make_trig_special();
+    test_simd(false).make_reduction();
+    test_simd(false).make_accurate_sum();
+    test_simd(false).make_poly_compensated();
+    test_simd(false).make_poly_series();
+    test_simd(false).make_poly_const();
+    test_simd(false).make_poly_multi();
+    test_simd(false).make_int_divide();
 };
 
 template<class T>
@@ -107,6 +133,18 @@ void test_simd::make_unary_math()
     test_functions_math<double>();    
 };
 
+void test_simd::make_trig_special()
+{
+    test_functions_trig_special<float>();
+    test_functions_trig_special<double>();    
+};
+
+void test_simd::make_reduction()
+{
+    test_functions_reduction<float>();
+    test_functions_reduction<double>();    
+};
+
 void test_simd::make_select()
 {
     test_functions_select<float>(); 
@@ -123,6 +161,8 @@ void test_simd::make_unary_int()
 {
     test_functions_int<float>();   
     test_functions_int<double>();     
+    test_functions_powi_special<float>();
+    test_functions_powi_special<double>();
 };
 
 void test_simd::make_binary()
@@ -137,6 +177,56 @@ void test_simd::make_ternary()
     test_functions_3<float>();    
 };
 
+void test_simd::make_bulk()
+{
+    test_functions_bulk<double>();
+    test_functions_bulk<float>();
+};
+
+void test_simd::make_partial()
+{
+    test_functions_partial<double>();
+    test_functions_partial<float>();
+};
+
+void test_simd::make_accurate_sum()
+{
+    test_functions_accurate_sum<double>();
+    test_functions_accurate_sum<float>();
+    test_functions_repro_sum<double>();
+    test_functions_repro_sum<float>();
+};
+
+void test_simd::make_poly_compensated()
+{
+    test_functions_poly_compensated<double>();
+    test_functions_poly_compensated<float>();
+};
+
+void test_simd::make_poly_series()
+{
+    test_functions_poly_series<double>();
+    test_functions_poly_series<float>();
+};
+
+void test_simd::make_poly_const()
+{
+    test_functions_poly_const<double>();
+    test_functions_poly_const<float>();
+};
+
+void test_simd::make_poly_multi()
+{
+    test_functions_poly_multi<double>();
+    test_functions_poly_multi<float>();
+};
+
+void test_simd::make_int_divide()
+{
+    test_functions_int_divide<int32_t>();
+    test_functions_int_divide<int64_t>();
+};
+
 template<class T, class Simd_type, class Func>
 double test_simd::test_function_simd(int size, int n_rep, const T* in, T* out)
 {
@@ -163,6 +253,23 @@ double test_simd::test_function_simd(int size, int n_rep, const T* in, T* out)
     return t;
 };
 
+template<class T, class Func>
+double test_simd::test_function_bulk_eval(int size, int n_rep, const T* in, T* out)
+{
+    tic();
+
+    volatile T val = 0;
+
+    for(int j = 0; j < n_rep; ++j)
+    {
+        Func::eval_bulk(in, out, size);
+        val += out[0];
+    };
+
+    double t = toc();
+    return t;
+};
+
 template<class T, class Func>
 double test_simd::test_function_std(int size, int n_rep, const T* in, T* out)
 {
@@ -307,9 +414,9 @@ template<class T, class Func>
 void test_simd::test_function(formatted_disp& fd, int size, const T* in, T* out, T* out_gen, 
                         bool check_nans)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v2, v3, v4, v5;
-    double d1, d2, d3, d4, d5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v2, v3, v4, v5, v6;
+    double d1, d2, d3, d4, d5, d6;
 
     t0  = test_function_simd<T, ms::simd<T, 128, ms::nosimd_tag>, Func>(size, 1, in, out_gen);
 
@@ -334,7 +441,16 @@ void test_simd::test_function(formatted_disp& fd, int size, const T* in, T* out,
         d5  = 0;
     #endif
 
-    bool ok = v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out);    
+        v6  = test_equal(size, out, out_gen, 1.0, d6, check_nans);
+    #else
+        t6  = t0;
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -351,17 +467,27 @@ void test_simd::test_function(formatted_disp& fd, int size, const T* in, T* out,
         t5 = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(N, M, in, out);    
+    #else
+        t6 = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
 void test_simd::test_function_math(formatted_disp& fd, int size, const T* in, T* out, T* out_gen, 
                                 bool check_nans)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v0, v1, v2, v3, v4, v5;
-    double d0, d1, d2, d3, d4, d5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v0, v1, v2, v3, v4, v5, v6;
+    double d0, d1, d2, d3, d4, d5, d6;
 
     t0  = test_function_mat_ref<T, Func>(size, 1, in, out_gen);
 
@@ -389,7 +515,16 @@ void test_simd::test_function_math(formatted_disp& fd, int size, const T* in, T*
         d5  = 0;
     #endif
 
-    bool ok = v0 && v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out);    
+        v6  = test_equal(size, out, out_gen, 1.0, d6, check_nans);
+    #else
+        t6  = t0;
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v0 && v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -406,17 +541,207 @@ void test_simd::test_function_math(formatted_disp& fd, int size, const T* in, T*
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(N, M, in, out);    
+    #else
+        t6  = t0;
+    #endif
+
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
+};
+
+template<class T, class Func>
+void test_simd::test_function_special(formatted_disp& fd, int size, const T* in, T* out, 
+                                      T* out_gen)
+{
+    double d1, d2, d3, d4, d5, d6;
+    bool v1, v2, v3, v4, v5, v6;
+
+    test_function_std<T, Func>(size, 1, in, out_gen);
+
+    test_function_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>(size, 1, in, out);
+    v1  = test_equal(size, out, out_gen, 1.0, d1, true);
+
+    test_function_simd<T, simd::simd<T, 256, simd::nosimd_tag>, Func>(size, 1, in, out);
+    v2  = test_equal(size, out, out_gen, 1.0, d2, true);
+
+    test_function_simd<T, simd::simd<T, 128, simd::sse_tag>, Func>(size, 1, in, out);    
+    v3  = test_equal(size, out, out_gen, 1.0, d3, true);
+
+    test_function_simd<T, simd::simd<T, 256, simd::sse_tag>, Func>(size, 1, in, out);
+    v4  = test_equal(size, out, out_gen, 1.0, d4, true);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        test_function_simd<T, simd::simd<T, 256, simd::avx_tag>, Func>(size, 1, in, out);    
+        v5  = test_equal(size, out, out_gen, 1.0, d5, true);
+    #else
+        v5  = true;
+        d5  = 0;
+    #endif
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out);    
+        v6  = test_equal(size, out, out_gen, 1.0, d6, true);
+    #else
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
+
+    // distances in ulp instead of timings
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), d1, d2, d3, d4, d5, d6, status);
+    #else
+        fd.disp_row(Func::name(), d1, d2, d3, d4, d5, status);
+    #endif
+};
+
+template<class T, int Bits, class Tag>
+bool test_simd::test_reduction(int size, const double* in, double& dist)
+{
+    using simd_type     = simd::simd<double, Bits, Tag>;
+    using payne_hanek   = simd::details::payne_hanek_simd<Bits, Tag>;
+
+    static const bool is_float  = std::is_same<T, float>::value;
+    static const int vec_size   = simd_type::vector_size;
+
+    bool ok         = true;
+    dist            = 0.0;
+
+    for (int i = 0; i < size; i += vec_size)
+    {
+        simd_type x     = simd_type::load(in + i, std::false_type());
+        simd_type q, value, error;
+
+        if (is_float == true)
+            q           = payne_hanek::eval_float(x, value);
+        else
+            q           = payne_hanek::eval(x, value, error);
+
+        const double* ptr_q     = q.get_raw_ptr();
+        const double* ptr_val   = value.get_raw_ptr();
+
+        for (int j = 0; j < vec_size; ++j)
+        {
+            // scalar reduction from payne_hanek.cpp
+            double value_gen, error_gen;
+            int q_gen;
+
+            if (is_float == true)
+                q_gen   = simd::reduce_pi2_ph_float(in[i + j], 30, value_gen);
+            else
+                q_gen   = simd::reduce_pi2_ph(in[i + j], value_gen, error_gen);
+
+            double loc_dist;
+            bool eq_q   = (int(ptr_q[j]) & 3) == q_gen;
+            bool eq_v   = test_equal(T(ptr_val[j]), T(value_gen), 1.0, loc_dist, true);
+
+            ok          = ok && eq_q && eq_v;
+            dist        = std::max(dist, loc_dist);
+        };
+    };
+
+    return ok;
+};
+
+template<class T>
+void test_simd::test_reduction_row(formatted_disp& fd, const std::string& name, int size, 
+                                   const double* in)
+{
+    double d1, d2, d3, d4, d5, d6;
+    bool v1, v2, v3, v4, v5, v6;
+
+    v1  = test_reduction<T, 128, simd::nosimd_tag>(size, in, d1);
+    v2  = test_reduction<T, 256, simd::nosimd_tag>(size, in, d2);
+    v3  = test_reduction<T, 128, simd::sse_tag>(size, in, d3);
+    v4  = test_reduction<T, 256, simd::sse_tag>(size, in, d4);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        v5  = test_reduction<T, 256, simd::avx_tag>(size, in, d5);
+    #else
+        v5  = true;
+        d5  = 0;
+    #endif
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        v6  = test_reduction<T, 512, simd::avx512_tag>(size, in, d6);
+    #else
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
+
+    // distances in ulp instead of timings
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(name, d1, d2, d3, d4, d5, d6, status);
+    #else
+        fd.disp_row(name, d1, d2, d3, d4, d5, status);
+    #endif
+};
+
+template<class T, class Func>
+void test_simd::test_function_bulk(formatted_disp& fd, int size, const T* in, T* out, T* out_gen, 
+                                bool check_nans)
+{
+    using simd_scalar   = typename simd::default_scalar_simd_type<T>::type;
+
+    test_function_simd<T, simd_scalar, Func>(size, 1, in, out_gen);
+
+    // misaligned arrays and lengths not divisible by vector size
+    bool ok     = true;
+    double dist;
+
+    for (int off = 0; off < 16; ++off)
+    {
+        int n   = size - off - off % 5;
+
+        for (int i = 0; i < size; ++i)
+            out[i]  = T(0);
+
+        Func::eval_bulk(in + off, out + off, n);
+
+        ok      = ok && test_equal(n, out + off, out_gen + off, 1.0, dist, check_nans);
+
+        for (int i = off + n; i < size; ++i)
+            ok  = ok && (out[i] == T(0));
+    };
+
+    int N       = get_size_perf();
+    int M       = get_num_rep();
+
+    double t[6];
+    t[0]        = test_function_simd<T, ms::simd<T, 128, ms::nosimd_tag>, Func>(N, M, in, out_gen);
+
+    simd::instruction_set is_old = simd::dispatch_instruction_set();
+
+    for (int i = 0; i <= (int)simd::instruction_set::avx512; ++i)
+    {
+        simd::set_dispatch_instruction_set((simd::instruction_set)i);
+        t[i + 1]    = test_function_bulk_eval<T, Func>(N, M, in, out);
+    };
+
+    simd::set_dispatch_instruction_set(is_old);
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    fd.disp_row(Func::name(), t[0], t[0]/t[1], t[0]/t[2], t[0]/t[3], t[0]/t[4], t[0]/t[5], status);
 };
 
 template<class T, class T_int, class Func>
 void test_simd::test_function_int(formatted_disp& fd, int size, const T_int* in, T* out, T* out_gen,
                                 const Func& func)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v3, v4, v5;
-    double d1, d3, d4, d5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v3, v4, v5, v6;
+    double d1, d3, d4, d5, d6;
 
     t0  = test_function_simd_int<T, T_int, ms::simd<T, 128, ms::nosimd_tag>, Func>(size, 1, in, out_gen, func);
 
@@ -440,7 +765,16 @@ void test_simd::test_function_int(formatted_disp& fd, int size, const T_int* in,
         d5  = 0;
     #endif
 
-    bool ok = v1 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd_int<T, T_int, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out, func);    
+        v6  = test_equal(size, out, out_gen, 1.0, d6, true);
+    #else
+        t6  = t0;
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v1 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -457,17 +791,27 @@ void test_simd::test_function_int(formatted_disp& fd, int size, const T_int* in,
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd_int<T, T_int, simd::simd<T, 512, simd::avx512_tag>, Func>(N, M, in, out, func);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
 void test_simd::test_function_bin(formatted_disp& fd, int size, const T* in_1, 
                                   const T* in_2, T* out, T* out_gen)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v2, v3, v4, v5;
-    double d1, d2, d3, d4, d5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v2, v3, v4, v5, v6;
+    double d1, d2, d3, d4, d5, d6;
 
     t0  = test_function_bin_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>(size, 1, in_1, in_2, out_gen);
 
@@ -492,7 +836,16 @@ void test_simd::test_function_bin(formatted_disp& fd, int size, const T* in_1,
         d5  = 0;
     #endif
 
-    bool ok = v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_bin_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in_1, in_2, out);    
+        v6  = test_equal(size, out, out_gen, 1.0, d6, true);
+    #else
+        t6  = t0;
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -515,8 +868,19 @@ void test_simd::test_function_bin(formatted_disp& fd, int size, const T* in_1,
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_bin_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (N, M, in_1, in_2, out);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
@@ -555,9 +919,9 @@ template<class T, class Func>
 void test_simd::test_function_3(formatted_disp& fd, int size, const T* in_1, 
                                const T* in_2, const T* in_3, T* out, T* out_gen)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v2, v3, v4, v5;
-    double d1, d2, d3, d4, d5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v2, v3, v4, v5, v6;
+    double d1, d2, d3, d4, d5, d6;
 
     t0  = test_function_3_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>
                 (size, 1, in_1, in_2, in_3, out_gen);
@@ -588,7 +952,17 @@ void test_simd::test_function_3(formatted_disp& fd, int size, const T* in_1,
         d5  = 0;
     #endif
 
-    bool ok = v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_3_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                    (size, 1, in_1, in_2, in_3, out);    
+        v6  = test_equal(size, out, out_gen, 1.0, d6, true);
+    #else
+        t6  = t0;
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -611,17 +985,28 @@ void test_simd::test_function_3(formatted_disp& fd, int size, const T* in_1,
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_3_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (N, M, in_1, in_2, in_3, out);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
 void test_simd::test_function_block(formatted_disp& fd, int size, const T* in, 
                                     T* out, T* out_gen, bool check_nans)
 {
-    double t0, t1, t2, t3, t4;
-    bool v1, v3, v4;
-    double d1, d3, d4;
+    double t0, t1, t2, t3, t4, t5;
+    bool v1, v3, v4, v5;
+    double d1, d3, d4, d5;
 
     t0  = test_function_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>(size, 1, in, out_gen);
 
@@ -642,7 +1027,18 @@ void test_simd::test_function_block(formatted_disp& fd, int size, const T* in,
         d4  = 0;
     #endif
 
-    bool ok = v1 && v3 && v4;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        test_functions::test_block_512<Func>::eval(size, in, out_gen);
+
+        t5  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out);    
+        v5  = test_equal(size, out, out_gen, 4.0, d5, check_nans);
+    #else
+        t5  = t0;
+        v5  = true;
+        d5  = 0;
+    #endif
+
+    bool ok = v1 && v3 && v4 && v5;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -663,14 +1059,27 @@ void test_simd::test_function_block(formatted_disp& fd, int size, const T* in,
         t4  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t5  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (N, M, in, out);    
+    #else
+        t5  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t0, t0/t2, t0/t1, t0/t3, t0/t4, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t0, t0/t2, t0/t1, t0/t3, t0/t4, t0/t5, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t0, t0/t2, t0/t1, t0/t3, t0/t4, status);
+    #endif
 };
 
 int test_simd::get_size() const
 {
+    // sizes must be multiples of the number of elements of the
+    // longest vector (16 for 512-bit vectors of float and int32)
     #ifdef _DEBUG
-        int N   = 1000;
+        int N   = 1024;
     #else
         int N   = 10000;
     #endif
@@ -687,7 +1096,7 @@ int test_simd::get_size() const
 
 int test_simd::get_size_perf() const
 {
-    return 1000;
+    return 1024;
 }
 
 int test_simd::get_num_rep() const
@@ -738,6 +1147,11 @@ void test_simd::test_functions()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -822,6 +1236,11 @@ void test_simd::test_functions_select()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -869,6 +1288,11 @@ void test_simd::test_functions_math()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -876,8 +1300,13 @@ void test_simd::test_functions_math()
     test_function_math<T, test_functions::Func_tan>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
     test_function_math<T, test_functions::Func_cot>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
     test_function_math<T, test_functions::Func_exp>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);     
+    test_function_math<T, test_functions::Func_exp2>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_exp10>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_expm1>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
     test_function_math<T, test_functions::Func_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
     test_function_math<T, test_functions::Func_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_sincos_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_sincos_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
     test_function<T, test_functions::Func_fraction>(dm, N, ptr_in, ptr_out, ptr_out_gen, true); 
     test_function<T, test_functions::Func_iexponent>(dm, N, ptr_in, ptr_out, ptr_out_gen, true); 
     test_function<T, test_functions::Func_exponent>(dm, N, ptr_in, ptr_out, ptr_out_gen, true); 
@@ -887,51 +1316,62 @@ void test_simd::test_functions_math()
     
     test_function<T, test_functions::Func_sqrt>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
     test_function_math<T, test_functions::Func_log>(dm, N, ptr_in, ptr_out, ptr_out_gen, true); 
+    test_function_math<T, test_functions::Func_log2>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_log10>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_log1p>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_atan>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_asin>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_acos>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_sinh>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_cosh>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_tanh>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_sigmoid>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_softplus>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_erf>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_erfc>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_normcdf>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_norminv>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_rcp>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_rsqrt>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_cbrt>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_lgamma>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_tgamma>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_math<T, test_functions::Func_digamma>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
 };
 
 template<class T>
-void test_simd::test_functions_int()
+void test_simd::test_functions_trig_special()
 {
-    int N           = get_size();
-    int max_int     = 32;
+    const T inf     = std::numeric_limits<T>::infinity();
+    const T nan     = std::numeric_limits<T>::quiet_NaN();
+    const T max     = std::numeric_limits<T>::max();
+    const T min     = std::numeric_limits<T>::min();
 
-    std::vector<int32_t> in_32;
-    std::vector<int64_t> in_64;
-    std::vector<T> in_t;
+    // non-finite values and huge values reduced by the Payne-Hanek algorithm;
+    // each vector contains special and random values
+    const T special[]   = {inf, -inf, nan, -nan, max, -max, T(1e30), T(-1e30), 
+                           T(1e10), T(-1e10), T(421657429.0), T(-421657429.0), 
+                           T(0.0), T(-0.0), min, T(1.0)};
+
+    static const int num_special    = sizeof(special) / sizeof(special[0]);
+    static const int N              = 4 * num_special;
+
+    std::vector<T> in;
     std::vector<T> out;
     std::vector<T> out_gen;
-    std::vector<T> arg;
 
-    in_32.resize(N);
-    in_64.resize(N);
-    in_t.resize(N);
+    in.resize(N);
     out.resize(N);
     out_gen.resize(N);
-    arg.resize(2*max_int + 1);
-
-    int32_t* ptr_in_32  = in_32.data();
-    int64_t* ptr_in_64  = in_64.data();
-    T* ptr_in_t         = in_t.data();
 
+    T* ptr_in       = in.data();
     T* ptr_out      = out.data();
-    T* ptr_out_gen  = out_gen.data();    
-    T* arg_ptr      = arg.data();
-
-    for (int i = 0; i < N; ++i)
-        ptr_in_32[i]   = rand_scalar<int32_t>::make(m_test_values) % max_int;
-
-    for (int i = 0; i < N; ++i)
-        ptr_in_64[i]   = rand_scalar<int64_t>::make(m_test_values) % max_int;
+    T* ptr_out_gen  = out_gen.data();
 
     for (int i = 0; i < N; ++i)
-        ptr_in_t[i]   = T(rand_scalar<int32_t>::make(m_test_values) % max_int);
-
-    for (int i = 0; i < max_int*2 + 1; ++i)
-        arg_ptr[i]  = rand_scalar<T>::make(false);
-
-    arg_ptr         = arg_ptr + max_int;
+        ptr_in[i]   = (i % 4 == 0) ? special[i / 4] : rand_scalar<T>::make(false);
 
-    std::string header  = m_instr_tag + " " + typeid(T).name();
+    std::string header  = m_instr_tag + " trig special " + typeid(T).name();
 
     disp(" ");
     disp(header);
@@ -939,28 +1379,1341 @@ void test_simd::test_functions_int()
     formatted_disp dm;
 
     dm.set_row_label("func",    align_type::right, 10);
-    dm.add_column("nosimd",     align_type::left, 5);
     dm.add_column("128 no",     align_type::left, 5);
     dm.add_column("256 no",     align_type::left, 5);
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
 
-    test_function_int<T, int32_t, test_functions::Func_gather_int32<T>>(dm, N, ptr_in_32, ptr_out, ptr_out_gen,
-                                                test_functions::Func_gather_int32<T>(arg_ptr));
-    test_function_int<T, int64_t, test_functions::Func_gather_int64<T>>(dm, N, ptr_in_64, ptr_out, ptr_out_gen,
+    test_function_special<T, test_functions::Func_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_special<T, test_functions::Func_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_special<T, test_functions::Func_sincos_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_special<T, test_functions::Func_sincos_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+};
+
+template<class T>
+void test_simd::test_functions_reduction()
+{
+    static const bool is_float  = std::is_same<T, float>::value;
+    static const int N          = 64;
+
+    // arguments are stored as doubles; for float all values are representable
+    // in single precision as required by payne_hanek_simd::eval_float
+    const double pi2        = 1.5707963267948966192313216916398;
+
+    // the worst cases for the argument reduction: x closest to a multiple of
+    // pi/2 among all finite numbers of given type; the fractional part of x * 2/pi
+    // is scaled by 2^j when x is multiplied by 2^j
+    const double hard       = is_float ? std::ldexp(16367173.0, 72) 
+                                       : std::ldexp(6381956970095103.0, 797);
+
+    // largest j such that hard * 2^j is below 1e38 for float and 1e300 for double
+    const int max_j         = is_float ? 30 : 147;
+    const int max_exp       = is_float ? 126 : 1022;
+
+    std::mt19937_64 gen(16807);
+    std::uniform_real_distribution<double> dist_mant(1.0, 2.0);
+    std::uniform_int_distribution<int> dist_exp(0, max_exp);
+    std::uniform_int_distribution<int> dist_k(1, 1 << 20);
+
+    std::vector<double> in_rand;
+    std::vector<double> in_mult;
+    std::vector<double> in_hard;
+
+    in_rand.resize(N);
+    in_mult.resize(N);
+    in_hard.resize(N);
+
+    for (int i = 0; i < N; ++i)
+    {
+        double sign     = (i % 2 == 0) ? 1.0 : -1.0;
+
+        // random values of all magnitudes
+        double x        = std::ldexp(dist_mant(gen), dist_exp(gen));
+        in_rand[i]      = sign * double(T(x));
+
+        // fl(k * pi/2) is close to k * pi/2 for moderate k
+        x               = double(dist_k(gen)) * pi2;
+        in_mult[i]      = sign * double(T(x));
+
+        // hard case and its neighbors scaled up to 1e300 (double) or 1e38 (float)
+        int j           = (i / 2) * max_j / (N / 2 - 1);
+        x               = std::ldexp(hard, j);
+
+        if (i % 4 == 1)
+            x           = double(std::nextafter(T(x), std::numeric_limits<T>::max()));
+        else if (i % 4 == 3)
+            x           = double(std::nextafter(T(x), T(0.0)));
+
+        in_hard[i]      = sign * x;
+    };
+
+    std::string header  = m_instr_tag + " pi/2 reduction " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("args",    align_type::right, 10);
+    dm.add_column("128 no",     align_type::left, 5);
+    dm.add_column("256 no",     align_type::left, 5);
+    dm.add_column("128 sse",    align_type::left, 5);
+    dm.add_column("256 sse",    align_type::left, 5);
+    dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    test_reduction_row<T>(dm, "random", N, in_rand.data());
+    test_reduction_row<T>(dm, "k*pi/2", N, in_mult.data());
+    test_reduction_row<T>(dm, "hard*2^j", N, in_hard.data());
+};
+
+template<class T>
+void test_simd::test_functions_bulk()
+{
+    int N   = get_size();
+
+    std::vector<T> in;
+    std::vector<T> out;
+    std::vector<T> out_gen;
+
+    in.resize(N);
+    out.resize(N);
+    out_gen.resize(N);
+
+    T* ptr_in       = in.data();
+    T* ptr_out      = out.data();
+    T* ptr_out_gen  = out_gen.data();
+
+    for (int i = 0; i < N; ++i)
+        ptr_in[i]   = rand_scalar<T>::make(m_test_values);
+
+    std::string header  = m_instr_tag + " bulk " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",    align_type::right, 10);
+    dm.add_column("base",       align_type::left, 5);
+    dm.add_column("sse2",       align_type::left, 5);
+    dm.add_column("sse41",      align_type::left, 5);
+    dm.add_column("avx",        align_type::left, 5);
+    dm.add_column("avx2",       align_type::left, 5);
+    dm.add_column("avx512",     align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    test_function_bulk<T, test_functions::Func_tan>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_cot>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_sinh>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_cosh>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_tanh>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_sigmoid>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_softplus>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_exp>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_sincos_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_sincos_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_abs>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_round>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_floor>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_ceil>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_trunc>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_fraction>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_exponent>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+
+    for (int i = 0; i < N; ++i)
+        ptr_in[i]   = std::abs(ptr_in[i]);
+
+    test_function_bulk<T, test_functions::Func_sqrt>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+    test_function_bulk<T, test_functions::Func_log>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);
+};
+
+template<class T>
+void test_simd::test_functions_partial()
+{
+    static const int N  = 16;
+
+    // nonzero values different than the sentinel
+    T in[N];
+
+    for (int i = 0; i < N; ++i)
+        in[i]           = T(i + 1) / T(3);
+
+    const T sentinel    = std::numeric_limits<T>::quiet_NaN();
+
+    std::string header  = m_instr_tag + " partial " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",        align_type::right, 10);
+    dm.add_column("128 scal no",    align_type::left, 5);
+    dm.add_column("128 scal sse",   align_type::left, 5);
+    dm.add_column("128 no",         align_type::left, 5);
+    dm.add_column("256 no",         align_type::left, 5);
+    dm.add_column("128 sse",        align_type::left, 5);
+    dm.add_column("256 sse",        align_type::left, 5);
+    dm.add_column("256 avx",        align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
+    dm.add_column("status",         align_type::left, 5);
+
+    dm.disp_header();
+
+    // number of failed tests for n = 0, ..., vector_size
+    int e1  = test_functions::test_partial<simd::simd<T, 128, simd::scalar_nosimd_tag>>::eval(in, sentinel);
+    int e2  = test_functions::test_partial<simd::simd<T, 128, simd::scalar_sse_tag>>::eval(in, sentinel);
+    int e3  = test_functions::test_partial<simd::simd<T, 128, simd::nosimd_tag>>::eval(in, sentinel);
+    int e4  = test_functions::test_partial<simd::simd<T, 256, simd::nosimd_tag>>::eval(in, sentinel);
+    int e5  = test_functions::test_partial<simd::simd<T, 128, simd::sse_tag>>::eval(in, sentinel);
+    int e6  = test_functions::test_partial<simd::simd<T, 256, simd::sse_tag>>::eval(in, sentinel);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        int e7  = test_functions::test_partial<simd::simd<T, 256, simd::avx_tag>>::eval(in, sentinel);
+    #else
+        int e7  = 0;
+    #endif
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        int e8  = test_functions::test_partial<simd::simd<T, 512, simd::avx512_tag>>::eval(in, sentinel);
+    #else
+        int e8  = 0;
+    #endif
+
+    bool ok = (e1 + e2 + e3 + e4 + e5 + e6 + e7 + e8) == 0;
+
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.disp_row("load/store", e1, e2, e3, e4, e5, e6, e7, e8, status);
+    #else
+        dm.disp_row("load/store", e1, e2, e3, e4, e5, e6, e7, status);
+    #endif
+};
+
+template<class T>
+void test_simd::test_functions_accurate_sum()
+{
+    // the array x = [v, -v, 1] and y = [w, w, 1], where v, w are random 
+    // vectors of length m; exact sum and exact dot product are equal to 1,
+    // but naive summation gives large error; lengths of arrays are chosen
+    // to test the tail processing
+    int N           = get_size();
+    T scale         = (sizeof(T) == sizeof(double)) ? T(1e6) : T(1e2);
+    double u        = std::numeric_limits<T>::epsilon() / 2.0;
+
+    std::vector<T> x, y, z, e;
+
+    std::string header  = m_instr_tag + " accurate sum " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",    align_type::right, 10);
+    dm.add_column("naive",      align_type::left, 5);
+    dm.add_column("error",      align_type::left, 5);
+    dm.add_column("bound",      align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    int sizes[]     = {0, 1, 2, 3, 5, 7, 13, 31, N / 2};
+
+    double err_sum  = 0.0, err_dot = 0.0, err_sum_n = 0.0, err_dot_n = 0.0;
+    double bnd_sum  = 0.0, bnd_dot = 0.0;
+    bool ok_sum     = true, ok_dot = true, ok_axpy = true;
+
+    for (int m : sizes)
+    {
+        int n       = 2 * m + 1;
+
+        x.resize(n);
+        y.resize(n);
+        z.resize(n);
+        e.resize(n);
+
+        double abs_sum  = 1.0;
+        double abs_dot  = 1.0;
+
+        for (int i = 0; i < m; ++i)
+        {
+            x[i]        = scale * rand_scalar<T>::make(false);
+            y[i]        = rand_scalar<T>::make(false);
+            x[m + i]    = -x[i];
+            y[m + i]    = y[i];
+            abs_sum     += 2.0 * std::abs(double(x[i]));
+            abs_dot     += 2.0 * std::abs(double(x[i]) * double(y[i]));
+        };
+
+        x[n - 1]        = T(1);
+        y[n - 1]        = T(1);
+
+        T naive_sum     = T(0);
+        T naive_dot     = T(0);
+
+        for (int i = 0; i < n; ++i)
+        {
+            naive_sum   += x[i];
+            naive_dot   += x[i] * y[i];
+        };
+
+        // error bounds from "Accurate Sum and Dot Product", T. Ogita, 
+        // S.M. Rump, S. Oishi
+        double gam      = n * u / (1.0 - n * u);
+        double b_sum    = u + gam * gam * abs_sum;
+        double b_dot    = u + gam * gam * abs_dot;
+
+        twofold<T> r_sum    = ms::sum2(x.data(), n);
+        twofold<T> r_dot    = ms::dot2(x.data(), y.data(), n);
+
+        double d_sum    = std::abs(double(r_sum.value) - 1.0);
+        double d_dot    = std::abs(double(r_dot.value) - 1.0);
+
+        ok_sum          = ok_sum && (d_sum <= b_sum);
+        ok_dot          = ok_dot && (d_dot <= b_dot);
+
+        err_sum         = std::max(err_sum, d_sum);
+        err_dot         = std::max(err_dot, d_dot);
+        err_sum_n       = std::max(err_sum_n, std::abs(double(naive_sum) - 1.0));
+        err_dot_n       = std::max(err_dot_n, std::abs(double(naive_dot) - 1.0));
+        bnd_sum         = std::max(bnd_sum, b_sum);
+        bnd_dot         = std::max(bnd_dot, b_dot);
+
+        // y + e = a * x is exact, y + e - a * x = 0 is exact, y + e + x = x
+        // is exact
+        T a             = T(1) / T(3);
+
+        for (int i = 0; i < n; ++i)
+        {
+            z[i]        = T(0);
+            e[i]        = T(0);
+        };
+
+        ms::axpy2(a, x.data(), z.data(), e.data(), n);
+
+        for (int i = 0; i < n; ++i)
+        {
+            T p         = a * x[i];
+            ok_axpy     = ok_axpy && (z[i] == p) && (e[i] == std::fma(a, x[i], -p));
+        };
+
+        ms::axpy2(-a, x.data(), z.data(), e.data(), n);
+        ms::axpy2(T(1), x.data(), z.data(), e.data(), n);
+
+        for (int i = 0; i < n; ++i)
+            ok_axpy     = ok_axpy && (z[i] == x[i]) && (e[i] == T(0));
+    };
+
+    dm.disp_row("sum2", err_sum_n, err_sum, bnd_sum, ok_sum ? "OK" : "FAIL");
+    dm.disp_row("dot2", err_dot_n, err_dot, bnd_dot, ok_dot ? "OK" : "FAIL");
+    dm.disp_row("axpy2", 0.0, 0.0, 0.0, ok_axpy ? "OK" : "FAIL");
+};
+
+template<class T>
+void test_simd::test_functions_repro_sum()
+{
+    // results of reproducible sums must be bitwise identical for all simd
+    // types, for any partitioning of summands between accumulators, and for
+    // any order of summands; the array x = [v, -v, 1] is used, for which the
+    // exact sum is 1
+    int N           = get_size();
+    T scale         = (sizeof(T) == sizeof(double)) ? T(1e6) : T(1e2);
+
+    using simd_1    = ms::simd<T, 128, ms::nosimd_tag>;
+    using simd_2    = ms::simd<T, 128, ms::sse_tag>;
+    using simd_3    = ms::simd<T, 256, ms::sse_tag>;
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        using simd_4    = ms::simd<T, 256, ms::avx_tag>;
+    #else
+        using simd_4    = simd_3;
+    #endif
+
+    using accumulator   = ms::repro_accumulator<T>;
+
+    std::vector<T> x, y, xr, yr;
+
+    std::string header  = m_instr_tag + " reproducible sum " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",    align_type::right, 10);
+    dm.add_column("error",      align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    int sizes[]     = {0, 1, 2, 3, 5, 7, 13, 31, N / 2};
+
+    double err_sum  = 0.0, err_dot = 0.0;
+    bool ok_sum     = true, ok_dot = true;
+
+    for (int m : sizes)
+    {
+        int n       = 2 * m + 1;
+
+        x.resize(n);
+        y.resize(n);
+
+        for (int i = 0; i < m; ++i)
+        {
+            x[i]        = scale * rand_scalar<T>::make(false);
+            y[i]        = rand_scalar<T>::make(false);
+            x[m + i]    = -x[i];
+            y[m + i]    = y[i];
+        };
+
+        x[n - 1]        = T(1);
+        y[n - 1]        = T(1);
+
+        xr.assign(x.rbegin(), x.rend());
+        yr.assign(y.rbegin(), y.rend());
+
+        T s0            = ms::sum_repro<simd_1>(x.data(), n);
+        T d0            = ms::dot_repro<simd_1>(x.data(), y.data(), n);
+
+        ok_sum          = ok_sum && s0 == ms::sum_repro<simd_2>(x.data(), n)
+                                 && s0 == ms::sum_repro<simd_3>(x.data(), n)
+                                 && s0 == ms::sum_repro<simd_4>(x.data(), n)
+                                 && s0 == ms::sum_repro<simd_4>(xr.data(), n);
+
+        ok_dot          = ok_dot && d0 == ms::dot_repro<simd_2>(x.data(), y.data(), n)
+                                 && d0 == ms::dot_repro<simd_3>(x.data(), y.data(), n)
+                                 && d0 == ms::dot_repro<simd_4>(x.data(), y.data(), n)
+                                 && d0 == ms::dot_repro<simd_4>(xr.data(), yr.data(), n);
+
+        // summands are split into 3 chunks processed by different accumulators
+        // and using different simd types
+        int n1          = n / 3;
+        int n2          = n - n1 - 1;
+
+        accumulator acc_s1(accumulator::max_abs(x.data(), n), n);
+        accumulator acc_s2(accumulator::max_abs(x.data(), n), n);
+        accumulator acc_d1(accumulator::max_abs_prod(x.data(), y.data(), n), n);
+        accumulator acc_d2(accumulator::max_abs_prod(x.data(), y.data(), n), n);
+
+        acc_s1.template add<simd_2>(x.data(), n1);
+        acc_s2.template add<simd_4>(x.data() + n1, n2);
+        acc_s1.template add<simd_1>(x.data() + n1 + n2, n - n1 - n2);
+        acc_s2.merge(acc_s1);
+
+        acc_d1.template add_dot<simd_3>(x.data(), y.data(), n1);
+        acc_d2.template add_dot<simd_1>(x.data() + n1, y.data() + n1, n2);
+        acc_d1.template add_dot<simd_4>(x.data() + n1 + n2, y.data() + n1 + n2, n - n1 - n2);
+        acc_d1.merge(acc_d2);
+
+        ok_sum          = ok_sum && (s0 == acc_s2.value());
+        ok_dot          = ok_dot && (d0 == acc_d1.value());
+
+        err_sum         = std::max(err_sum, std::abs(double(s0) - 1.0));
+        err_dot         = std::max(err_dot, std::abs(double(d0) - 1.0));
+    };
+
+    // error bound is much smaller than the unit roundoff for these data
+    double u        = std::numeric_limits<T>::epsilon() / 2.0;
+    ok_sum          = ok_sum && (err_sum <= u);
+    ok_dot          = ok_dot && (err_dot <= u);
+
+    dm.disp_row("sum_repro", err_sum, ok_sum ? "OK" : "FAIL");
+    dm.disp_row("dot_repro", err_dot, ok_dot ? "OK" : "FAIL");
+
+    // timing compared to sum2 and to naive summation
+    int M           = 100;
+    int n           = N;
+    x.resize(n);
+
+    for (int i = 0; i < n; ++i)
+        x[i]        = rand_scalar<T>::make(false);
+
+    volatile T res  = T(0);
+
+    tic();
+    for (int j = 0; j < M; ++j)
+    {
+        T s         = T(0);
+        for (int i = 0; i < n; ++i)
+            s       += x[i];
+
+        res         = res + s;
+    };
+    double t0       = toc();
+
+    tic();
+    for (int j = 0; j < M; ++j)
+        res         = res + ms::sum2(x.data(), n).value;
+    double t1       = toc();
+
+    tic();
+    for (int j = 0; j < M; ++j)
+        res         = res + ms::sum_repro(x.data(), n);
+    double t2       = toc();
+
+    formatted_disp dt;
+
+    dt.set_row_label("func",    align_type::right, 10);
+    dt.add_column("time",       align_type::left, 5);
+    dt.add_column("ratio",      align_type::left, 5);
+
+    dt.disp_header();
+    dt.disp_row("naive", t0, 1.0);
+    dt.disp_row("sum2", t1, t1 / t0);
+    dt.disp_row("sum_repro", t2, t2 / t0);
+};
+
+template<class T>
+void test_simd::test_functions_poly_compensated()
+{
+    // K polynomials with positive coefficients are evaluated at positive
+    // points, therefore cond(p, x) = 1 and all results must be faithfully
+    // rounded; results are compared with compensated_horner evaluated
+    // separately for each polynomial; K is not a multiple of the vector size
+    // in order to test the tail processing
+    using simd_ref  = ms::simd<T, 128, ms::nosimd_tag>;
+
+    static const int K  = 11;
+    static const int n  = 50;
+    int M               = 1000;
+
+    std::vector<T> x(n), poly, res(n * K), err(n * K), coef;
+    bool faithful[n * K];
+
+    for (int j = 0; j < n; ++j)
+        x[j]        = std::abs(rand_scalar<T>::make(false)) / T(40);
+
+    std::string header  = m_instr_tag + " compensated poly " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("N",       align_type::right, 10);
+    dm.add_column("max dist",   align_type::left, 5);
+    dm.add_column("time",       align_type::left, 5);
+    dm.add_column("time ref",   align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    int sizes[]     = {1, 3, 9, 10, 17, 32};
+
+    for (int N : sizes)
+    {
+        poly.resize(N * K);
+        coef.resize(N);
+
+        for (int i = 0; i < N * K; ++i)
+            poly[i]     = std::abs(rand_scalar<T>::make(false));
+
+        bool all_f      = ms::compensated_horner_batch_and_error(x.data(), n, N, K, poly.data(),
+                            res.data(), err.data(), faithful);
+
+        bool ok         = all_f;
+        double dist     = 0.0;
+
+        for (int k = 0; k < K; ++k)
+        {
+            for (int i = 0; i < N; ++i)
+                coef[i] = poly[i * K + k];
+
+            for (int j = 0; j < n; ++j)
+            {
+                twofold<simd_ref> ref   = ms::compensated_horner(simd_ref(x[j]), N, coef.data());
+
+                double ref_v    = double(ref.value.first()) + double(ref.error.first());
+                double d        = std::abs(double(res[j * K + k]) - ref_v);
+                double bound    = double(err[j * K + k]) + std::abs(ref_v) * 4.0 
+                                * std::numeric_limits<T>::epsilon() 
+                                * std::numeric_limits<T>::epsilon();
+
+                ok              = ok && (d <= bound) && (faithful[j * K + k] == true)
+                                && (float_distance(res[j * K + k], ref.value.first()) <= 1);
+
+                dist            = std::max(dist, double(float_distance(res[j * K + k], 
+                                                                       ref.value.first())));
+            };
+        };
+
+        tic();
+        for (int j = 0; j < M; ++j)
+            ms::compensated_horner_batch(x.data(), n, N, K, poly.data(), res.data());
+        double t0       = toc();
+
+        volatile T val  = T(0);
+
+        tic();
+        for (int j = 0; j < M; ++j)
+        {
+            for (int k = 0; k < K; ++k)
+            {
+                for (int i = 0; i < N; ++i)
+                    coef[i] = poly[i * K + k];
+
+                for (int l = 0; l < n; ++l)
+                    val     = val + ms::compensated_horner(simd_ref(x[l]), N, coef.data())
+                                        .value.first();
+            };
+        };
+        double t1       = toc();
+
+        dm.disp_row(std::to_string(N), dist, t0, t1, ok ? "OK" : "FAIL");
+    };
+};
+
+template<class T>
+void test_simd::test_functions_poly_series()
+{
+    // Chebyshev series evaluated by clenshaw and chebyshev_estrin are compared
+    // with sum_i c_i * cos(i * acos(x)) computed in double precision; rational
+    // functions are compared with the ratio of two horner evaluations
+    using simd_type = typename ms::default_simd_type<T>::type;
+
+    static const int vec_size   = simd_type::vector_size;
+    static const int N          = 24;
+
+    int n           = 1000;
+    double u        = std::numeric_limits<T>::epsilon() / 2.0;
+
+    T coef[N];
+    T q[N];
+
+    for (int i = 0; i < N; ++i)
+    {
+        coef[i]     = rand_scalar<T>::make(false) / T(i + 1);
+        q[i]        = rand_scalar<T>::make(false) / T(i + 1);
+    };
+
+    // denominator without roots in [-1, 1]
+    double sum_q    = 0.0;
+    for (int i = 1; i < 7; ++i)
+        sum_q       += std::abs(double(q[i]));
+
+    q[0]            = T(sum_q + 1.0);
+
+    std::string header  = m_instr_tag + " poly series " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",    align_type::right, 10);
+    dm.add_column("error",      align_type::left, 5);
+    dm.add_column("bound",      align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    double abs_coef = 0.0;
+    for (int i = 0; i < N; ++i)
+        abs_coef    += std::abs(double(coef[i]));
+
+    double err_c    = 0.0, err_cd = 0.0, err_ce = 0.0, err_ced = 0.0, err_r = 0.0;
+    bool ok_post    = true, ok_r = true;
+
+    T buf_x[vec_size];
+
+    for (int j = 0; j < n; ++j)
+    {
+        for (int i = 0; i < vec_size; ++i)
+            buf_x[i]    = T(2.0 * (j * vec_size + i) / double(n * vec_size - 1) - 1.0);
+
+        simd_type x     = simd_type::load(buf_x, std::false_type());
+        simd_type err_x;
+
+        simd_type f1    = ms::clenshaw<N>(x, coef);
+        simd_type f2    = ms::clenshaw_and_error(x, N, coef, err_x);
+        simd_type f3    = ms::chebyshev_estrin<N>(x, coef);
+        simd_type f4    = ms::chebyshev_estrin(x, N, coef);
+        simd_type r1    = ms::rational<N, 7>(x, coef, q);
+        simd_type r2    = ms::rational(x, N, coef, 7, q);
+        simd_type r_err;
+        simd_type r3    = ms::rational_and_error(x, N, coef, 7, q, r_err);
+        simd_type ratio = ms::horner(x, N, coef) / ms::horner(x, 7, q);
+
+        for (int i = 0; i < vec_size; ++i)
+        {
+            double xd   = double(buf_x[i]);
+            double ref  = 0.0;
+
+            for (int k = 0; k < N; ++k)
+                ref     += double(coef[k]) * std::cos(k * std::acos(xd));
+
+            // reference values are inaccurate in double precision
+            double tol  = (sizeof(T) == sizeof(double)) ? 1e3 * u * abs_coef : 0.0;
+
+            err_c       = std::max(err_c, std::abs(double(f1.get(i)) - ref));
+            err_cd      = std::max(err_cd, std::abs(double(f2.get(i)) - ref));
+            err_ce      = std::max(err_ce, std::abs(double(f3.get(i)) - ref));
+            err_ced     = std::max(err_ced, std::abs(double(f4.get(i)) - ref));
+
+            ok_post     = ok_post && std::abs(double(f2.get(i)) - ref) <= double(err_x.get(i)) + tol;
+
+            double P    = double(coef[N - 1]);
+            double Q    = double(q[6]);
+
+            for (int k = N - 2; k >= 0; --k)
+                P       = P * xd + double(coef[k]);
+
+            for (int k = 5; k >= 0; --k)
+                Q       = Q * xd + double(q[k]);
+
+            double d    = std::abs(double(r3.get(i)) - P / Q);
+            err_r       = std::max(err_r, d);
+
+            // rational and horner perform the same operations
+            ok_r        = ok_r && (r1.get(i) == r2.get(i)) && (r1.get(i) == r3.get(i))
+                        && (r1.get(i) == ratio.get(i)) && (d <= double(r_err.get(i)) + tol);
+        };
+    };
+
+    double bound    = (N + 1) * (N + 1) * u * abs_coef;
+
+    dm.disp_row("clenshaw", err_c, bound, (err_c <= bound) ? "OK" : "FAIL");
+    dm.disp_row("clenshaw dyn", err_cd, bound, (err_cd <= bound && ok_post) ? "OK" : "FAIL");
+    dm.disp_row("cheb estrin", err_ce, bound, (err_ce <= bound) ? "OK" : "FAIL");
+    dm.disp_row("cheb estrin dyn", err_ced, bound, (err_ced <= bound) ? "OK" : "FAIL");
+    dm.disp_row("rational", err_r, 0.0, ok_r ? "OK" : "FAIL");
+};
+
+template<class T>
+void test_simd::test_functions_poly_const()
+{
+    // polynomials with compile-time coefficients are compared with horner<N>
+    // and estrin<N> reading coefficients from an array
+    std::string header  = m_instr_tag + " poly const " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("poly",    align_type::right, 10);
+    dm.add_column("max dist",   align_type::left, 5);
+    dm.add_column("horner",     align_type::left, 5);
+    dm.add_column("horner_c",   align_type::left, 5);
+    dm.add_column("estrin",     align_type::left, 5);
+    dm.add_column("estrin_c",   align_type::left, 5);
+    dm.add_column("poly_c",     align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    test_function_poly_const<T, 1.0, 0.5, 0.25, 0.125>(dm, "cubic");
+
+    // polynomial used in simd_log_approx_double
+    test_function_poly_const<T,
+                6.66666666666688547299310656675190687e-01,
+                3.99999999987401741406920347834347647e-01,
+                2.85714288669539260936377812250363457e-01,
+                2.22221871825960117598424175414698074e-01,
+                1.81841095988965909080780869966928340e-01,
+                1.53009602706038610316834383087625899e-01,
+                1.49202865515212540004373762442151109e-01>(dm, "log");
+
+    // Taylor series of exp
+    test_function_poly_const<T, 1.0, 1.0, 1.0/2.0, 1.0/6.0, 1.0/24.0, 1.0/120.0,
+                1.0/720.0, 1.0/5040.0, 1.0/40320.0, 1.0/362880.0, 1.0/3628800.0,
+                1.0/39916800.0, 1.0/479001600.0>(dm, "exp");
+};
+
+template<class T, double ... Coef>
+void test_simd::test_function_poly_const(formatted_disp& dm, const std::string& name)
+{
+    // horner_c performs the same operations as horner<N>, therefore results
+    // must be identical; estrin_c and estrin<N> split polynomials differently;
+    // all coefficients and points are positive, hence both results are 
+    // accurate to few ulp
+    using simd_type = typename ms::default_simd_type<T>::type;
+
+    static const int vec_size   = simd_type::vector_size;
+    static const int N          = sizeof...(Coef);
+
+    const T poly[]  = {T(Coef)...};
+
+    int n           = 1024;
+    int M           = 1000;
+
+    std::vector<T> x(n), res_h(n), res_hc(n), res_e(n), res_ec(n), res_p(n);
+
+    for (int j = 0; j < n; ++j)
+        x[j]        = std::abs(rand_scalar<T>::make(false)) / T(40);
+
+    auto bench      = [&](auto func, std::vector<T>& res) -> double
+    {
+        tic();
+
+        for (int k = 0; k < M; ++k)
+        {
+            for (int j = 0; j < n; j += vec_size)
+            {
+                simd_type xv    = simd_type::load(x.data() + j, std::false_type());
+                func(xv).store(res.data() + j, std::false_type());
+            };
+        };
+
+        return toc();
+    };
+
+    double t0       = bench([&](const simd_type& v) { return ms::horner<N>(v, poly); }, res_h);
+    double t1       = bench([](const simd_type& v) { return ms::horner_c<Coef...>(v); }, res_hc);
+    double t2       = bench([&](const simd_type& v) { return ms::estrin<N>(v, poly); }, res_e);
+    double t3       = bench([](const simd_type& v) { return ms::estrin_c<Coef...>(v); }, res_ec);
+    double t4       = bench([](const simd_type& v) { return ms::poly_c<Coef...>(v); }, res_p);
+
+    const std::vector<T>& res_sel   = (N > 5) ? res_ec : res_hc;
+
+    bool ok         = true;
+    double dist     = 0.0;
+
+    for (int j = 0; j < n; ++j)
+    {
+        double d    = double(float_distance(res_ec[j], res_e[j]));
+        dist        = std::max(dist, d);
+
+        ok          = ok && (res_hc[j] == res_h[j]) && (res_p[j] == res_sel[j])
+                    && (d <= double(N));
+    };
+
+    dm.disp_row(name, dist, t0, t1, t2, t3, t4, ok ? "OK" : "FAIL");
+};
+
+template<class T>
+void test_simd::test_functions_poly_multi()
+{
+    // K polynomials evaluated simultaneously are compared with horner<N> and
+    // estrin<N> evaluated separately for each polynomial
+    std::string header  = m_instr_tag + " poly multi " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("N, K",    align_type::right, 10);
+    dm.add_column("horner",     align_type::left, 5);
+    dm.add_column("horner mp",  align_type::left, 5);
+    dm.add_column("horner ma",  align_type::left, 5);
+    dm.add_column("estrin",     align_type::left, 5);
+    dm.add_column("estrin mp",  align_type::left, 5);
+    dm.add_column("estrin ma",  align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    test_function_poly_multi<T, 3, 2>(dm);
+    test_function_poly_multi<T, 6, 2>(dm);
+    test_function_poly_multi<T, 9, 2>(dm);
+    test_function_poly_multi<T, 9, 3>(dm);
+    test_function_poly_multi<T, 13, 4>(dm);
+    test_function_poly_multi<T, 16, 4>(dm);
+};
+
+template<class T, int N, int K>
+void test_simd::test_function_poly_multi(formatted_disp& dm)
+{
+    // results of horner_multi_poly and horner_multi_arg must be equal to
+    // results of horner<N>; for N <= 16 results of estrin_multi_poly and
+    // estrin_multi_arg must be equal to results of estrin<N>
+    using simd_type = typename ms::default_simd_type<T>::type;
+
+    static const int vec_size   = simd_type::vector_size;
+
+    int n           = 1024;
+    int M           = 1000;
+
+    T poly[K][N];
+    const T* poly_ptr[K];
+
+    for (int k = 0; k < K; ++k)
+    {
+        for (int i = 0; i < N; ++i)
+            poly[k][i]  = rand_scalar<T>::make(false);
+
+        poly_ptr[k]     = poly[k];
+    };
+
+    std::vector<T> x(n * K);
+    std::vector<T> res[6];
+
+    for (int i = 0; i < 6; ++i)
+        res[i].resize(n * K);
+
+    for (int j = 0; j < n * K; ++j)
+        x[j]        = rand_scalar<T>::make(false) / T(40);
+
+    // points are processed in blocks of K vectors; multi poly functions
+    // evaluate K polynomials at the first vector in each block, multi arg
+    // functions evaluate the first polynomial at all vectors in the block
+    auto bench      = [&](auto func, std::vector<T>& out) -> double
+    {
+        tic();
+
+        for (int r = 0; r < M; ++r)
+        {
+            for (int j = 0; j < n * K; j += K * vec_size)
+            {
+                simd_type xv[K];
+                simd_type rv[K];
+
+                for (int k = 0; k < K; ++k)
+                    xv[k]   = simd_type::load(x.data() + j + k * vec_size, std::false_type());
+
+                func(xv, rv);
+
+                for (int k = 0; k < K; ++k)
+                    rv[k].store(out.data() + j + k * vec_size, std::false_type());
+            };
+        };
+
+        return toc();
+    };
+
+    double t0   = bench([&](const simd_type* xv, simd_type* rv) 
+                    { 
+                        for (int k = 0; k < K; ++k)
+                            rv[k]   = ms::horner<N>(xv[0], poly_ptr[k]); 
+                    }, res[0]);
+    double t1   = bench([&](const simd_type* xv, simd_type* rv) 
+                    { 
+                        ms::horner_multi_poly<N, K>(xv[0], poly_ptr, rv); 
+                    }, res[1]);
+    double t2   = bench([&](const simd_type* xv, simd_type* rv) 
+                    { 
+                        ms::horner_multi_arg<N, K>(xv, poly_ptr[0], rv); 
+                    }, res[2]);
+    double t3   = bench([&](const simd_type* xv, simd_type* rv) 
+                    { 
+                        for (int k = 0; k < K; ++k)
+                            rv[k]   = ms::estrin<N>(xv[0], poly_ptr[k]); 
+                    }, res[3]);
+    double t4   = bench([&](const simd_type* xv, simd_type* rv) 
+                    { 
+                        ms::estrin_multi_poly<N, K>(xv[0], poly_ptr, rv); 
+                    }, res[4]);
+    double t5   = bench([&](const simd_type* xv, simd_type* rv) 
+                    { 
+                        ms::estrin_multi_arg<N, K>(xv, poly_ptr[0], rv); 
+                    }, res[5]);
+
+    bool ok     = (res[0] == res[1]) && (res[3] == res[4]);
+
+    T buf_h[vec_size];
+    T buf_e[vec_size];
+
+    for (int j = 0; j < n * K; j += vec_size)
+    {
+        simd_type xv    = simd_type::load(x.data() + j, std::false_type());
+
+        ms::horner<N>(xv, poly_ptr[0]).store(buf_h, std::false_type());
+        ms::estrin<N>(xv, poly_ptr[0]).store(buf_e, std::false_type());
+
+        for (int l = 0; l < vec_size; ++l)
+            ok          = ok && (res[2][j + l] == buf_h[l]) && (res[5][j + l] == buf_e[l]);
+    };
+
+    std::string label   = std::to_string(N) + ", " + std::to_string(K);
+    dm.disp_row(label, t0, t1, t2, t3, t4, t5, ok ? "OK" : "FAIL");
+};
+
+template<class T>
+void test_simd::test_functions_int_divide()
+{
+    // mulh, mulhu, and division by simd_divider are compared with scalar
+    // operations; division by simd_divider is compared with the operator /
+    using simd_type = typename ms::default_simd_type<T>::type;
+    using uint_type = typename std::make_unsigned<T>::type;
+
+    static const int vec_size   = simd_type::vector_size;
+    static const int bits       = int(sizeof(T) * 8);
+
+    std::string header  = m_instr_tag + " int divide " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    int n           = 4096;
+
+    T min_val       = std::numeric_limits<T>::min();
+    T max_val       = std::numeric_limits<T>::max();
+
+    std::mt19937_64 gen(n);
+    std::vector<T> x(n);
+
+    // extreme values and random values with random number of significant bits
+    x[0]            = min_val;
+    x[1]            = max_val;
+    x[2]            = 0;
+    x[3]            = -1;
+
+    for (int i = 4; i < n; ++i)
+        x[i]        = T(gen() >> (gen() % bits));
+
+    // mulh and mulhu
+    bool ok_mulh    = true;
+
+    T buf_h[vec_size];
+    T buf_hu[vec_size];
+
+    for (int i = 0; i + 2 * vec_size <= n; i += vec_size)
+    {
+        simd_type xv    = simd_type::load(x.data() + i, std::false_type());
+        simd_type yv    = simd_type::load(x.data() + n - vec_size - i, std::false_type());
+
+        ms::mulh(xv, yv).store(buf_h, std::false_type());
+        ms::mulhu(xv, yv).store(buf_hu, std::false_type());
+
+        for (int l = 0; l < vec_size; ++l)
+        {
+            T xs        = x[i + l];
+            T ys        = x[n - vec_size - i + l];
+
+            ok_mulh     = ok_mulh && (buf_h[l] == ms::mulh(xs, ys))
+                        && (uint_type(buf_hu[l]) == ms::mulh(uint_type(xs), uint_type(ys)));
+        };
+    };
+
+    disp(std::string("mulh: ") + (ok_mulh ? "OK" : "FAIL"));
+
+    formatted_disp dm;
+
+    dm.set_row_label("divisor", align_type::right, 21);
+    dm.add_column("t /",        align_type::left, 5);
+    dm.add_column("t scalar",   align_type::left, 5);
+    dm.add_column("t simd",     align_type::left, 5);
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    T divisors[]    = {1, -1, 2, -2, 3, -3, 7, -7, 10, 641, -1000, 1 << 20,
+                       max_val, T(max_val - 1), min_val, T(min_val + 1)};
+
+    for (T d : divisors)
+        test_function_int_divide<T>(dm, d, n, x.data());
+
+    for (int i = 0; i < 4; ++i)
+    {
+        T d     = T(gen() >> (gen() % bits));
+        d       = (d == 0) ? T(1) : d;
+
+        test_function_int_divide<T>(dm, d, n, x.data());
+    };
+};
+
+template<class T>
+void test_simd::test_function_int_divide(formatted_disp& dm, T d, int n, const T* x)
+{
+    using simd_type = typename ms::default_simd_type<T>::type;
+
+    static const int vec_size   = simd_type::vector_size;
+
+    int M           = 1000;
+
+    ms::simd_divider<T> div(d);
+
+    std::vector<T> res_q[3];
+    std::vector<T> res_r[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        res_q[i].resize(n);
+        res_r[i].resize(n);
+    };
+
+    tic();
+    for (int r = 0; r < M; ++r)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            // MIN / -1 is not representable
+            T v             = (d == -1 && x[i] == std::numeric_limits<T>::min()) ? T(0) : x[i];
+            res_q[0][i]     = v / d;
+            res_r[0][i]     = v % d;
+        };
+    };
+    double t0   = toc();
+
+    tic();
+    for (int r = 0; r < M; ++r)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            res_q[1][i]     = div.divide(x[i]);
+            res_r[1][i]     = div.remainder(x[i]);
+        };
+    };
+    double t1   = toc();
+
+    tic();
+    for (int r = 0; r < M; ++r)
+    {
+        for (int i = 0; i < n; i += vec_size)
+        {
+            simd_type xv    = simd_type::load(x + i, std::false_type());
+
+            div.divide(xv).store(res_q[2].data() + i, std::false_type());
+            div.remainder(xv).store(res_r[2].data() + i, std::false_type());
+        };
+    };
+    double t2   = toc();
+
+    // MIN / -1 is not representable; simd_divider returns MIN, remainder is 0
+    if (d == -1)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            if (x[i] == std::numeric_limits<T>::min())
+                res_q[0][i] = x[i];
+        };
+    };
+
+    bool ok     = (res_q[0] == res_q[1]) && (res_q[0] == res_q[2])
+                && (res_r[0] == res_r[1]) && (res_r[0] == res_r[2]);
+
+    dm.disp_row(std::to_string(d), t0, t1, t2, ok ? "OK" : "FAIL");
+};
+
+template<class T>
+void test_simd::test_functions_int()
+{
+    int N           = get_size();
+    int max_int     = 32;
+
+    std::vector<int32_t> in_32;
+    std::vector<int64_t> in_64;
+    std::vector<T> in_t;
+    std::vector<T> out;
+    std::vector<T> out_gen;
+    std::vector<T> arg;
+
+    in_32.resize(N);
+    in_64.resize(N);
+    in_t.resize(N);
+    out.resize(N);
+    out_gen.resize(N);
+    arg.resize(2*max_int + 1);
+
+    int32_t* ptr_in_32  = in_32.data();
+    int64_t* ptr_in_64  = in_64.data();
+    T* ptr_in_t         = in_t.data();
+
+    T* ptr_out      = out.data();
+    T* ptr_out_gen  = out_gen.data();    
+    T* arg_ptr      = arg.data();
+
+    for (int i = 0; i < N; ++i)
+        ptr_in_32[i]   = rand_scalar<int32_t>::make(m_test_values) % max_int;
+
+    for (int i = 0; i < N; ++i)
+        ptr_in_64[i]   = rand_scalar<int64_t>::make(m_test_values) % max_int;
+
+    for (int i = 0; i < N; ++i)
+        ptr_in_t[i]   = T(rand_scalar<int32_t>::make(m_test_values) % max_int);
+
+    for (int i = 0; i < max_int*2 + 1; ++i)
+        arg_ptr[i]  = rand_scalar<T>::make(false);
+
+    arg_ptr         = arg_ptr + max_int;
+
+    std::string header  = m_instr_tag + " " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",    align_type::right, 10);
+    dm.add_column("nosimd",     align_type::left, 5);
+    dm.add_column("128 no",     align_type::left, 5);
+    dm.add_column("256 no",     align_type::left, 5);
+    dm.add_column("128 sse",    align_type::left, 5);
+    dm.add_column("256 sse",    align_type::left, 5);
+    dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    test_function_int<T, int32_t, test_functions::Func_gather_int32<T>>(dm, N, ptr_in_32, ptr_out, ptr_out_gen,
+                                                test_functions::Func_gather_int32<T>(arg_ptr));
+    test_function_int<T, int64_t, test_functions::Func_gather_int64<T>>(dm, N, ptr_in_64, ptr_out, ptr_out_gen,
                                                 test_functions::Func_gather_int64<T>(arg_ptr));
     test_function_int<T, int32_t, test_functions::Func_pow2ki_int32<T>>(dm, N, ptr_in_32, ptr_out, ptr_out_gen,
                                                 test_functions::Func_pow2ki_int32<T>());
     test_function_int<T, int64_t, test_functions::Func_pow2ki_int64<T>>(dm, N, ptr_in_64, ptr_out, ptr_out_gen,
                                                 test_functions::Func_pow2ki_int64<T>());
+    test_function_int<T, int32_t, test_functions::Func_powi_int32<T>>(dm, N, ptr_in_32, ptr_out, ptr_out_gen,
+                                                test_functions::Func_powi_int32<T>());
+    test_function_int<T, int64_t, test_functions::Func_powi_int64<T>>(dm, N, ptr_in_64, ptr_out, ptr_out_gen,
+                                                test_functions::Func_powi_int64<T>());
     test_function_int<T, T, test_functions::Func_pow2k>(dm, N, ptr_in_t, ptr_out, ptr_out_gen,
                                                 test_functions::Func_pow2k());
 };
 
+template<class T>
+void test_simd::test_functions_powi_special()
+{
+    using int_type  = typename std::conditional<std::is_same<T, float>::value, 
+                                                int32_t, int64_t>::type;
+
+    const T inf     = std::numeric_limits<T>::infinity();
+    const T zero    = T(0.0);
+    const bool dbl  = std::is_same<T, double>::value;
+
+    // exponents of the smallest denormal and the largest regular number
+    const int e_min = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+    const int e_max = std::numeric_limits<T>::max_exponent - 1;
+    const int e_odd = 2 * (e_min / 2) + 1;
+
+    // results close to the overflow and underflow thresholds; for negative n
+    // x^|n| can overflow even if x^n is representable
+    const T x[]     = {T(2.0), T(2.0), T(-2.0), T(4.0), T(2.0), T(2.0), T(0.5), T(0.5),
+                       T(10.0), T(3.0), T(1.5), T(3.0), zero, -zero, inf, -inf};
+
+    const int_type n[]
+                    = {e_min, e_min - 1, e_odd, e_min / 2, -e_max, -e_max - 1, -e_min, -e_max,
+                       dbl ? -320 : -44, dbl ? -675 : -92, dbl ? -1800 : -240, dbl ? -700 : -100, 
+                       -3, -3, -2, -3};
+
+    const T ref[]   = {std::ldexp(T(1.0), e_min), zero, -std::ldexp(T(1.0), e_odd), 
+                       std::ldexp(T(1.0), 2 * (e_min / 2)), std::ldexp(T(1.0), -e_max), 
+                       std::ldexp(T(1.0), -e_max - 1), std::ldexp(T(1.0), e_min), 
+                       std::ldexp(T(1.0), e_max), 
+                       T(std::pow(10.0, double(n[8]))), T(std::pow(3.0, double(n[9]))),
+                       T(std::pow(1.5, double(n[10]))), zero, inf, -inf, zero, -zero};
+
+    static const int N  = sizeof(x) / sizeof(x[0]);
+
+    std::string header  = m_instr_tag + " powi special " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",    align_type::right, 10);
+    dm.add_column("scalar",     align_type::left, 5);
+    dm.add_column("128 no",     align_type::left, 5);
+    dm.add_column("256 no",     align_type::left, 5);
+    dm.add_column("128 sse",    align_type::left, 5);
+    dm.add_column("256 sse",    align_type::left, 5);
+    dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
+    dm.add_column("status",     align_type::left, 5);
+
+    dm.disp_header();
+
+    double d0, d1, d2, d3, d4, d5, d6;
+    bool v0, v1, v2, v3, v4, v5, v6;
+
+    v0      = true;
+    d0      = 0.0;
+
+    for (int i = 0; i < N; ++i)
+    {
+        double loc_dist;
+        v0  = test_equal(ms::powi(x[i], int(n[i])), ref[i], 1.0, loc_dist, true) && v0;
+        d0  = std::max(d0, loc_dist);
+    };
+
+    v1  = test_powi_special<T, int_type, 128, simd::nosimd_tag>(N, x, n, ref, d1);
+    v2  = test_powi_special<T, int_type, 256, simd::nosimd_tag>(N, x, n, ref, d2);
+    v3  = test_powi_special<T, int_type, 128, simd::sse_tag>(N, x, n, ref, d3);
+    v4  = test_powi_special<T, int_type, 256, simd::sse_tag>(N, x, n, ref, d4);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        v5  = test_powi_special<T, int_type, 256, simd::avx_tag>(N, x, n, ref, d5);
+    #else
+        v5  = true;
+        d5  = 0;
+    #endif
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        v6  = test_powi_special<T, int_type, 512, simd::avx512_tag>(N, x, n, ref, d6);
+    #else
+        v6  = true;
+        d6  = 0;
+    #endif
+
+    bool ok = v0 && v1 && v2 && v3 && v4 && v5 && v6;
+
+    // distances in ulp instead of timings
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.disp_row("powi", d0, d1, d2, d3, d4, d5, d6, status);
+    #else
+        dm.disp_row("powi", d0, d1, d2, d3, d4, d5, status);
+    #endif
+};
+
+template<class T, class Int_type, int Bits, class Tag>
+bool test_simd::test_powi_special(int size, const T* x, const Int_type* n, const T* ref, 
+                                  double& dist)
+{
+    using simd_type     = simd::simd<T, Bits, Tag>;
+    using simd_int      = simd::simd<Int_type, Bits, Tag>;
+
+    static const int vec_size   = simd_type::vector_size;
+
+    bool ok     = true;
+    dist        = 0.0;
+
+    for (int i = 0; i < size; i += vec_size)
+    {
+        simd_type xs    = simd_type::load(x + i, std::false_type());
+        simd_int ns     = simd_int::load(n + i, std::false_type());
+        simd_type res   = ms::powi(xs, ns);
+
+        const T* ptr_res    = res.get_raw_ptr();
+
+        for (int j = 0; j < vec_size; ++j)
+        {
+            double loc_dist;
+            ok          = test_equal(ptr_res[j], ref[i + j], 1.0, loc_dist, true) && ok;
+            dist        = std::max(dist, loc_dist);
+        };
+    };
+
+    return ok;
+};
+
 template<class T>
 void test_simd::test_functions_bin()
 {
@@ -1001,6 +2754,11 @@ void test_simd::test_functions_bin()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -1017,6 +2775,9 @@ void test_simd::test_functions_bin()
     test_function_bin<T, test_functions::Func_minus>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);    
     test_function_bin<T, test_functions::Func_max>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
     test_function_bin<T, test_functions::Func_min>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
+    test_function_bin<T, test_functions::Func_pow>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
+    test_function_bin<T, test_functions::Func_atan2>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
+    test_function_bin<T, test_functions::Func_hypot>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
 
     test_function_bin<T, test_functions::Func_bit_and>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
     test_function_bin<T, test_functions::Func_bit_or>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
@@ -1126,12 +2887,21 @@ void test_simd::test_functions_3()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
 
     test_function_3<T, test_functions::Func_if_then_else>(dm, N, ptr_in_1, ptr_in_2, 
                                                  ptr_in_3, ptr_out, ptr_out_gen);
+    test_function_3<T, test_functions::Func_if_then_else_mask>(dm, N, ptr_in_1, ptr_in_2, 
+                                                 ptr_in_3, ptr_out, ptr_out_gen);
+    test_function_3<T, test_functions::Func_if_add_mask>(dm, N, ptr_in_1, ptr_in_2, 
+                                                 ptr_in_3, ptr_out, ptr_out_gen);
 
     for (int i = 0; i < N; ++i)
     {
@@ -36,6 +36,16 @@ class test_simd
         void    make_unary_int();
         void    make_select();
         void    make_combine();
+        void    make_bulk();
+        void    make_partial();
+        void    make_trig_special();
+        void    make_reduction();
+        void    make_accurate_sum();
+        void    make_poly_compensated();
+        void    make_poly_series();
+        void    make_poly_const();
+        void    make_poly_multi();
+        void    make_int_divide();
 
     private:
         int     get_size() const;
@@ -55,6 +65,12 @@ class test_simd
         template<class T>
         void    test_functions_math();
 
+        template<class T>
+        void    test_functions_trig_special();
+
+        template<class T>
+        void    test_functions_reduction();
+
         template<class T>
         void    test_functions_select();
 
@@ -64,12 +80,51 @@ class test_simd
         template<class T>
         void    test_functions_int();
 
+        template<class T>
+        void    test_functions_powi_special();
+
         template<class T>
         void    test_functions_bin();
 
         template<class T>
         void    test_functions_3();
 
+        template<class T>
+        void    test_functions_bulk();
+
+        template<class T>
+        void    test_functions_partial();
+
+        template<class T>
+        void    test_functions_accurate_sum();
+
+        template<class T>
+        void    test_functions_repro_sum();
+
+        template<class T>
+        void    test_functions_poly_compensated();
+
+        template<class T>
+        void    test_functions_poly_series();
+
+        template<class T>
+        void    test_functions_poly_const();
+
+        template<class T, double ... Coef>
+        void    test_function_poly_const(formatted_disp& fd, const std::string& name);
+
+        template<class T>
+        void    test_functions_poly_multi();
+
+        template<class T, int N, int K>
+        void    test_function_poly_multi(formatted_disp& fd);
+
+        template<class T>
+        void    test_functions_int_divide();
+
+        template<class T>
+        void    test_function_int_divide(formatted_disp& fd, T d, int n, const T* x);
+
         template<class T, class Func>
         void    test_function(formatted_disp& fd, int size, const T* in, 
                     T* out, T* out_gen, bool check_nans);
@@ -78,6 +133,21 @@ class test_simd
         void    test_function_math(formatted_disp& fd, int size, const T* in, 
                     T* out, T* out_gen, bool check_nans);
 
+        template<class T, class Func>
+        void    test_function_special(formatted_disp& fd, int size, const T* in, 
+                    T* out, T* out_gen);
+
+        template<class T>
+        void    test_reduction_row(formatted_disp& fd, const std::string& name, 
+                    int size, const double* in);
+
+        template<class T, int Bits, class Tag>
+        bool    test_reduction(int size, const double* in, double& dist);
+
+        template<class T, class Int_type, int Bits, class Tag>
+        bool    test_powi_special(int size, const T* x, const Int_type* n, 
+                    const T* ref, double& dist);
+
         template<class T, class T_int, class Func>
         void    test_function_int(formatted_disp& fd, int size, const T_int* in, 
                     T* out, T* out_gen, const Func& func);
@@ -94,6 +164,10 @@ class test_simd
         void    test_function_3(formatted_disp& fd, int size, const T* in_1, 
                     const T* in_2, const T* in_3, T* out, T* out_gen);
 
+        template<class T, class Func>
+        void    test_function_bulk(formatted_disp& fd, int size, const T* in, 
+                    T* out, T* out_gen, bool check_nans);
+
         template<class T, class Func>
         void    test_function_block(formatted_disp& fd, int size, const T* in, 
                     T* out, T* out_gen, bool check_nans);
@@ -107,6 +181,9 @@ class test_simd
         template<class T, class Func>
         double  test_function_std(int size, int n_rep, const T* in, T* out);
 
+        template<class T, class Func>
+        double  test_function_bulk_eval(int size, int n_rep, const T* in, T* out);
+
         template<class T, class Int_type, class Simd_type, class Func>
         double  test_function_simd_int(int size, int n_rep, const Int_type* in, T* out, const Func& f);
 
@@ -142,4 +142,28 @@ template void simd_compl<double, 256, nosimd_tag>::scatter<2>(simd_double_comple
     template simd<int64_t, 256, avx_tag> simd<int64_t, 256, avx_tag>::select<3,2,1,0>() const;
 #endif
 
+#if MATCL_ARCHITECTURE_HAS_AVX512F
+    template simd<float, 512, avx512_tag>;
+    template simd<double, 512, avx512_tag>;
+    template simd<int32_t, 512, avx512_tag>;
+    template simd<int64_t, 512, avx512_tag>;
+
+    template void simd<float, 512, avx512_tag>::scatter<2>(float*) const;
+    template void simd<double, 512, avx512_tag>::scatter<2>(double*) const;
+    template void simd<int32_t, 512, avx512_tag>::scatter<2>(int32_t*) const;
+    template void simd<int64_t, 512, avx512_tag>::scatter<2>(int64_t*) const;
+
+    template simd<float, 512, avx512_tag> 
+    simd<float, 512, avx512_tag>::select<7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8>() const;
+
+    template simd<double, 512, avx512_tag> 
+    simd<double, 512, avx512_tag>::select<3,2,1,0,7,6,5,4>() const;
+
+    template simd<int32_t, 512, avx512_tag> 
+    simd<int32_t, 512, avx512_tag>::select<7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8>() const;
+
+    template simd<int64_t, 512, avx512_tag> 
+    simd<int64_t, 512, avx512_tag>::select<3,2,1,0,7,6,5,4>() const;
+#endif
+
 }}
@@ -13,9 +13,11 @@
 
 #include "matcl-simd/simd.h"
 #include "matcl-simd/simd_complex.h"
+#include "matcl-simd/simd_math.h"
 #include "test_functions.h"
 
 #include <vector>
+#include <limits>
 
 namespace matcl { namespace test
 {
@@ -32,6 +34,7 @@ void test::test_values_complex()
 {    
     test_simd_compl(true).make_unary();
     test_simd_compl(true).make_binary();
+    test_simd_compl(false).make_partial();
 };
 
 test_simd_compl::test_simd_compl(bool test_values)
@@ -50,6 +53,12 @@ void test_simd_compl::make_binary()
     test_functions_bin<Float_complex>();    
 };
 
+void test_simd_compl::make_partial()
+{
+    test_functions_partial<Float_complex>();
+    test_functions_partial<Complex>();
+};
+
 int test_simd_compl::get_size() const
 {
     #ifdef _DEBUG
@@ -132,6 +141,13 @@ void test_simd_compl::test_functions()
     test_function_block<T, test_functions::Func_reverse>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);    
     test_function_block<T, test_functions::Func_cast>(dm, N, ptr_in, ptr_out, ptr_out_gen, true);    
 
+    test_function<T, test_functions::Func_exp>(dm, N, ptr_in, ptr_out, ptr_out_gen, false);
+    test_function<T, test_functions::Func_log>(dm, N, ptr_in, ptr_out, ptr_out_gen, false);
+    test_function<T, test_functions::Func_sqrt>(dm, N, ptr_in, ptr_out, ptr_out_gen, false);
+    test_function<T, test_functions::Func_abs>(dm, N, ptr_in, ptr_out, ptr_out_gen, false);
+    test_function<T, test_functions::Func_arg>(dm, N, ptr_in, ptr_out, ptr_out_gen, false);
+    test_function<T, test_functions::Func_cis>(dm, N, ptr_in, ptr_out, ptr_out_gen, false);
+
     using TR    = typename ms::details::real_type<T>::type;
 
     // block methods are not exact; use positive values in order to
@@ -195,10 +211,20 @@ void test_simd_compl::test_functions_bin()
         (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 1.0, true);
     test_function_bin<T, test_functions::Func_div>
         (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 10.0, false);
+    test_function_bin<T, test_functions::Func_mult_fast>
+        (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 1.0, true);
+    test_function_bin<T, test_functions::Func_div_fast>
+        (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 10.0, false);
     test_function_bin<T, test_functions::Func_plus>
         (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 1.0, true);
     test_function_bin<T, test_functions::Func_minus>
         (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 1.0, true);
+    test_function_bin<T, test_functions::Func_pow>
+        (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 10.0, false);
+    test_function_bin<T, test_functions::Func_split_mult>
+        (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 1.0, false);
+    test_function_bin<T, test_functions::Func_split_div>
+        (dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen, 10.0, false);
 
     test_function_bin_RC<T, test_functions::Func_mult_RC, TR>
         (dm, N, ptr_in_1r, ptr_in_2, ptr_out, ptr_out_gen, 1.0, true);
@@ -766,4 +792,55 @@ std::string test_simd_compl::make_status(bool ok, double ulp_dist)
     return os.str();
 }
 
+template<class T>
+void test_simd_compl::test_functions_partial()
+{
+    using TR            = typename ms::details::real_type<T>::type;
+
+    static const int N  = 16;
+
+    // nonzero values different than the sentinel
+    T in[N];
+
+    for (int i = 0; i < N; ++i)
+        in[i]           = T(TR(i + 1) / TR(3), TR(-i - 2) / TR(7));
+
+    const TR nan        = std::numeric_limits<TR>::quiet_NaN();
+    const T sentinel    = T(nan, nan);
+
+    std::string header  = m_instr_tag + " partial " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",        align_type::right, 10);
+    dm.add_column("128 no",         align_type::left, 5);
+    dm.add_column("256 no",         align_type::left, 5);
+    dm.add_column("128 sse",        align_type::left, 5);
+    dm.add_column("256 sse",        align_type::left, 5);
+    dm.add_column("256 avx",        align_type::left, 5);
+    dm.add_column("status",         align_type::left, 5);
+
+    dm.disp_header();
+
+    // number of failed tests for n = 0, ..., vector_size
+    int e1  = test_functions::test_partial<simd::simd_compl<TR, 128, simd::nosimd_tag>>::eval(in, sentinel);
+    int e2  = test_functions::test_partial<simd::simd_compl<TR, 256, simd::nosimd_tag>>::eval(in, sentinel);
+    int e3  = test_functions::test_partial<simd::simd_compl<TR, 128, simd::sse_tag>>::eval(in, sentinel);
+    int e4  = test_functions::test_partial<simd::simd_compl<TR, 256, simd::sse_tag>>::eval(in, sentinel);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        int e5  = test_functions::test_partial<simd::simd_compl<TR, 256, simd::avx_tag>>::eval(in, sentinel);
+    #else
+        int e5  = 0;
+    #endif
+
+    bool ok = (e1 + e2 + e3 + e4 + e5) == 0;
+
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    dm.disp_row("load/store", e1, e2, e3, e4, e5, status);
+};
+
 }};
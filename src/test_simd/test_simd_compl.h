@@ -29,6 +29,7 @@ class test_simd_compl
         test_simd_compl(bool test_values);
 
         void    make_binary();
+        void    make_partial();
         void    make_unary();
 
     private:
@@ -53,6 +54,9 @@ class test_simd_compl
         template<class T>
         void    test_functions_bin();
 
+        template<class T>
+        void    test_functions_partial();
+
         template<class T, class Func>
         void    test_function(formatted_disp& fd, int size, const T* in, 
                     T* out, T* out_gen, bool test_componentwise);
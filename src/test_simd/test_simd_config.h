@@ -8,7 +8,20 @@
 
 #pragma once
 
-#ifdef MATCL_TEST_SIMD_FMA
+#ifdef MATCL_TEST_SIMD_AVX512
+    #define MATCL_ARCHITECTURE_HAS_SSE2 1
+    #define MATCL_ARCHITECTURE_HAS_SSE3 1
+    #define MATCL_ARCHITECTURE_HAS_SSE41 1
+    #define MATCL_ARCHITECTURE_HAS_SSE42 1
+    #define MATCL_ARCHITECTURE_HAS_AVX 1
+    #define MATCL_ARCHITECTURE_HAS_AVX2 1
+    #define MATCL_ARCHITECTURE_HAS_FMA 1
+    #define MATCL_ARCHITECTURE_HAS_AVX512F 1
+    #define MATCL_ARCHITECTURE_HAS_AVX512DQ 1
+
+    #define MATCL_TEST_SIMD_TAG "avx512"
+
+#elif defined MATCL_TEST_SIMD_FMA
     #define MATCL_ARCHITECTURE_HAS_SSE2 1
     #define MATCL_ARCHITECTURE_HAS_SSE3 1
     #define MATCL_ARCHITECTURE_HAS_SSE41 1
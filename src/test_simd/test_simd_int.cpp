@@ -38,6 +38,7 @@ void test::test_values_int()
     test_simd_int(true).make_unary_int();
     test_simd_int(true).make_binary();
     test_simd_int(true).make_unary();
+    test_simd_int(false).make_partial();
 };
 
 template<class T>
@@ -103,6 +104,12 @@ void test_simd_int::make_ternary()
     test_functions_3<int64_t>();    
 };
 
+void test_simd_int::make_partial()
+{
+    test_functions_partial<int32_t>();
+    test_functions_partial<int64_t>();
+};
+
 template<class T, class Simd_type, class Func>
 double test_simd_int::test_function_simd(int size, int n_rep, const T* in, T* out)
 {
@@ -241,8 +248,8 @@ double test_simd_int::test_function_generic(int size, int n_rep, const T* in, T*
 template<class T, class Func>
 void test_simd_int::test_function(formatted_disp& fd, int size, const T* in, T* out, T* out_gen)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v2, v3, v4, v5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v2, v3, v4, v5, v6;
 
     t0  = test_function_simd<T, ms::simd<T, 128, ms::nosimd_tag>, Func>(size, 1, in, out_gen);
 
@@ -266,7 +273,15 @@ void test_simd_int::test_function(formatted_disp& fd, int size, const T* in, T*
         v5  = true;
     #endif
 
-    bool ok = v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out);    
+        v6  = test_equal(size, out, out_gen);
+    #else
+        t6  = t0;
+        v6  = true;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -283,16 +298,26 @@ void test_simd_int::test_function(formatted_disp& fd, int size, const T* in, T*
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(N, M, in, out);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class T_int, class Func>
 void test_simd_int::test_function_int(formatted_disp& fd, int size, const T_int* in, T* out, T* out_gen,
                                 const Func& func)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v3, v4, v5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v3, v4, v5, v6;
 
     t0  = test_function_simd_int<T, T_int, ms::simd<T, 128, ms::nosimd_tag>, Func>(size, 1, in, out_gen, func);
 
@@ -315,7 +340,15 @@ void test_simd_int::test_function_int(formatted_disp& fd, int size, const T_int*
         v5  = true;
     #endif
 
-    bool ok = v1 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd_int<T, T_int, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out, func);    
+        v6  = test_equal(size, out, out_gen);
+    #else
+        t6  = t0;
+        v6  = true;
+    #endif
+
+    bool ok = v1 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -332,16 +365,26 @@ void test_simd_int::test_function_int(formatted_disp& fd, int size, const T_int*
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_simd_int<T, T_int, simd::simd<T, 512, simd::avx512_tag>, Func>(N, M, in, out, func);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
 void test_simd_int::test_function_bin(formatted_disp& fd, int size, const T* in_1, 
                                   const T* in_2, T* out, T* out_gen)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v2, v3, v4, v5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v2, v3, v4, v5, v6;
 
     t0  = test_function_bin_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>(size, 1, in_1, in_2, out_gen);
 
@@ -365,7 +408,15 @@ void test_simd_int::test_function_bin(formatted_disp& fd, int size, const T* in_
         v5  = true;
     #endif
 
-    bool ok = v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_bin_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in_1, in_2, out);    
+        v6  = test_equal(size, out, out_gen);
+    #else
+        t6  = t0;
+        v6  = true;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -388,8 +439,19 @@ void test_simd_int::test_function_bin(formatted_disp& fd, int size, const T* in_
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_bin_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (N, M, in_1, in_2, out);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
@@ -427,8 +489,8 @@ template<class T, class Func>
 void test_simd_int::test_function_3(formatted_disp& fd, int size, const T* in_1, 
                                const T* in_2, const T* in_3, T* out, T* out_gen)
 {
-    double t0, t1, t2, t3, t4, t5;
-    bool v1, v2, v3, v4, v5;
+    double t0, t1, t2, t3, t4, t5, t6;
+    bool v1, v2, v3, v4, v5, v6;
 
     t0  = test_function_3_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>
                 (size, 1, in_1, in_2, in_3, out_gen);
@@ -458,7 +520,16 @@ void test_simd_int::test_function_3(formatted_disp& fd, int size, const T* in_1,
         v5  = true;
     #endif
 
-    bool ok = v1 && v2 && v3 && v4 && v5;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_3_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (size, 1, in_1, in_2, in_3, out);    
+        v6  = test_equal(size, out, out_gen);
+    #else
+        t6  = t0;
+        v6  = true;
+    #endif
+
+    bool ok = v1 && v2 && v3 && v4 && v5 && v6;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -481,16 +552,27 @@ void test_simd_int::test_function_3(formatted_disp& fd, int size, const T* in_1,
         t5  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t6  = test_function_3_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (N, M, in_1, in_2, in_3, out);    
+    #else
+        t6  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, t0/t6, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, t0/t4, t0/t5, status);
+    #endif
 };
 
 template<class T, class Func>
 void test_simd_int::test_function_block(formatted_disp& fd, int size, const T* in, 
                                     T* out, T* out_gen)
 {
-    double t0, t1, t2, t3, t4;
-    bool v1, v3, v4;
+    double t0, t1, t2, t3, t4, t5;
+    bool v1, v3, v4, v5;
 
     t0  = test_function_simd<T, simd::simd<T, 128, simd::nosimd_tag>, Func>(size, 1, in, out_gen);
 
@@ -510,7 +592,17 @@ void test_simd_int::test_function_block(formatted_disp& fd, int size, const T* i
         v4  = true;
     #endif
 
-    bool ok = v1 && v3 && v4;
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        test_functions::test_block_512<Func>::eval(size, in, out_gen);
+
+        t5  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>(size, 1, in, out);    
+        v5  = test_equal(size, out, out_gen);
+    #else
+        t5  = t0;
+        v5  = true;
+    #endif
+
+    bool ok = v1 && v3 && v4 && v5;
 
     int N       = get_size_perf();
     int M       = get_num_rep();
@@ -531,14 +623,27 @@ void test_simd_int::test_function_block(formatted_disp& fd, int size, const T* i
         t4  = t0;
     #endif
 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        t5  = test_function_simd<T, simd::simd<T, 512, simd::avx512_tag>, Func>
+                (N, M, in, out);    
+    #else
+        t5  = t0;
+    #endif
+
     std::string status  = (ok == true) ? "OK" : "FAIL"; 
-    fd.disp_row(Func::name(), t0, t0/t0, t0/t2, t0/t1, t0/t3, t0/t4, status);
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        fd.disp_row(Func::name(), t0, t0/t0, t0/t2, t0/t1, t0/t3, t0/t4, t0/t5, status);
+    #else
+        fd.disp_row(Func::name(), t0, t0/t0, t0/t2, t0/t1, t0/t3, t0/t4, status);
+    #endif
 };
 
 int test_simd_int::get_size() const
 {
+    // sizes must be multiples of the number of elements of the
+    // longest vector (16 for 512-bit vectors of float and int32)
     #ifdef _DEBUG
-        int N   = 1000;
+        int N   = 1024;
     #else
         int N   = 10000;
     #endif
@@ -555,7 +660,7 @@ int test_simd_int::get_size() const
 
 int test_simd_int::get_size_perf() const
 {
-    return 1000;
+    return 1024;
 }
 
 int test_simd_int::get_num_rep() const
@@ -606,6 +711,11 @@ void test_simd_int::test_functions()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -673,6 +783,11 @@ void test_simd_int::test_functions_select()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -790,6 +905,11 @@ void test_simd_int::test_functions_int()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -840,6 +960,11 @@ void test_simd_int::test_functions_bin()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -917,6 +1042,11 @@ void test_simd_int::test_functions_3()
     dm.add_column("128 sse",    align_type::left, 5);
     dm.add_column("256 sse",    align_type::left, 5);
     dm.add_column("256 avx",    align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
     dm.add_column("status",     align_type::left, 5);
 
     dm.disp_header();
@@ -925,4 +1055,71 @@ void test_simd_int::test_functions_3()
                                                  ptr_in_3, ptr_out, ptr_out_gen);
 };
 
+template<class T>
+void test_simd_int::test_functions_partial()
+{
+    static const int N  = 16;
+
+    // nonzero values different than the sentinel
+    T in[N];
+
+    for (int i = 0; i < N; ++i)
+        in[i]           = T(i + 1);
+
+    const T sentinel    = T(-1);
+
+    std::string header  = m_instr_tag + " partial " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",        align_type::right, 10);
+    dm.add_column("128 scal no",    align_type::left, 5);
+    dm.add_column("128 scal sse",   align_type::left, 5);
+    dm.add_column("128 no",         align_type::left, 5);
+    dm.add_column("256 no",         align_type::left, 5);
+    dm.add_column("128 sse",        align_type::left, 5);
+    dm.add_column("256 sse",        align_type::left, 5);
+    dm.add_column("256 avx",        align_type::left, 5);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.add_column("512 avx512", align_type::left, 5);
+    #endif
+
+    dm.add_column("status",         align_type::left, 5);
+
+    dm.disp_header();
+
+    // number of failed tests for n = 0, ..., vector_size
+    int e1  = test_functions::test_partial<simd::simd<T, 128, simd::scalar_nosimd_tag>>::eval(in, sentinel);
+    int e2  = test_functions::test_partial<simd::simd<T, 128, simd::scalar_sse_tag>>::eval(in, sentinel);
+    int e3  = test_functions::test_partial<simd::simd<T, 128, simd::nosimd_tag>>::eval(in, sentinel);
+    int e4  = test_functions::test_partial<simd::simd<T, 256, simd::nosimd_tag>>::eval(in, sentinel);
+    int e5  = test_functions::test_partial<simd::simd<T, 128, simd::sse_tag>>::eval(in, sentinel);
+    int e6  = test_functions::test_partial<simd::simd<T, 256, simd::sse_tag>>::eval(in, sentinel);
+
+    #if MATCL_ARCHITECTURE_HAS_AVX
+        int e7  = test_functions::test_partial<simd::simd<T, 256, simd::avx_tag>>::eval(in, sentinel);
+    #else
+        int e7  = 0;
+    #endif
+
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        int e8  = test_functions::test_partial<simd::simd<T, 512, simd::avx512_tag>>::eval(in, sentinel);
+    #else
+        int e8  = 0;
+    #endif
+
+    bool ok = (e1 + e2 + e3 + e4 + e5 + e6 + e7 + e8) == 0;
+
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    #if MATCL_ARCHITECTURE_HAS_AVX512F
+        dm.disp_row("load/store", e1, e2, e3, e4, e5, e6, e7, e8, status);
+    #else
+        dm.disp_row("load/store", e1, e2, e3, e4, e5, e6, e7, status);
+    #endif
+};
+
 }};
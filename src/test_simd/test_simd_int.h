@@ -35,6 +35,7 @@ class test_simd_int
         void    make_select();
         void    make_combine();
         void    make_unary_int();
+        void    make_partial();
 
     private:
         int     get_size() const;
@@ -65,6 +66,9 @@ class test_simd_int
         template<class T>
         void    test_functions_3();
 
+        template<class T>
+        void    test_functions_partial();
+
         template<class T, class Func>
         void    test_function(formatted_disp& fd, int size, const T* in, 
                     T* out, T* out_gen);
@@ -15,6 +15,7 @@
 #include "test_functions.h"
 
 #include <vector>
+#include <limits>
 
 namespace matcl { namespace test
 {
@@ -37,6 +38,7 @@ void test::test_values_real_scalar()
     test_simd_scalar(true).make_ternary();        
     test_simd_scalar(false).make_unary_int();
     test_simd_scalar(true).make_binary();        
+    test_simd_scalar(false).make_trig_special();
 };
 
 template<class T>
@@ -95,6 +97,12 @@ void test_simd_scalar::make_unary_math()
     test_functions_math<float>();    
 };
 
+void test_simd_scalar::make_trig_special()
+{
+    test_functions_trig_special<double>();
+    test_functions_trig_special<float>();    
+};
+
 void test_simd_scalar::make_unary_int()
 {
     test_functions_int<double>();
@@ -335,6 +343,31 @@ void test_simd_scalar::test_function_math(formatted_disp& fd, int size, const T*
     fd.disp_row(Func::name(), t0, t0/t1, t0/t2, t0/t3, status);
 };
 
+template<class T, class Func>
+void test_simd_scalar::test_function_special(formatted_disp& fd, int size, const T* in, T* out, 
+                                             T* out_gen)
+{
+    double d1, d2, d3;
+    bool v1, v2, v3;
+
+    test_function_std<T, Func>(size, 1, in, out_gen);
+
+    test_function_simd<T, simd::simd<T, 128, simd::scalar_nosimd_tag>, Func>(size, 1, in, out);
+    v1  = test_equal(size, out, out_gen, 1.0, d1);
+
+    test_function_simd<T, simd::simd<T, 128, simd::sse_tag>, Func>(size, 1, in, out);    
+    v2  = test_equal(size, out, out_gen, 1.0, d2);
+
+    test_function_simd<T, simd::simd<T, 128, simd::scalar_sse_tag>, Func>(size, 1, in, out);    
+    v3  = test_equal(size, out, out_gen, 1.0, d3);
+
+    bool ok = v1 && v2 && v3;
+
+    // distances in ulp instead of timings
+    std::string status  = (ok == true) ? "OK" : "FAIL"; 
+    fd.disp_row(Func::name(), d1, d2, d3, status);
+};
+
 template<class T, class T_int, class Func>
 void test_simd_scalar::test_function_int(formatted_disp& fd, int size, const T_int* in, T* out, T* out_gen,
                                 const Func& func)
@@ -623,8 +656,13 @@ void test_simd_scalar::test_functions_math()
     dm.disp_header();
 
     test_function_math<T, test_functions::Func_exp>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
+    test_function_math<T, test_functions::Func_exp2>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_exp10>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_expm1>(dm, N, ptr_in, ptr_out, ptr_out_gen);
     test_function_math<T, test_functions::Func_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
     test_function_math<T, test_functions::Func_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
+    test_function_math<T, test_functions::Func_sincos_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_sincos_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen);
     test_function_math<T, test_functions::Func_tan>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
     test_function_math<T, test_functions::Func_cot>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
     test_function<T, test_functions::Func_fraction>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
@@ -636,6 +674,74 @@ void test_simd_scalar::test_functions_math()
     
     test_function<T, test_functions::Func_sqrt>(dm, N, ptr_in, ptr_out, ptr_out_gen);
     test_function_math<T, test_functions::Func_log>(dm, N, ptr_in, ptr_out, ptr_out_gen); 
+    test_function_math<T, test_functions::Func_log2>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_log10>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_log1p>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_atan>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_asin>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_acos>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_sinh>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_cosh>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_tanh>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_sigmoid>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_softplus>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_erf>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_erfc>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_normcdf>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_norminv>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_rcp>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_rsqrt>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_cbrt>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_lgamma>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_tgamma>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_math<T, test_functions::Func_digamma>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+};
+
+template<class T>
+void test_simd_scalar::test_functions_trig_special()
+{
+    const T inf     = std::numeric_limits<T>::infinity();
+    const T nan     = std::numeric_limits<T>::quiet_NaN();
+    const T max     = std::numeric_limits<T>::max();
+    const T min     = std::numeric_limits<T>::min();
+
+    // non-finite values and huge values reduced by the Payne-Hanek algorithm
+    const T special[]   = {inf, -inf, nan, -nan, max, -max, T(1e30), T(-1e30), 
+                           T(1e10), T(-1e10), T(421657429.0), T(-421657429.0), 
+                           T(0.0), T(-0.0), min, T(1.0)};
+
+    static const int N  = sizeof(special) / sizeof(special[0]);
+
+    std::vector<T> in(special, special + N);
+    std::vector<T> out;
+    std::vector<T> out_gen;
+
+    out.resize(N);
+    out_gen.resize(N);
+
+    T* ptr_in       = in.data();
+    T* ptr_out      = out.data();
+    T* ptr_out_gen  = out_gen.data();
+
+    std::string header  = m_instr_tag + " trig special " + typeid(T).name();
+
+    disp(" ");
+    disp(header);
+
+    formatted_disp dm;
+
+    dm.set_row_label("func",        align_type::right, 10);
+    dm.add_column("128 scal no",    align_type::left, 5);
+    dm.add_column("128 sse",        align_type::left, 5);
+    dm.add_column("128 scal sse",   align_type::left, 5);
+    dm.add_column("status",         align_type::left, 5);
+
+    dm.disp_header();
+
+    test_function_special<T, test_functions::Func_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_special<T, test_functions::Func_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_special<T, test_functions::Func_sincos_sin>(dm, N, ptr_in, ptr_out, ptr_out_gen);
+    test_function_special<T, test_functions::Func_sincos_cos>(dm, N, ptr_in, ptr_out, ptr_out_gen);
 };
 
 template<class T>
@@ -704,6 +810,10 @@ void test_simd_scalar::test_functions_int()
                                                 test_functions::Func_pow2ki_int32<T>());
     test_function_int<T, int64_t, test_functions::Func_pow2ki_int64<T>>(dm, N, ptr_in_64, ptr_out, ptr_out_gen,
                                                 test_functions::Func_pow2ki_int64<T>());
+    test_function_int<T, int32_t, test_functions::Func_powi_int32<T>>(dm, N, ptr_in_32, ptr_out, ptr_out_gen,
+                                                test_functions::Func_powi_int32<T>());
+    test_function_int<T, int64_t, test_functions::Func_powi_int64<T>>(dm, N, ptr_in_64, ptr_out, ptr_out_gen,
+                                                test_functions::Func_powi_int64<T>());
     test_function_int<T, T, test_functions::Func_pow2k>(dm, N, ptr_in_t, ptr_out, ptr_out_gen,
                                                 test_functions::Func_pow2k());
 };
@@ -761,6 +871,9 @@ void test_simd_scalar::test_functions_bin()
     test_function_bin<T, test_functions::Func_minus>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);    
     test_function_bin<T, test_functions::Func_max>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
     test_function_bin<T, test_functions::Func_min>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
+    test_function_bin<T, test_functions::Func_pow>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
+    test_function_bin<T, test_functions::Func_atan2>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
+    test_function_bin<T, test_functions::Func_hypot>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
 
     test_function_bin<T, test_functions::Func_bit_and>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
     test_function_bin<T, test_functions::Func_bit_or>(dm, N, ptr_in_1, ptr_in_2, ptr_out, ptr_out_gen);
@@ -34,6 +34,7 @@ class test_simd_scalar
         void    make_unary();
         void    make_unary_math();
         void    make_unary_int();
+        void    make_trig_special();
 
     private:
         int     get_size() const;
@@ -52,6 +53,9 @@ class test_simd_scalar
         template<class T>
         void    test_functions_math();
 
+        template<class T>
+        void    test_functions_trig_special();
+
         template<class T>
         void    test_functions_int();
 
@@ -69,6 +73,10 @@ class test_simd_scalar
         void    test_function_math(formatted_disp& fd, int size, const T* in, 
                     T* out, T* out_gen);
 
+        template<class T, class Func>
+        void    test_function_special(formatted_disp& fd, int size, const T* in, 
+                    T* out, T* out_gen);
+
         template<class T, class T_int, class Func>
         void    test_function_int(formatted_disp& fd, int size, const T_int* in, 
                     T* out, T* out_gen, const Func& func);